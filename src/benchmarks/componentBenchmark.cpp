@@ -0,0 +1,277 @@
+/*
+ * Copyright (C) 2002 Sebastian Thiel
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ */
+
+// Vergleicht die componentAlgorithms mit den quadratischen Verfahren, die BPT_Helpers bisher verwendet hat - ohne Maya.
+// Die alten Verfahren sind hier auf std::vector nachgebaut, MIntArray::remove entspricht dabei vector::erase.
+//
+// Aufruf: componentBenchmark [zahlDerIDs] [wiederholungen]
+
+#include <componentAlgorithms.h>
+
+#include <algorithm>
+#include <iostream>
+#include <iterator>
+#include <vector>
+#include <stdlib.h>
+
+#ifdef WIN32
+#include "windows.h"
+#else
+#include <sys/time.h>
+#endif
+
+
+using std::cout;
+using std::endl;
+using std::vector;
+
+using namespace BPT;
+
+
+//-----------------------------------------------------------------------------------------
+static double	seconds()
+//-----------------------------------------------------------------------------------------
+{
+#ifdef WIN32
+	LARGE_INTEGER freq, now;
+	QueryPerformanceFrequency(&freq);
+	QueryPerformanceCounter(&now);
+
+	return (double)now.QuadPart / (double)freq.QuadPart;
+#else
+	struct timeval now;
+	gettimeofday(&now, NULL);
+
+	return (double)now.tv_sec + (double)now.tv_usec * 1e-6;
+#endif
+}
+
+
+//-----------------------------------------------------------------------------------------
+// Die bisherigen Verfahren
+//-----------------------------------------------------------------------------------------
+
+//! sortArray: Austauschsortierung
+static void		oldSort(vector<int>& array)
+{
+	const int l = (int)array.size();
+
+	for( int i = 0; i < l; i++ )
+		for( int a = i + 1; a < l; a++ )
+			if( array[a] < array[i] )
+				std::swap(array[a], array[i]);
+}
+
+//! pruneIntArray: jedes Element mit allen folgenden vergleichen und doppelte entfernen
+static void		oldPrune(vector<int>& orig)
+{
+	for( size_t i = 0; i < orig.size(); i++ )
+		for( size_t x = i + 1; x < orig.size(); x++ )
+			if( orig[i] == orig[x] )
+				orig.erase(orig.begin() + x--);
+}
+
+//! matchArray unter 200 Elementen: verschachtelte Schleifen, Treffer werden aus rhs entfernt
+static vector<int>	oldMatch(const vector<int>& lhs, vector<int> rhs)
+{
+	vector<int>	match;
+
+	for( size_t i = 0; i < lhs.size(); i++ )
+	{
+		for( size_t x = 0; x < rhs.size(); x++ )
+		{
+			if( lhs[i] == rhs[x] )
+			{
+				match.push_back(lhs[i]);
+				rhs.erase(rhs.begin() + x);
+				break;
+			}
+		}
+	}
+
+	return match;
+}
+
+
+//-----------------------------------------------------------------------------------------
+// Die neuen Verfahren, so wie BPT_Helpers sie verwendet
+//-----------------------------------------------------------------------------------------
+
+static void		newPrune(vector<int>& orig)
+{
+	idHashSet	seen;
+	seen.reserve((unsigned)orig.size());
+
+	size_t r = 0;
+	for( size_t i = 0; i < orig.size(); i++ )
+		if( seen.insert(orig[i]) )
+			orig[r++] = orig[i];
+
+	orig.resize(r);
+}
+
+static vector<int>	newMatch(const vector<int>& lhs, const vector<int>& rhs)
+{
+	idHashSet	rhsSet, matched;
+	rhsSet.reserve((unsigned)rhs.size());
+
+	size_t i;
+	for( i = 0; i < rhs.size(); i++ )
+		rhsSet.insert(rhs[i]);
+
+	vector<int>	match;
+	for( i = 0; i < lhs.size(); i++ )
+		if( rhsSet.contains(lhs[i]) && matched.insert(lhs[i]) )
+			match.push_back(lhs[i]);
+
+	return match;
+}
+
+
+//-----------------------------------------------------------------------------------------
+static void		report(const char* name, double oldMs, double newMs, bool same)
+//-----------------------------------------------------------------------------------------
+{
+	cout<<"  "<<name<<"\told: "<<oldMs<<" ms\tnew: "<<newMs<<" ms\tspeedup: "<<( newMs > 0.0 ? oldMs / newMs : 0.0 )
+		<<( same ? "" : "\tRESULTS DIFFER" )<<endl;
+}
+
+
+//-----------------------------------------------------------------------------------------
+int main(int argc, char** argv)
+//-----------------------------------------------------------------------------------------
+{
+	const int count = ( argc > 1 ) ? atoi(argv[1]) : 20000;
+	const int repetitions = ( argc > 2 ) ? atoi(argv[2]) : 3;
+
+	if( count < 1 || repetitions < 1 )
+	{
+		cout<<"usage: componentBenchmark [numIDs >= 1] [repetitions >= 1]"<<endl;
+		return 1;
+	}
+
+
+	// Wie eine Selektion auf einem grossen Mesh: IDs verstreut ueber den 4 fachen Bereich, mit einigen doppelten
+	srand(1);
+
+	vector<int>	ids(count), others(count);
+	for( int i = 0; i < count; i++ )
+	{
+		ids[i] = rand() % (count * 4);
+		others[i] = rand() % (count * 4);
+	}
+
+	cout<<count<<" ids, "<<repetitions<<" repetitions"<<endl<<endl;
+
+	bool		allSame = true;
+	vector<int>	oldResult, newResult, scratch;
+	double		start, oldMs, newMs;
+	int			r;
+
+
+	// sortArray
+	start = seconds();
+	for( r = 0; r < repetitions; r++ )
+	{
+		oldResult = ids;
+		oldSort(oldResult);
+	}
+	oldMs = ( seconds() - start ) * 1000.0 / repetitions;
+
+	start = seconds();
+	for( r = 0; r < repetitions; r++ )
+	{
+		newResult = ids;
+		radixSort(&newResult[0], (unsigned)newResult.size(), scratch);
+	}
+	newMs = ( seconds() - start ) * 1000.0 / repetitions;
+
+	report("sort", oldMs, newMs, oldResult == newResult);
+	allSame &= oldResult == newResult;
+
+
+	// pruneIntArray
+	start = seconds();
+	for( r = 0; r < repetitions; r++ )
+	{
+		oldResult = ids;
+		oldPrune(oldResult);
+	}
+	oldMs = ( seconds() - start ) * 1000.0 / repetitions;
+
+	start = seconds();
+	for( r = 0; r < repetitions; r++ )
+	{
+		newResult = ids;
+		newPrune(newResult);
+	}
+	newMs = ( seconds() - start ) * 1000.0 / repetitions;
+
+	report("prune", oldMs, newMs, oldResult == newResult);
+	allSame &= oldResult == newResult;
+
+
+	// matchArray - die alte Variante liefert doppelte so oft, wie sie in beiden Arrays vorkommen, deshalb
+	// werden die Eingaben vorher gepruned
+	vector<int>	lhs = ids, rhs = others;
+	newPrune(lhs);
+	newPrune(rhs);
+
+	start = seconds();
+	for( r = 0; r < repetitions; r++ )
+		oldResult = oldMatch(lhs, rhs);
+	oldMs = ( seconds() - start ) * 1000.0 / repetitions;
+
+	start = seconds();
+	for( r = 0; r < repetitions; r++ )
+		newResult = newMatch(lhs, rhs);
+	newMs = ( seconds() - start ) * 1000.0 / repetitions;
+
+	report("match", oldMs, newMs, oldResult == newResult);
+	allSame &= oldResult == newResult;
+
+
+	// Sortierte Mengenoperationen gegen die Standardbibliothek pruefen
+	vector<int>	a = lhs, b = rhs;
+	radixSort(&a[0], (unsigned)a.size(), scratch);
+	radixSort(&b[0], (unsigned)b.size(), scratch);
+
+	vector<int>	expected, result(a.size());
+
+	std::set_intersection(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(expected));
+	result.resize( intersectSorted(&a[0], (unsigned)a.size(), &b[0], (unsigned)b.size(), &result[0]) );
+	allSame &= result == expected;
+
+	expected.clear();
+	result.resize(a.size());
+	std::set_difference(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(expected));
+	result.resize( differenceSorted(&a[0], (unsigned)a.size(), &b[0], (unsigned)b.size(), &result[0]) );
+	allSame &= result == expected;
+
+	newResult = ids;
+	radixSort(&newResult[0], (unsigned)newResult.size(), scratch);
+	newResult.resize( uniqueSorted(&newResult[0], (unsigned)newResult.size()) );
+	expected = ids;
+	std::sort(expected.begin(), expected.end());
+	expected.erase( std::unique(expected.begin(), expected.end()), expected.end() );
+	allSame &= newResult == expected;
+
+	cout<<endl<<( allSame ? "all results match" : "RESULTS DIFFER" )<<endl;
+
+	return allSame ? 0 : 1;
+}
@@ -0,0 +1,213 @@
+/*
+ * Copyright (C) 2002 Sebastian Thiel
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ */
+
+// Misst den geodesicSolver auf synthetischen, gewellten Gittern - ohne Maya.
+//
+// Aufruf: geodesicBenchmark [gitterBreite] [wiederholungen]
+
+#include <geodesicSolver.h>
+
+#include <algorithm>
+#include <iostream>
+#include <vector>
+#include <stdlib.h>
+#include <math.h>
+
+#ifdef WIN32
+#include "windows.h"
+#else
+#include <sys/time.h>
+#endif
+
+
+using std::cout;
+using std::endl;
+using std::vector;
+
+using namespace BPT;
+
+
+//-----------------------------------------------------------------------------------------
+static double	seconds()
+//-----------------------------------------------------------------------------------------
+{
+#ifdef WIN32
+	LARGE_INTEGER freq, now;
+	QueryPerformanceFrequency(&freq);
+	QueryPerformanceCounter(&now);
+
+	return (double)now.QuadPart / (double)freq.QuadPart;
+#else
+	struct timeval now;
+	gettimeofday(&now, NULL);
+
+	return (double)now.tv_sec + (double)now.tv_usec * 1e-6;
+#endif
+}
+
+
+/** Quadgitter mit res * res Vertizen und Kantenlaenge 1, leicht gewellt, damit die Kantenlaengen variieren.
+	Die Nachbarschaft ist die der angrenzenden Faces - wie vertexAdjacency sie liefert
+*/
+struct	syntheticGrid
+{
+	unsigned			numVertices;
+	vector<double>		positions;
+	vector<unsigned>	offsets;
+	vector<int>			neighbours;
+
+	explicit syntheticGrid(int res)
+	{
+		numVertices = (unsigned)(res * res);
+
+		positions.resize(numVertices * 3);
+		offsets.resize(numVertices + 1);
+		neighbours.reserve(numVertices * 8);
+
+		int x, y;
+		for( y = 0; y < res; y++ )
+		{
+			for( x = 0; x < res; x++ )
+			{
+				double* p = &positions[ (y * res + x) * 3 ];
+
+				p[0] = x;
+				p[1] = 0.25 * sin(x * 0.3) * cos(y * 0.2);
+				p[2] = y;
+			}
+		}
+
+		offsets[0] = 0;
+		for( y = 0; y < res; y++ )
+		{
+			for( x = 0; x < res; x++ )
+			{
+				for( int dy = -1; dy <= 1; dy++ )
+				{
+					for( int dx = -1; dx <= 1; dx++ )
+					{
+						const int nx = x + dx, ny = y + dy;
+
+						if( (dx == 0 && dy == 0) || nx < 0 || ny < 0 || nx >= res || ny >= res )
+							continue;
+
+						neighbours.push_back(ny * res + nx);
+					}
+				}
+
+				offsets[ y * res + x + 1 ] = (unsigned)neighbours.size();
+			}
+		}
+	}
+};
+
+
+//-----------------------------------------------------------------------------------------
+static void	run(	geodesicSolver& solver,
+					const syntheticGrid& grid,
+					const vector<int>& sources,
+					double radius,
+					unsigned maxLabels,
+					int repetitions )
+//-----------------------------------------------------------------------------------------
+{
+	// Einmal vorweg, damit der Arbeitsspeicher des Solvers bereits alloziert ist - wie bei wiederholten computes
+	solver.solve(	grid.numVertices, &grid.offsets[0], &grid.neighbours[0], &grid.positions[0],
+					&sources[0], (unsigned)sources.size(), radius, maxLabels );
+
+	const double start = seconds();
+
+	for( int r = 0; r < repetitions; r++ )
+	{
+		solver.solve(	grid.numVertices, &grid.offsets[0], &grid.neighbours[0], &grid.positions[0],
+						&sources[0], (unsigned)sources.size(), radius, maxLabels );
+	}
+
+	const double ms = ( seconds() - start ) * 1000.0 / repetitions;
+
+	cout<<"  sources: "<<sources.size()<<"\tradius: "<<radius<<"\tmaxLabels: "<<maxLabels
+		<<"\treached: "<<solver.numReached()<<"\t"<<ms<<" ms"<<endl;
+}
+
+
+//-----------------------------------------------------------------------------------------
+int main(int argc, char** argv)
+//-----------------------------------------------------------------------------------------
+{
+	const int res = ( argc > 1 ) ? atoi(argv[1]) : 708;		// 708 * 708 ~ 500k Vertizen
+	const int repetitions = ( argc > 2 ) ? atoi(argv[2]) : 5;
+
+	if( res < 2 || repetitions < 1 )
+	{
+		cout<<"usage: geodesicBenchmark [gridResolution >= 2] [repetitions >= 1]"<<endl;
+		return 1;
+	}
+
+
+	cout<<"building grid "<<res<<" x "<<res<<" ..."<<endl;
+	syntheticGrid	grid(res);
+	cout<<grid.numVertices<<" vertices, "<<grid.neighbours.size()<<" neighbour entries"<<endl<<endl;
+
+	geodesicSolver	solver;
+
+
+	// Einzelner Vertex in der Mitte
+	vector<int>	sources(1, (res / 2) * res + res / 2);
+
+	cout<<"single source:"<<endl;
+	run(solver, grid, sources, res * 0.1, 1, repetitions);
+	run(solver, grid, sources, res * 0.5, 1, repetitions);
+	run(solver, grid, sources, res * 2.0, 1, repetitions);
+
+
+	// Zusammenhaengender Patch in der Mitte, wie eine typische Selektion
+	sources.clear();
+	const int patch = std::max(1, res / 20);
+	for( int y = res / 2 - patch / 2; y < res / 2 + patch / 2 + 1; y++ )
+	{
+		for( int x = res / 2 - patch / 2; x < res / 2 + patch / 2 + 1; x++ )
+			sources.push_back(y * res + x);
+	}
+
+	cout<<endl<<"selected patch:"<<endl;
+	run(solver, grid, sources, res * 0.25, 1, repetitions);
+	run(solver, grid, sources, res * 0.25, 4, repetitions);
+	run(solver, grid, sources, res * 2.0, 1, repetitions);
+	run(solver, grid, sources, res * 2.0, 4, repetitions);
+
+
+	// Pruefung gegen die euklidische Distanz: die geodaetische Distanz darf nie kleiner sein
+	sources.assign(1, 0);
+	solver.solve(	grid.numVertices, &grid.offsets[0], &grid.neighbours[0], &grid.positions[0],
+					&sources[0], 1, res * 4.0, 1 );
+
+	unsigned	numShorter = 0;
+	for( unsigned i = 0; i < solver.numReached(); i++ )
+	{
+		const double* p = &grid.positions[ solver.vertex(i) * 3 ];
+		const double euclid = sqrt( p[0] * p[0] + (p[1] - grid.positions[1]) * (p[1] - grid.positions[1]) + p[2] * p[2] );
+
+		if( solver.labelsBegin(i)->first < euclid - 1e-9 )
+			numShorter++;
+	}
+
+	cout<<endl<<"reached "<<solver.numReached()<<" of "<<grid.numVertices<<" from corner, "
+		<<numShorter<<" shorter than euclidean distance"<<endl;
+
+	return ( solver.numReached() == grid.numVertices && numShorter == 0 ) ? 0 : 1;
+}
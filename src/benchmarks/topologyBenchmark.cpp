@@ -0,0 +1,507 @@
+/*
+ * Copyright (C) 2002 Sebastian Thiel
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ */
+
+// Microbenchmark der Speicherung in meshTopology, in der meshCreator seine Vertizen und Faces haelt - auf erzeugten
+// Gittern und Kugeln und optional auf einem Produktionsmesh aus einer OBJ Datei, ohne Maya.
+// Gemessen werden nur einfache Schleifen ueber die Primitive von meshTopology: Edges teilen, Faces teilen und Faces
+// in Quads um ihren Mittelpunkt unterteilen. Das sind NICHT die Aktionen von BPT - SmartSplit, InsertVertex,
+// ConnectVertices und (Solid)Chamfer brauchen MFnMesh, Normalen und UVs und laufen nur in Maya. Normalen und UVs
+// liegen ausserdem weiterhin im meshCreator und werden hier nicht gemessen.
+// Nach jeder Operation wird geprueft, ob das Mesh noch gueltig ist und sich seine Euler Charakteristik nicht
+// geaendert hat.
+//
+// Aufruf: topologyBenchmark [gitterBreite] [mesh.obj]
+
+#include <meshTopology.h>
+
+#include <algorithm>
+#include <map>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+#include <stdlib.h>
+#include <math.h>
+
+#ifdef WIN32
+#include "windows.h"
+#include "psapi.h"
+#pragma comment(lib, "psapi.lib")
+#else
+#include <sys/time.h>
+#include <sys/resource.h>
+#endif
+
+
+using std::cout;
+using std::endl;
+using std::vector;
+
+using namespace BPT;
+
+
+//-----------------------------------------------------------------------------------------
+static double	seconds()
+//-----------------------------------------------------------------------------------------
+{
+#ifdef WIN32
+	LARGE_INTEGER freq, now;
+	QueryPerformanceFrequency(&freq);
+	QueryPerformanceCounter(&now);
+
+	return (double)now.QuadPart / (double)freq.QuadPart;
+#else
+	struct timeval now;
+	gettimeofday(&now, NULL);
+
+	return (double)now.tv_sec + (double)now.tv_usec * 1e-6;
+#endif
+}
+
+
+//-----------------------------------------------------------------------------------------
+static double	peakMegabytes()
+//-----------------------------------------------------------------------------------------
+{
+#ifdef WIN32
+	PROCESS_MEMORY_COUNTERS counters;
+	GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters));
+
+	return (double)counters.PeakWorkingSetSize / (1024.0 * 1024.0);
+#else
+	struct rusage usage;
+	getrusage(RUSAGE_SELF, &usage);
+
+	// ru_maxrss ist unter Linux in KB, unter OSX in Byte
+#ifdef __APPLE__
+	return (double)usage.ru_maxrss / (1024.0 * 1024.0);
+#else
+	return (double)usage.ru_maxrss / 1024.0;
+#endif
+#endif
+}
+
+
+//-----------------------------------------------------------------------------------------
+// MESHES
+//-----------------------------------------------------------------------------------------
+
+//! Quadgitter mit res * res Faces
+static void		buildGrid(meshTopology& mesh, int res)
+{
+	mesh.clear();
+	mesh.reserve( (res + 1) * (res + 1), res * res, res * res * 4 );
+
+	int x, y;
+	for( y = 0; y <= res; y++ )
+		for( x = 0; x <= res; x++ )
+			mesh.addVertex(x, 0.0, y);
+
+	int quad[4];
+	for( y = 0; y < res; y++ )
+	{
+		for( x = 0; x < res; x++ )
+		{
+			quad[0] = y * (res + 1) + x;
+			quad[1] = quad[0] + 1;
+			quad[2] = quad[1] + res + 1;
+			quad[3] = quad[0] + res + 1;
+
+			mesh.addFace(quad, 4);
+		}
+	}
+}
+
+//! Geschlossene Kugel aus Quads mit Dreiecken an den Polen
+static void		buildSphere(meshTopology& mesh, int segments, int rings)
+{
+	mesh.clear();
+
+	const double pi = 3.14159265358979323846;
+
+	const int top = mesh.addVertex(0.0, 1.0, 0.0);
+
+	int r, s;
+	for( r = 1; r < rings; r++ )
+	{
+		const double phi = pi * r / rings;
+
+		for( s = 0; s < segments; s++ )
+		{
+			const double theta = 2.0 * pi * s / segments;
+			mesh.addVertex( sin(phi) * cos(theta), cos(phi), sin(phi) * sin(theta) );
+		}
+	}
+
+	const int bottom = mesh.addVertex(0.0, -1.0, 0.0);
+
+	int face[4];
+	for( s = 0; s < segments; s++ )
+	{
+		face[0] = top;
+		face[1] = 1 + (s + 1) % segments;
+		face[2] = 1 + s;
+		mesh.addFace(face, 3);
+	}
+
+	for( r = 0; r < rings - 2; r++ )
+	{
+		for( s = 0; s < segments; s++ )
+		{
+			face[0] = 1 + r * segments + s;
+			face[1] = 1 + r * segments + (s + 1) % segments;
+			face[2] = face[1] + segments;
+			face[3] = face[0] + segments;
+			mesh.addFace(face, 4);
+		}
+	}
+
+	const int last = 1 + (rings - 2) * segments;
+	for( s = 0; s < segments; s++ )
+	{
+		face[0] = bottom;
+		face[1] = last + s;
+		face[2] = last + (s + 1) % segments;
+		mesh.addFace(face, 3);
+	}
+}
+
+//! Liest v und f Zeilen einer OBJ Datei - Texturkoordinaten und Normalen werden ignoriert
+static bool		readObj(meshTopology& mesh, const char* path)
+{
+	std::ifstream file(path);
+	if( !file )
+		return false;
+
+	mesh.clear();
+
+	std::string		line, token;
+	vector<int>		face;
+
+	while( std::getline(file, line) )
+	{
+		std::istringstream stream(line);
+		stream >> token;
+
+		if( token == "v" )
+		{
+			double x = 0.0, y = 0.0, z = 0.0;
+			stream >> x >> y >> z;
+			mesh.addVertex(x, y, z);
+		}
+		else if( token == "f" )
+		{
+			face.clear();
+			while( stream >> token )
+			{
+				const int id = atoi(token.c_str());		// schneidet /vt/vn ab
+				face.push_back( id < 0 ? (int)mesh.numVertices() + id : id - 1 );
+			}
+
+			if( face.size() >= 3 )
+				mesh.addFace(&face[0], (unsigned)face.size());
+		}
+
+		token.clear();
+	}
+
+	return mesh.numFaces() > 0;
+}
+
+
+//-----------------------------------------------------------------------------------------
+// PRUEFUNG
+//-----------------------------------------------------------------------------------------
+
+//! V - E + F, oder eine grosse negative Zahl, wenn das Mesh ungueltig ist
+static long		eulerCharacteristic(const meshTopology& mesh)
+{
+	vector< std::pair<int, int> >	edges;
+	edges.reserve(mesh.numFaceVertices());
+
+	vector<int>	faceVtx;
+	for( unsigned f = 0; f < mesh.numFaces(); f++ )
+	{
+		mesh.getFaceVertices(f, faceVtx);
+
+		if( faceVtx.size() < 3 )
+			return -1000000;
+
+		for( unsigned i = 0; i < faceVtx.size(); i++ )
+		{
+			int s = faceVtx[i], e = faceVtx[ (i + 1) % faceVtx.size() ];
+
+			if( s < 0 || s >= (int)mesh.numVertices() || s == e )
+				return -1000000;
+
+			if( s > e )
+				std::swap(s, e);
+
+			edges.push_back( std::pair<int, int>(s, e) );
+		}
+	}
+
+	std::sort(edges.begin(), edges.end());
+	const long numEdges = (long)( std::unique(edges.begin(), edges.end()) - edges.begin() );
+
+	return (long)mesh.numVertices() - numEdges + (long)mesh.numFaces();
+}
+
+
+//-----------------------------------------------------------------------------------------
+// OPERATIONEN
+//-----------------------------------------------------------------------------------------
+
+//! Die mittlere Haelfte der Faces - bei den Gittern und Kugeln ein zusammenhaengender Bereich
+static void		selectFaces(const meshTopology& mesh, vector<int>& faces)
+{
+	faces.clear();
+	for( unsigned f = mesh.numFaces() / 4; f < mesh.numFaces() * 3 / 4; f++ )
+		faces.push_back(f);
+}
+
+//! Fuegt einen Vertex in die Edge ein, in alle Faces, die sie teilen - gibt ihn zurueck, -1 wenn es die Edge nicht gibt
+static int		splitEdge(meshTopology& mesh, int startID, int endID)
+{
+	// Kopie, da insertFaceVertices die Liste der Faces von startID veraendert
+	const vector<int> faces = mesh.connectedFaces(startID);
+
+	int newVtx = -1;
+
+	for( unsigned f = 0; f < faces.size(); f++ )
+	{
+		const int faceID = faces[f];
+		const int count = mesh.faceVertexCount(faceID);
+
+		const int s = mesh.localIndex(faceID, startID);
+		const int e = mesh.localIndex(faceID, endID);
+
+		if( e < 0 )
+			continue;
+
+		// die beiden muessen im Face benachbart sein - eingefuegt wird hinter dem, der in Umlaufrichtung zuerst kommt
+		int after;
+		if( (s + 1) % count == e )
+			after = s;
+		else if( (e + 1) % count == s )
+			after = e;
+		else
+			continue;
+
+		if( newVtx < 0 )
+			newVtx = mesh.newVertexBetween(startID, endID);
+
+		mesh.insertFaceVertices(faceID, after + 1, &newVtx, 1);
+	}
+
+	return newVtx;
+}
+
+//! Teilt das Face zwischen den beiden Vertizen - gibt das neue Face zurueck oder -1
+static int		splitFace(meshTopology& mesh, int faceID, int vtxA, int vtxB)
+{
+	const int count = mesh.faceVertexCount(faceID);
+
+	int a = mesh.localIndex(faceID, vtxA);
+	int b = mesh.localIndex(faceID, vtxB);
+
+	if( a < 0 || b < 0 || a == b )
+		return -1;
+
+	if( a > b )
+		std::swap(a, b);
+
+	// benachbarte Vertizen haben schon eine Edge
+	if( b - a == 1 || (a == 0 && b == count - 1) )
+		return -1;
+
+	vector<int> faceVtx;
+	mesh.getFaceVertices(faceID, faceVtx);
+
+	// das neue Face bekommt b bis Ende und Anfang bis a, das alte behaelt a bis b
+	vector<int> other( faceVtx.begin() + b, faceVtx.end() );
+	other.insert( other.end(), faceVtx.begin(), faceVtx.begin() + a + 1 );
+
+	mesh.changeFaceVertices(faceID, &faceVtx[a], (unsigned)(b - a + 1));
+
+	return mesh.addFace(&other[0], (unsigned)other.size());
+}
+
+static void		splitEdges(meshTopology& mesh, const vector<int>& faces)
+{
+	vector<int> faceVtx;
+	for( unsigned i = 0; i < faces.size(); i++ )
+	{
+		mesh.getFaceVertices(faces[i], faceVtx);
+		splitEdge(mesh, faceVtx[0], faceVtx[1]);
+	}
+}
+
+static void		splitFaces(meshTopology& mesh, const vector<int>& faces)
+{
+	vector<int> faceVtx;
+	for( unsigned i = 0; i < faces.size(); i++ )
+	{
+		mesh.getFaceVertices(faces[i], faceVtx);
+
+		if( faceVtx.size() >= 4 )
+			splitFace(mesh, faces[i], faceVtx[0], faceVtx[2]);
+	}
+}
+
+//! Teilt jede Edge der Faces und baut aus jedem Face Quads um seinen Mittelpunkt
+static void		subdivideFaces(meshTopology& mesh, const vector<int>& faces)
+{
+	unsigned i;
+	int x;
+
+	// erst alle Edges sammeln, solange die Faces noch ihre urspruenglichen Ecken haben - jede Edge nur einmal,
+	// auch wenn zwei gewaehlte Faces sie teilen
+	std::map< std::pair<int, int>, int >	edgeVertices;
+	vector<int>								faceVtx;
+
+	for( i = 0; i < faces.size(); i++ )
+	{
+		mesh.getFaceVertices(faces[i], faceVtx);
+
+		const int l = (int)faceVtx.size();
+		for( x = 0; x < l; x++ )
+		{
+			int s = faceVtx[x], e = faceVtx[ (x + 1) % l ];
+			if( s > e )
+				std::swap(s, e);
+
+			edgeVertices[ std::pair<int, int>(s, e) ] = -1;
+		}
+	}
+
+	// dann teilen - splitEdge traegt den neuen Vertex auch in die Nachbarn ein
+	std::map< std::pair<int, int>, int >::iterator	iter;
+	for( iter = edgeVertices.begin(); iter != edgeVertices.end(); ++iter )
+		iter->second = splitEdge(mesh, iter->first.first, iter->first.second);
+
+
+	// jetzt liegen in jedem Face abwechselnd Ecke und Edge Vertex - daraus die Quads um die Mitte bauen
+	int quad[4];
+
+	for( i = 0; i < faces.size(); i++ )
+	{
+		const int faceID = faces[i];
+
+		mesh.getFaceVertices(faceID, faceVtx);
+
+		const int center = mesh.createCenterVertex(faceID);
+		const int l = (int)faceVtx.size();
+
+		for( x = 0; x < l; x += 2 )
+		{
+			quad[0] = faceVtx[x];
+			quad[1] = faceVtx[ (x + 1) % l ];
+			quad[2] = center;
+			quad[3] = faceVtx[ (x + l - 1) % l ];
+
+			if( x == 0 )
+				mesh.changeFaceVertices(faceID, quad, 4);
+			else
+				mesh.addFace(quad, 4);
+		}
+	}
+}
+
+
+typedef void (*operation)(meshTopology&, const vector<int>&);
+
+
+//-----------------------------------------------------------------------------------------
+static bool		run(const char* name, const meshTopology& source, operation op)
+//-----------------------------------------------------------------------------------------
+{
+	meshTopology	mesh = source;
+	vector<int>		faces;
+	selectFaces(mesh, faces);
+
+	const long euler = eulerCharacteristic(mesh);
+
+	const double start = seconds();
+	op(mesh, faces);
+	const double ms = ( seconds() - start ) * 1000.0;
+
+	const bool valid = eulerCharacteristic(mesh) == euler;
+
+	cout<<"  "<<name<<"\t"<<faces.size()<<" faces\t"<<ms<<" ms\t-> "<<mesh.numVertices()<<" vertices, "
+		<<mesh.numFaces()<<" faces\tpeak: "<<peakMegabytes()<<" MB"<<( valid ? "" : "\tINVALID RESULT" )<<endl;
+
+	return valid;
+}
+
+
+//-----------------------------------------------------------------------------------------
+static bool		runAll(const char* meshName, const meshTopology& mesh)
+//-----------------------------------------------------------------------------------------
+{
+	cout<<meshName<<": "<<mesh.numVertices()<<" vertices, "<<mesh.numFaces()<<" faces"<<endl;
+
+	bool valid = true;
+	valid &= run("split edges", mesh, splitEdges);
+	valid &= run("split faces", mesh, splitFaces);
+	valid &= run("subdivide faces", mesh, subdivideFaces);
+
+	cout<<endl;
+
+	return valid;
+}
+
+
+//-----------------------------------------------------------------------------------------
+int main(int argc, char** argv)
+//-----------------------------------------------------------------------------------------
+{
+	const int res = ( argc > 1 ) ? atoi(argv[1]) : 200;		// 200 * 200 = 40k Faces
+
+	if( res < 2 )
+	{
+		cout<<"usage: topologyBenchmark [gridResolution >= 2] [mesh.obj]"<<endl;
+		return 1;
+	}
+
+	bool		valid = true;
+	meshTopology	mesh;
+
+	buildGrid(mesh, res);
+	valid &= runAll("grid", mesh);
+
+	buildSphere(mesh, res, res / 2 + 2);
+	valid &= runAll("sphere", mesh);
+
+	if( argc > 2 )
+	{
+		if( readObj(mesh, argv[2]) )
+			valid &= runAll(argv[2], mesh);
+		else
+		{
+			cout<<"could not read "<<argv[2]<<endl;
+			valid = false;
+		}
+	}
+
+	cout<<( valid ? "all results valid" : "INVALID RESULTS" )<<endl;
+
+	return valid ? 0 : 1;
+}
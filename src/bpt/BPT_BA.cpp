@@ -375,44 +375,28 @@ bool	BPT_BA::operator [] (long index) const
 void		BPT_BA::getIntArray(MIntArray& inResult) const
 //--------------------------------------------------------------------
 {
-	inResult.clear();	//um sicherzustellen, dass array wirklich leer ist und der aufrufenden Procedur die Arbeit zu ersparen
-
-	ULONG origIncrement = inResult.sizeIncrement();
-	inResult.setSizeIncrement((ULONG)highBound / sizeof(ULONG));	//ist am effizientesten, wenn 1/4 der vorhanden indices im BitArray auch wirklich besetzt sind
-
 	//gibt IntArray mit indizes zurück, die true sind.
 
+	//erst die bits zaehlen und dann in einem Rutsch schreiben - das spart die appends und das raten der SizeIncrement
+	ULONG count = null;
+	ULONG x;
+	for(x = null; x < numChunks; x++)
+		count += countBits( array[x] & chunkMask(x) );
 
+	inResult.setLength(count);
 
-	ULONG wert ;
-	ULONG l;
-
-	ULONG i = lowBound;	
-
-	for(ULONG x = null; x < numChunks; x++)
+	ULONG r = null;
+	for(x = null; x < numChunks; x++)
 	{
-		if( (array[x] & fulllong) == null)
-		{
-			//bis zum nächsten Chunk springen, allerdings abhängig von x, falls lowBound != 0
-			//i += nBitsInUlong;
-			i = ULONG(i / nBitsInUlong) * nBitsInUlong + nBitsInUlong;
-			continue;
-		}
-		else
-		{
-			for(l = ((x + one) * nBitsInUlong + offset); i < l ; i++)	//auf den entsprechenden Highbound wird hier nicht gecheckt, da ich davon ausgehe, dass alle anderen
-			{									//prozeduren die bounds berücksichtigen
-				
-				wert = one << i % nBitsInUlong;
-
-				if( array[x] & wert ) 
-					inResult.append(i + offset);
-			}
+		ULONG bits = array[x] & chunkMask(x);
+		const ULONG base = x * nBitsInUlong + offset;
 
+		while(bits)
+		{
+			inResult[r++] = (int)( base + lowestBit(bits) );
+			bits &= bits - one;
 		}
 	}
-
-	inResult.setSizeIncrement(origIncrement);
 }
 
 //--------------------------------------------------------------------
@@ -863,35 +847,11 @@ bool	BPT_BA::contract (ULONG  contractBy)
 ULONG	BPT_BA::syncNumTrue()
 //----------------------------
 {
-	// TODO: Highbound is not taken into consideration - fix this !	
-	//reset numTrue
+	//bits nur chunkweise zaehlen - bits ausserhalb von low und highBound werden ausmaskiert
 	numTrue = null;
 
-	//durch alle bits parsen und zählen
-	ULONG i = lowBound;
-	ULONG l;
-	ULONG wert;
 	for(ULONG x = null; x < numChunks; x++)
-	{
-		if( (array[x] & fulllong) == null)
-		{
-			//bis zum nächsten Chunk springen, allerdings abhängig von x, falls lowBound != 0
-			i = ULONG(i / nBitsInUlong) * nBitsInUlong + nBitsInUlong;
-			continue;
-		}
-		else
-		{
-			for(l = ((x + one) * nBitsInUlong + offset); i < l ; i++)	//auf den entsprechenden Highbound wird hier nicht gecheckt, da ich davon ausgehe, dass alle anderen
-			{									//prozeduren die bounds berücksichtigen
-				
-				wert = one << i % nBitsInUlong;
-
-				if( array[x] & wert) 
-					++numTrue;
-			}
-
-		}
-	}
+		numTrue += countBits( array[x] & chunkMask(x) );
 
 	return numTrue;
 
@@ -905,34 +865,13 @@ ULONG	BPT_BA::getFirstBitIndex() const
 	if(!numTrue)
 		return null;
 
-	 //eventuell koennte man sich den check sparen, wenn der check in der aufrufenden prozedur gemacht wirdb aber naja ;)
-
-	//jetzt runup machen und das erste gefundene bit samt index zurückgeben
-	ULONG i = lowBound;
-	ULONG l;
-	ULONG wert;
+	//bis zum ersten nicht leeren Chunk laufen, das bit selbst liefert dann ctz
 	for(ULONG x = null; x < numChunks; x++)
 	{
-		if( (array[x] & fulllong) == null)
-		{
-			//bis zum nächsten Chunk springen, allerdings abhängig von x, falls lowBound != 0
-			//i += nBitsInUlong;
-			//i = (x + one) * nBitsInUlong;
-			i = ULONG(i / nBitsInUlong) * nBitsInUlong + nBitsInUlong;
-			continue;
-		}
-		else
-		{
-			for(l = ((x + one) * nBitsInUlong + offset); i < l ; i++)	//auf den entsprechenden Highbound wird hier nicht gecheckt, da ich davon ausgehe, dass alle anderen
-			{									//prozeduren die bounds berücksichtigen
-				
-				wert = one << i % nBitsInUlong;
+		const ULONG bits = array[x] & chunkMask(x);
 
-				if( array[x] & wert) 
-					return i * ( i < highBound);
-			}
-
-		}
+		if(bits)
+			return x * nBitsInUlong + offset + lowestBit(bits);
 	}
 
 	//forbidden
@@ -948,39 +887,17 @@ ULONG	BPT_BA::getLastBitIndex() const
 	if(!numTrue)
 		return null;
 
-	 //eventuell koennte man sich den check sparen, wenn der check in der aufrufenden prozedur gemacht wirdb aber naja ;)
-
-	//jetzt runup machen und das erste gefundene bit samt index zurückgeben
-	ULONG i = highBound;
-	ULONG l;
-	ULONG wert;
+	//von hinten bis zum ersten nicht leeren Chunk laufen
 	for(ULONG x = numChunks; x > null; x--)
 	{
-		if( (array[x] & fulllong) == null)
-		{
-			//bis zum nächsten Chunk springen, allerdings abhängig von x, falls lowBound != 0
-			//i += nBitsInUlong;
-			i = ULONG(i / nBitsInUlong) * nBitsInUlong + nBitsInUlong;
+		const ULONG bits = array[x - one] & chunkMask(x - one);
 
-			continue;
-		}
-		else
-		{
-			for(l = ((x - one) * nBitsInUlong + offset); i > l ; i--)	
-			{									
-				
-				wert = one << i % nBitsInUlong;
-
-				if( array[x] & wert ) 
-					return i * ( i >= lowBound);	//damit die Boungrenze beachtet wird (kann man eventuell rausnehmen, 
-																	//da alle anderen proceduren diese grenzen *eingentlich* beachten)
-			}
-
-		}
+		if(bits)
+			return (x - one) * nBitsInUlong + offset + highestBit(bits);
 	}
 
 	//forbidden
-	MPRINT("GET FIRST BIT INDEX: WAR IM FORBIDDEN PATH");
+	MPRINT("GET LAST BIT INDEX: WAR IM FORBIDDEN PATH");
 	return null;
 }
 
@@ -1331,15 +1248,18 @@ bool		BPT_BA::performLogicalOperation(const BPT_BA& rhs, long operation, BPT_BA&
 
 	
 	//jetzt erstmal generell alle Chunks bearbeiten
+	//die Schleifen arbeiten auf ganzen Chunks ohne Abhaengigkeiten untereinander - so kann der Compiler sie vektorisieren
+	const ULONG* lhsChunks = array + thisAOffset;
+	const ULONG* rhsChunks = rhsArray + rhsAOffset;
+	ULONG* resultChunks = result + OPminOffset;
 
 	switch(operation)
 	{
 	case 0: //& OPERATION
 		{
 			for(ULONG x = null; x < allocSize; x++)
-			{
-				result[x] = array[x + thisAOffset] & rhsArray[x + rhsAOffset];
-			}
+				resultChunks[x] = lhsChunks[x] & rhsChunks[x];
+
 			break;
 		}
 
@@ -1347,9 +1267,8 @@ bool		BPT_BA::performLogicalOperation(const BPT_BA& rhs, long operation, BPT_BA&
 	case 1: //| OPERATION
 		{
 			for(ULONG x = null; x < allocSize; x++)
-			{
-				result[x] = array[x + thisAOffset] | rhsArray[x + rhsAOffset];
-			}
+				resultChunks[x] = lhsChunks[x] | rhsChunks[x];
+
 			break;
 		}
 
@@ -1357,19 +1276,15 @@ bool		BPT_BA::performLogicalOperation(const BPT_BA& rhs, long operation, BPT_BA&
 	case 2: //^ OPERATION
 		{
 			for(ULONG x = null; x < allocSize; x++)
-			{
-				result[x] = array[x + thisAOffset] ^ rhsArray[x + rhsAOffset];
-			}
+				resultChunks[x] = lhsChunks[x] ^ rhsChunks[x];
+
 			break;
 		}
 	case 3: //- OPERATION (minus)
 		{
-			ULONG tmp;
+			//and not - entspricht dem abziehen der uebereinstimmenden bits, ohne dass etwas wrappen kann
 			for(ULONG x = null; x < allocSize; x++)
-			{
-				tmp = array[x + thisAOffset] & rhsArray[x + rhsAOffset];	//da er die variable sonst wrapped, erstmal die bits finden, die übereinstimmen, und dann abziehen		
-				result[x + OPminOffset] = array[x + thisAOffset] - tmp;
-			}
+				resultChunks[x] = lhsChunks[x] & ~rhsChunks[x];
 
 			break;
 		}
@@ -1387,25 +1302,24 @@ bool		BPT_BA::performLogicalOperation(const BPT_BA& rhs, long operation, BPT_BA&
 	
 	//--> DIES IST JA EIGENTLICH UNNÖTIG ... (LO UND HIGHBOUNDS VERHINDERN EINEN ZUGRIFF AUF UNGESETZTE SPEICHERBEREICHE)
 
-	//ansonten noch die Bits, welche eventuell berechnet würden, aber über den boundarys liegen, 0 setzen
+	//ansonten noch die Bits, welche eventuell berechnet würden, aber über den boundarys liegen, 0 setzen - chunkweise per Maske
 	//LOW BOUND
-	ULONG l = myLowBound % nBitsInUlong;
-	ULONG wert;
-	ULONG i;
-	for(i = null; i < l ; i++)
-	{
-		wert = one << i;
-		result[null] -= ( (result[null] & wert) == wert) ? wert : null;
-	}
+	ULONG bits = myLowBound - myOffset;
+	ULONG x = null;
+	for(; bits >= nBitsInUlong && x < allocSize; bits -= nBitsInUlong)
+		result[x++] = null;
+
+	if(x < allocSize)
+		result[x] &= fulllong << bits;
 
 	//HIGH BOUND
-	l = allocSize * nBitsInUlong;
-	thisAOffset = allocSize - 1;	//ich verwende thisAOffset einfach nochmal, weil die variable jetzt eh nicht mehr benutzt wird
-	for(i = myHighBound ; i < l; i++)
-	{
-		wert = one << i;
-		result[thisAOffset] -= ( (result[thisAOffset] & wert) == wert) ? wert : null;
-	}
+	bits = myHighBound - myOffset;
+	x = bits / nBitsInUlong;
+	if(bits % nBitsInUlong && x < allocSize)
+		result[x++] &= ~(fulllong << bits % nBitsInUlong);
+
+	for(; x < allocSize; x++)
+		result[x] = null;
 	
 	inResult.useThisData(result, myHighBound, myLowBound ,myOffset ,allocSize );
 
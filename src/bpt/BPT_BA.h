@@ -24,6 +24,10 @@
 #include <maya/MIntArray.h>
 #include <cstring>
 
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
 
 #include <MACROS.h>
 
@@ -104,6 +108,13 @@ public:
 	//SICHERE METHODEN:	Machen Rangecheck und BitCheck
 	void			getIntArray		(MIntArray& inResult) const;	//!< gibt intArray zurück mit indices, die im BA true waren
 
+	/** ruft f(index) fuer jeden gesetzten index zwischen lowBound und highBound auf - aufsteigend.
+		Springt per ctz von bit zu bit, so dass leere Chunks und Luecken nichts kosten und kein MIntArray aufgebaut werden muss.
+		f darf das BA selbst nicht veraendern.
+	*/
+	template <class F>
+	void			forEachSetBit	(F& f) const;
+
 	bool			findMatching	(MIntArray& operand, 
 									 MIntArray& emptyResult	);		//!< findet UEbereinstimmungen zu dem übergebenen IntArray (SICHER dank vollem rangeCheck)
 	
@@ -257,8 +268,117 @@ static const ULONG null;
 static const ULONG one;
 static const ULONG fulllong;
 
+
+//--------------------------
+//BIT HELFER
+//--------------------------
+
+ULONG				chunkMask(ULONG x) const;		//!< Maske der bits von chunk x, die zwischen lowBound und highBound liegen
+
+static unsigned		countBits(ULONG value);			//!< popcount
+static unsigned		lowestBit(ULONG value);			//!< index des untersten gesetzten bits - value darf nicht 0 sein
+static unsigned		highestBit(ULONG value);		//!< index des obersten gesetzten bits - value darf nicht 0 sein
+
 };
 
+
+//----------------------------------------------------------------------------------------------------
+inline ULONG	BPT_BA::chunkMask(ULONG x) const
+//----------------------------------------------------------------------------------------------------
+{
+	const ULONG begin = x * nBitsInUlong + offset;
+	const ULONG end = begin + nBitsInUlong;
+
+	ULONG mask = fulllong;
+
+	//nur die RandChunks sind betroffen - alle anderen bekommen die volle Maske
+	if(lowBound > begin)
+		mask = (lowBound >= end) ? null : mask & (fulllong << (lowBound - begin));
+
+	if(highBound < end)
+		mask = (highBound <= begin) ? null : mask & (fulllong >> (end - highBound));
+
+	return mask;
+}
+
+//----------------------------------------------------------------------------------------------------
+inline unsigned	BPT_BA::countBits(ULONG value)
+//----------------------------------------------------------------------------------------------------
+{
+#if defined(__GNUC__)
+	return (unsigned)__builtin_popcountl(value);
+#else
+	//kein popcnt befehl vorausgesetzt - zaehlt nur die gesetzten bits
+	unsigned count = 0;
+	for(; value; ++count)
+		value &= value - 1;
+
+	return count;
+#endif
+}
+
+//----------------------------------------------------------------------------------------------------
+inline unsigned	BPT_BA::lowestBit(ULONG value)
+//----------------------------------------------------------------------------------------------------
+{
+#if defined(__GNUC__)
+	return (unsigned)__builtin_ctzl(value);
+#elif defined(_MSC_VER)
+	unsigned long index;
+	_BitScanForward(&index, value);
+	return (unsigned)index;
+#else
+	unsigned index = 0;
+	for(; !(value & 1); value >>= 1)
+		++index;
+
+	return index;
+#endif
+}
+
+//----------------------------------------------------------------------------------------------------
+inline unsigned	BPT_BA::highestBit(ULONG value)
+//----------------------------------------------------------------------------------------------------
+{
+#if defined(__GNUC__)
+	return (unsigned)(sizeof(ULONG) * 8 - 1 - __builtin_clzl(value));
+#elif defined(_MSC_VER)
+	unsigned long index;
+	_BitScanReverse(&index, value);
+	return (unsigned)index;
+#else
+	unsigned index = 0;
+	while(value >>= 1)
+		++index;
+
+	return index;
+#endif
+}
+
+//----------------------------------------------------------------------------------------------------
+template <class F>
+void	BPT_BA::forEachSetBit(F& f) const
+//----------------------------------------------------------------------------------------------------
+{
+	for(ULONG x = null; x < numChunks; x++)
+	{
+		ULONG bits = array[x];
+
+		if(bits == null)
+			continue;
+
+		bits &= chunkMask(x);
+
+		const ULONG base = x * nBitsInUlong + offset;
+
+		while(bits)
+		{
+			f( base + lowestBit(bits) );
+			bits &= bits - one;		//unterstes bit loeschen
+		}
+	}
+}
+
 }
 
 #endif
@@ -17,8 +17,11 @@
  */
 
 #include "BPT_Helpers.h"
+#include "componentAlgorithms.h"
 #include "timer.h"
 
+#include <vector>
+
 
 
 BPT_Helpers::BPT_Helpers(void)
@@ -34,24 +37,19 @@ BPT_Helpers::~BPT_Helpers(void)
 void		BPT_Helpers::sortArray(MIntArray& array) const
 //---------------------------------------------------------
 {
-	int tmp;
-	int l = array.length();
-	
+	const UINT l = array.length();
 
-	//einmal von vorn durchlaufen
-	for(int i = 0; i < l; i++ )
-	{
-		for(int a = i+1;a<l;a++)
-		{
-			if(array[a] < array[i])
-			{
-				tmp = array[i];
-				array[i] = array[a];
-				array[a] = tmp;
-				//break;
-			}
-		}
-	}
+	if(l < 2)
+		return;
+
+	//radixSort arbeitet auf rohem Speicher - also einmal raus und wieder rein kopieren
+	std::vector<int> ids(l), scratch;
+	array.get(&ids[0]);
+
+	radixSort(&ids[0], l, scratch);
+
+	for(UINT i = 0; i < l; i++)
+		array[i] = ids[i];
 
 }
 
@@ -222,30 +220,33 @@ void		BPT_Helpers::arrayRemove(MIntArray& lhs,MIntArray& rhs, bool affectLhsOnly
 
 	if(leftL + rightL < 200 && !affectLhsOnly)
 
-	{//wenn maximal 10000 iterationen vonnoeten sind
+	{//gemeinsame Elemente aus beiden Arrays entfernen - die Reihenfolge bleibt erhalten
 
-		int i = 0;
-		int x = 0;
+		idHashSet lhsSet, rhsSet;
+		lhsSet.reserve(leftL);
+		rhsSet.reserve(rightL);
 
-		int ROffset,LOffset;
-		ROffset = 0;
-		LOffset = 0;
+		int i;
+		for(i = 0; i < leftL; i++)
+			lhsSet.insert(lhs[i]);
 
-		for(;i < leftL - LOffset; i++)
-		{
-			x = 0;
-			for(;x < rightL - ROffset; x++)
-			{
-				if(lhs[i] == rhs[x])
-				{
-					rhs.remove(x--);
-					lhs.remove(i--);
-					ROffset++;
-					LOffset++;
-					break;
-				}
-			}
-		}
+		for(i = 0; i < rightL; i++)
+			rhsSet.insert(rhs[i]);
+
+		//beide Arrays in einem Durchlauf zusammenschieben statt remove, das jedesmal den Rest kopiert
+		UINT r = 0;
+		for(i = 0; i < leftL; i++)
+			if( !rhsSet.contains(lhs[i]) )
+				lhs[r++] = lhs[i];
+
+		lhs.setLength(r);
+
+		r = 0;
+		for(i = 0; i < rightL; i++)
+			if( !lhsSet.contains(rhs[i]) )
+				rhs[r++] = rhs[i];
+
+		rhs.setLength(r);
 
 	}
 	else
@@ -333,23 +334,18 @@ MIntArray		 BPT_Helpers::pruneIntArray(MIntArray& orig,MIntArray& pruned)
 void			BPT_Helpers::pruneIntArray(MIntArray& orig)
 //-----------------------------------------------------------------
 {
-	
-	int l = orig.length();
-	int lOffset = 0;
-	int x;
+	//das erste Vorkommen bleibt stehen, die Reihenfolge aendert sich also nicht
+	const UINT l = orig.length();
 
-	for(int i = 0; i < l-lOffset; i++)
-	{
-		x = i + 1;
-		for(; x < l-lOffset;x++)
-		{
-			if(orig[i] == orig[x])
-			{
-				orig.remove(x--);	
-				lOffset++;
-			}
-		}
-	}
+	idHashSet seen;
+	seen.reserve(l);
+
+	UINT r = 0;
+	for(UINT i = 0; i < l; i++)
+		if( seen.insert(orig[i]) )
+			orig[r++] = orig[i];
+
+	orig.setLength(r);
 }
 
 
@@ -367,63 +363,29 @@ void		BPT_Helpers::memoryPrune(MIntArray& orig)
 void		BPT_Helpers::memoryPrune(MIntArray& orig, MIntArray& doppelte)
 //-----------------------------------------------------------------
 {
-	int l = orig.length();
-	int	biggest = 0;
-	int smallest = 166666666;
+	//sortieren und dann in einem Durchlauf doppelte aussortieren - braucht keinen Speicher in der Groesse des IndexBereichs
+	const UINT l = orig.length();
 
-//	wenns zu speicherintesiv wird, einfach noch den kleinsten Wert ermitteln
-//	und die ArrayGroesse auf [biggest - smallest] stellen.
-//	beim zuweisen der Werte = orig[i] - smallest
-//	beim wiedereintragen on orig.append(x + smallest)
+	if(l == 0)
+		return;
 
-//	groesstes und kleinstes element holen
-	int i;
-	for(i = 0; i < l; i++)
-	{
-		if(orig[i] > biggest)
-			biggest = orig[i];
-		
-		if(orig[i] < smallest)
-			smallest = orig[i];
-	}
-
-
-/*
-	i = 0;
-//	kleinstes Element holen
-	for(; i < l; i++)
-		if(orig[i] < smallest)
-			smallest = orig[i];
-*/
+	std::vector<int> ids(l), scratch;
+	orig.get(&ids[0]);
 
-//	MemArray eventuell zu normalem Feld machen
+	radixSort(&ids[0], l, scratch);
 
-	i = 0;
-	MIntArray* memArray = new MIntArray( ( (biggest + 1) - smallest +1) ,-1);
-
-	
-//	indices eintragen
-	for(;i < l; i++ )
+	UINT r = 1;
+	for(UINT i = 1; i < l; i++)
 	{
-		int myTmp = (*memArray)[orig[i] - smallest];
-
-		if(myTmp == -1)
-			(*memArray)[orig[i] - smallest] = orig[i];
+		if(ids[i] == ids[r-1])
+			doppelte.append(ids[i]);
 		else
-			doppelte.append(myTmp);
+			ids[r++] = ids[i];
 	}
 
-	i = 0;
-	l = memArray->length();
-
-	////cout<<l <<" == Länge memArray"<<endl;
-	orig.clear();
-//	nullen rausschmeissen
-	for(;i < l; i++)
-		if( (*memArray)[i] != -1)
-			orig.append( (*memArray)[i]);
-		
-	delete memArray;
+	orig.setLength(r);
+	for(UINT i = 0; i < r; i++)
+		orig[i] = ids[i];
 }
 
 
@@ -495,34 +457,32 @@ void		BPT_Helpers::memoryInvertSelection(MIntArray& lhs, int maxElement, MIntArr
 
 
 //-----------------------------------------------------------------
-MIntArray		BPT_Helpers::matchArray(MIntArray lhs,MIntArray rhs) const
+MIntArray		BPT_Helpers::matchArray(const MIntArray& lhs,const MIntArray& rhs) const
 //-----------------------------------------------------------------
 {
 	MIntArray match;
 
-	int leftL = lhs.length();
-	int rightL = rhs.length();
-	
-	//EFFIZIENZMODUS -> eventuell ist es für algos nicht okay, das automatisch gepruned und die reihenfolge verändert wird
-	if(leftL + rightL < 200)
-	{
+	const UINT leftL = lhs.length();
+	const UINT rightL = rhs.length();
 
-		int i = 0;
-		int x = 0;
+	//match enthaelt jede uebereinstimmung nur einmal, in der Reihenfolge von lhs
+	UINT i, x;
 
-		int ROffset;
-		ROffset = 0;
+	if(leftL + rightL <= 16)
+	{//bei den ueblichen FaceVtx Arrays ist direktes vergleichen billiger als jede Tabelle
 
-		for(;i < leftL; i++)
+		for(i = 0; i < leftL; i++)
 		{
-			x = 0;
-			for(;x < rightL - ROffset; x++)
+			for(x = 0; x < rightL; x++)
 			{
 				if(lhs[i] == rhs[x])
 				{
-					match.append(lhs[i]);
-					rhs.remove(x--);
-					ROffset++;
+					UINT m = 0;
+					for(; m < match.length() && match[m] != lhs[i]; m++);
+
+					if(m == match.length())
+						match.append(lhs[i]);
+
 					break;
 				}
 			}
@@ -530,28 +490,21 @@ MIntArray		BPT_Helpers::matchArray(MIntArray lhs,MIntArray rhs) const
 
 		return match;
 	}
-	else
-	{
 
-		BPT_BA memArray(lhs,true);	//auf diese Weise muss nur noch die obere Grenze herausgefunden werden
-		
-		
-		MIntArray match;
-		
-		if(rhs.length() < 500)
-		{//in diesem Fall einfach bitweise vergleichen
-			memArray.findMatching(rhs,match);
-		}
-		else
-		{//ansonsten ist es effizienter, ein eigenes Array für rhs aufbauen
-			BPT_BA rhsBA(rhs,true);
-			(memArray & rhsBA).getIntArray(match);
-		}
 
-		return match;
+	idHashSet rhsSet, matched;
+	rhsSet.reserve(rightL);
+
+	for(x = 0; x < rightL; x++)
+		rhsSet.insert(rhs[x]);
 
+	for(i = 0; i < leftL; i++)
+	{
+		if( rhsSet.contains(lhs[i]) && matched.insert(lhs[i]) )
+			match.append(lhs[i]);
 	}
-	
+
+	return match;
 }
 
 
@@ -82,8 +82,8 @@ void		invertArray(MIntArray& array, int lBound, int rBound);
 //SPEICHERLASTIGES
 //---------------------
 
-MIntArray	matchArray(	MIntArray lhs, 
-						MIntArray rhs) const;
+MIntArray	matchArray(	const MIntArray& lhs, 
+						const MIntArray& rhs) const;	//!< gemeinsame Elemente, jedes nur einmal, in der Reihenfolge von lhs
 
 MIntArray	memoryMatch(MIntArray lhs, 
 						MIntArray rhs);
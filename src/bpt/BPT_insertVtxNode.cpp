@@ -59,6 +59,8 @@ MObject BPT_InsertVtx::IVoutMesh;
 MObject BPT_InsertVtx::IVinMesh;
 MObject	BPT_InsertVtx::IVSlideLimited;
 
+resultArchive::attributes	BPT_InsertVtx::IVarchiveAttrs;
+
 STE_DECLARE_STATIC_PARAMETERS(BPT_InsertVtx,IV)
 
 // Unique Node TypeId
@@ -184,6 +186,10 @@ MStatus		BPT_InsertVtx::initialize()
 	FnFloatAttr.setInternal(true);
 
 
+	status = resultArchive::createAttributes(IVarchiveAttrs);
+	MCheckStatus(status, "AddAttrIVNode");
+
+
 
 	// Add attributes
 
@@ -220,6 +226,21 @@ MStatus		BPT_InsertVtx::initialize()
 	status = addAttribute(IVselVertIDs);
 	MCheckStatus(status, "AddAttrIVNode");
 
+	status = addAttribute(IVarchiveAttrs.enabled);
+	MCheckStatus(status, "AddAttrIVNode");
+
+	status = addAttribute(IVarchiveAttrs.key);
+	MCheckStatus(status, "AddAttrIVNode");
+
+	status = addAttribute(IVarchiveAttrs.mesh);
+	MCheckStatus(status, "AddAttrIVNode");
+
+	status = addAttribute(IVarchiveAttrs.ints);
+	MCheckStatus(status, "AddAttrIVNode");
+
+	status = addAttribute(IVarchiveAttrs.doubles);
+	MCheckStatus(status, "AddAttrIVNode");
+
 
 
 	status = addAttribute(IVoutMesh);
@@ -258,6 +279,9 @@ MStatus		BPT_InsertVtx::initialize()
 	status = attributeAffects( IVnormal, IVoutMesh);
 	MCheckStatus(status, "AddAttrAffectsIVNode");
 
+	status = attributeAffects( IVarchiveAttrs.enabled, IVoutMesh);
+	MCheckStatus(status, "AddAttrAffectsIVNode");
+
 
 
 	// Zuletzt die SoftTransformationAttribute hinzufuegen
@@ -353,6 +377,10 @@ bool	BPT_InsertVtx::setInternalValue ( const MPlug & plug, const MDataHandle & d
 
 	if(plug==IVinMesh)
 		meshDirty = true; 
+
+	//einmal komplett neu berechnen, damit das Ergebnis gespeichert oder das gespeicherte verworfen wird
+	if(plug == IVarchiveAttrs.enabled)
+		meshDirty = true;
 	
 	return MPxNode::setInternalValue (plug, dataHandle);
 }
@@ -669,6 +697,90 @@ MStatus		BPT_InsertVtx::doCompleteCompute( MDataBlock& data )
 
 
 
+//----------------------------------------------------------------------------
+contentHash		BPT_InsertVtx::createArchiveKey( MDataBlock& data )
+//----------------------------------------------------------------------------
+{
+	MFnIntArrayData		intDataArray;
+
+	intDataArray.setObject(data.inputValue(IVselEdgeIDs).data());
+	MIntArray edgeIDs(intDataArray.array());
+
+	intDataArray.setObject(data.inputValue(IVselVertIDs).data());
+	MIntArray vertIDs(intDataArray.array());
+
+	intDataArray.setObject(data.inputValue(IVoptions).data());
+	MIntArray optionsArray(intDataArray.array());
+
+	MObject inMesh = data.inputValue(IVinMesh).asMesh();
+
+	// Faces gibt es hier nicht - an die Stelle des Modus tritt der count
+	contentHash key = topologyCache::createKey(	inMesh,
+												vertIDs,
+												edgeIDs,
+												MIntArray(),
+												optionsArray,
+												data.inputValue(IVcount).asInt() );
+
+	key.add( data.inputValue(IVspin).asInt() );
+
+	return resultArchive::createKey(key, inMesh);
+}
+
+
+//----------------------------------------------------------------------------
+MStatus		BPT_InsertVtx::doArchivedCompute( MDataBlock& data, const contentHash& archiveKey )
+//----------------------------------------------------------------------------
+{
+	MStatus status;
+
+	MObject		newOutMesh;
+	slideData	slides;
+
+	status = resultArchive::restore(data, IVarchiveAttrs, archiveKey, newOutMesh, slides);
+	if( !status )
+		return status;
+
+
+	// Wie in doCompleteCompute - die STE braucht ihre Attribute und Pfade, der Slide count und Optionen
+	softTransformationEngine::gatherAttributeObjects(thisMObject());
+	softTransformationEngine::saveMeshPathes();
+
+	fIVfty.setMeshPath(meshPath);
+
+	fIVfty.setCount(data.inputValue(IVcount).asInt());
+	fIVfty.setSpin(data.inputValue(IVspin).asInt());
+
+	MFnIntArrayData	intDataArray(data.inputValue(IVoptions).data());
+	fIVfty.setOptions(intDataArray.array());
+
+	fIVfty.setSlideData(slides);
+
+
+	// Die vertexList der STE wurde mit der Szene gespeichert und passt zum Ergebnis
+	data.outputValue(IVoutMesh).set(newOutMesh);
+
+	return status;
+}
+
+
+//----------------------------------------------------------------------------
+void		BPT_InsertVtx::archiveResult( MDataBlock& data, const contentHash& archiveKey )
+//----------------------------------------------------------------------------
+{
+	if( !resultArchive::isEnabled(data, IVarchiveAttrs) )
+	{
+		resultArchive::clear(data, IVarchiveAttrs);
+		return;
+	}
+
+	slideData slides;
+	fIVfty.getSlideData(slides);
+
+	resultArchive::store(data, IVarchiveAttrs, archiveKey, data.outputValue(IVoutMesh).asMesh(), slides);
+}
+
+
 //----------------------------------------------------------------------------
 MStatus		BPT_InsertVtx::compute(const MPlug& plug, MDataBlock& data)
 //----------------------------------------------------------------------------
@@ -697,9 +809,28 @@ MStatus		BPT_InsertVtx::compute(const MPlug& plug, MDataBlock& data)
 
 				if(meshDirty)
 				{
-					MPRINT("COMPLETE COMPUTE!!!!!!!!!!!!!!!!!!!!!!!!!!!")
+					// Nach dem Laden der Szene ist das Ergebnis eventuell schon gespeichert - der Schluessel hasht das
+					// ganze inMesh und wird deshalb nur gebaut, wenn storeResult an ist
+					const bool useArchive = resultArchive::isEnabled(data, IVarchiveAttrs);
+
+					contentHash archiveKey;
+					if( useArchive )
+						archiveKey = createArchiveKey(data);
+
+					if( useArchive && doArchivedCompute(data, archiveKey) == MS::kSuccess )
+					{
+						MPRINT("GESPEICHERTES ERGEBNIS VERWENDET")
+						status = MS::kSuccess;
+					}
+					else
+					{
+						MPRINT("COMPLETE COMPUTE!!!!!!!!!!!!!!!!!!!!!!!!!!!")
 
-					status = doCompleteCompute(data);
+						status = doCompleteCompute(data);
+
+						if(status == MS::kSuccess)
+							archiveResult(data, archiveKey);
+					}
 
 					INVIS(cout<<"MeshDirty ist "<<meshDirty<<endl;)
 						meshDirty = false;
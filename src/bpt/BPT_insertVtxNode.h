@@ -31,6 +31,8 @@
 #include "IVfty.h"
 #include "componentConverter.h"
 #include "BPT_Helpers.h"
+#include "topologyCache.h"
+#include "resultArchive.h"
 
 // General Includes
 //
@@ -116,6 +118,16 @@ private:
 
 	MStatus doCompleteCompute( MDataBlock& data );
 
+	//! Schluessel fuer das resultArchive - inMesh samt Punkten, Auswahl, Optionen, count und spin
+	contentHash	createArchiveKey( MDataBlock& data );
+
+	//! Verwendet das mit der Szene gespeicherte Ergebnis, wenn es zu den Eingaben passt
+	MStatus doArchivedCompute( MDataBlock& data, const contentHash& archiveKey );
+
+	//! Speichert das Ergebnis der kompletten Berechnung - oder leert das Archiv, wenn storeResult aus ist.
+	//! archiveKey wird nur gelesen, wenn storeResult an ist
+	void	archiveResult( MDataBlock& data, const contentHash& archiveKey );
+
 public:
 
 	// There needs to be a MObject handle declared for each attribute that
@@ -161,6 +173,8 @@ public:
 
 	static	MObject		IVinMesh;
 	static	MObject		IVoutMesh;
+
+	static	resultArchive::attributes	IVarchiveAttrs;	//!< gespeichertes Ergebnis, damit beim Laden nicht neu berechnet werden muss
 	
 
 	STE_DEFINE_STATIC_PARAMETERS(IV);
@@ -3534,67 +3534,36 @@ void	BPTfty::doSlide(bool tweakEnabled)
 			createAbsoluteVectors(*slideDirections, *slideScale);
 	}
 
-	//checken, welche seite gewünscht ist
+	// Modus einmal aufloesen - die Seite bestimmt Basispunkt und Vorzeichen, absolut wird zusaetzlich mit slideScale skaliert
+	const bool			fromStart = options[3] != 0;
+	const MPointArray&	bases = fromStart ? *slideStartPoints : *slideEndPoints;
+	const double		sign = fromStart ? 1.0 : -1.0;
+	const MDoubleArray*	scale = isRelative ? 0 : slideScale;
+
+	slideEval.resize(l, 2);
+
 	for(int i = 0; i < l; i++)
 	{
-		
 		if((*maySlide)[i])
 		{
-			if(isRelative)
-			{
-				
-				if(options[3])
-				{
-					if(isNormalRelative)
-						FnMesh.setPoint((*slideIndices)[i],(*slideStartPoints)[i] + (slide * (*slideDirections)[i]) + (normal * (*slideNormals)[i] * maxStandardScale ));
-					else
-						FnMesh.setPoint((*slideIndices)[i],(*slideStartPoints)[i] + (slide * (*slideDirections)[i]) + ( (normal * (*normalScale)[i]) * (*slideNormals)[i] ));
-				}
-				else
-				{
-					if(isNormalRelative)
-						FnMesh.setPoint((*slideIndices)[i],(*slideEndPoints)[i] + -1 * slide * (*slideDirections)[i] + (normal * (*slideNormals)[i] * maxStandardScale));
-					else
-						FnMesh.setPoint((*slideIndices)[i],(*slideEndPoints)[i] + -1 * slide * (*slideDirections)[i] + ( (normal * (*normalScale)[i]) * (*slideNormals)[i] ));
-				}
-			}
-			else
-			{
-
-				
-				////cout<<"Bin nach CREATEABSOLUTE VECTORS"<<endl;
-				if(options[3])
-				{
-					if(isNormalRelative)
-						FnMesh.setPoint((*slideIndices)[i],(*slideStartPoints)[i] + (slide * (*slideScale)[i])* (*slideDirections)[i] + ( normal  * (*slideNormals)[i] * maxStandardScale) );
-					else
-						FnMesh.setPoint((*slideIndices)[i],(*slideStartPoints)[i] + (slide * (*slideScale)[i])* (*slideDirections)[i] + ( (normal * (*normalScale)[i]) * (*slideNormals)[i]) );
-				}
-				else
-				{
-					if(isNormalRelative)
-						FnMesh.setPoint((*slideIndices)[i],(*slideEndPoints)[i] + (-1 * slide * (*slideScale)[i])* (*slideDirections)[i] + ( normal * (*slideNormals)[i] * maxStandardScale) );
-					else
-						FnMesh.setPoint((*slideIndices)[i],(*slideEndPoints)[i] + (-1 * slide * (*slideScale)[i])* (*slideDirections)[i] + ( (normal * (*normalScale)[i]) * (*slideNormals)[i]) );
-				}	
-			}
-			
-			
+			slideEval.setBase(i, (*slideIndices)[i], bases[i]);
+			slideEval.setTerm(0, i, (*slideDirections)[i], slideKernel::kSlide, scale ? sign * (*scale)[i] : sign);
 		}
 		else
-		{
-			if(isNormalRelative)
-			{
-				FnMesh.setPoint((*slideIndices)[i],(*slideStartPoints)[i] + (normal * (*slideNormals)[i] * maxStandardScale) );
-			}
-			else
-			{
-				FnMesh.setPoint((*slideIndices)[i],(*slideStartPoints)[i] + (normal * (*normalScale)[i] *(*slideNormals)[i]) );
-			}
-		}
+			slideEval.setBase(i, (*slideIndices)[i], (*slideStartPoints)[i]);
+
+		slideEval.setTerm(1, i, (*slideNormals)[i], slideKernel::kNormal, isNormalRelative ? maxStandardScale : (*normalScale)[i]);
 	}
 
 
+	double	factors[slideKernel::kNumFactors] = { 0.0 };
+	factors[slideKernel::kOne] = 1.0;
+	factors[slideKernel::kSlide] = slide;
+	factors[slideKernel::kNormal] = normal;
+
+	slideEval.apply(FnMesh, factors);
+
+
 	if( !tweakEnabled )	//nur wenn keine Tweaks vorhanden sind dürfen die UVs verändert werden, weil es ansonsten zu ungewollten verzerrungen kommen kann
 		doUVSlide();
 	
@@ -3605,6 +3574,100 @@ void	BPTfty::doSlide(bool tweakEnabled)
 	
 }
 
+//-----------------------------------------------------------------
+void	BPTfty::offsetSlidePoints(const MVectorArray& vtxOffsets)
+//-----------------------------------------------------------------
+{
+	if(slideIndices == 0)
+		return;
+
+	//die Richtungen bleiben, da Start und Ende um denselben Vektor verschoben werden
+	const unsigned l = slideIndices->length();
+	for(unsigned i = 0; i < l; i++)
+	{
+		const MVector& offset = vtxOffsets[ (*slideIndices)[i] ];
+
+		(*slideStartPoints)[i] += offset;
+		(*slideEndPoints)[i] += offset;
+	}
+}
+
+//-----------------------------------------------------------------
+void	BPTfty::getSlideData(slideData& data) const
+//-----------------------------------------------------------------
+{
+	data = slideData();
+
+	if(slideIndices == 0)
+		return;
+
+	data.indices = *slideIndices;
+	data.maySlide = *maySlide;
+	data.startPoints = *slideStartPoints;
+	data.endPoints = *slideEndPoints;
+	data.directions = *slideDirections;
+	data.normals = *slideNormals;
+	data.scale = *slideScale;
+	data.normalScale = *normalScale;
+
+	//doUVSlide arbeitet ohnehin nur auf dem ersten UVSet
+	data.hasUVs = UVSlideIndices != 0 && !UVSlideIndices->empty();
+	if(data.hasUVs)
+	{
+		data.UVIndices = UVSlideIndices->front();
+		data.UVStart = UVSlideStart->front();
+		data.UVEnd = UVSlideEnd->front();
+		data.UVDirections = UVSlideDirections->front();
+	}
+}
+
+//-----------------------------------------------------------------
+void	BPTfty::setSlideData(const slideData& data)
+//-----------------------------------------------------------------
+{
+	//wie im Destruktor - die Arrays gehoeren der fty
+	if(slideDirections != 0)
+	{
+		delete normalScale;
+		delete slideScale;
+		delete slideDirections;
+		delete slideNormals;
+		delete slideStartPoints;
+		delete slideEndPoints;
+		delete slideIndices;
+		delete maySlide;
+	}
+
+	normalScale = new MDoubleArray(data.normalScale);
+	slideScale = new MDoubleArray(data.scale);
+	slideDirections = new MVectorArray(data.directions);
+	slideNormals = new MVectorArray(data.normals);
+	slideStartPoints = new MPointArray(data.startPoints);
+	slideEndPoints = new MPointArray(data.endPoints);
+	slideIndices = new MIntArray(data.indices);
+	maySlide = new MIntArray(data.maySlide);
+
+
+	if(UVSlideStart != 0)
+	{
+		delete UVSlideStart;
+		delete UVSlideEnd;
+		delete UVSlideIndices;
+		delete UVSlideDirections;
+		delete UVSlideScale;
+	}
+
+	//doUVSlide erwartet immer ein UVSet - ohne UVs ist es eben leer
+	UVSlideStart = new list<MFloatVectorArray>(1, data.UVStart);
+	UVSlideEnd = new list<MFloatVectorArray>(1, data.UVEnd);
+	UVSlideIndices = new list<MIntArray>(1, data.UVIndices);
+	UVSlideDirections = new list<MFloatVectorArray>(1, data.UVDirections);
+	UVSlideScale = new list<MFloatArray>(1);		//wird von doUVSlide bei Bedarf berechnet
+
+	//wird beim naechsten doSlide aus normalScale bestimmt
+	maxStandardScale = 1.0;
+}
+
 //--------------------------------------
 void BPTfty::doUVSlide()
 //--------------------------------------
@@ -3811,129 +3874,117 @@ void		BPTfty::doSlideSMC(bool tweakEnabled)
 
 
 
-	//checken, welche seite gewünscht ist
+	// Modus einmal aufloesen. Die Vektoren liegen immer auf denselben Plaetzen:
+	// 0 = slideDirection, 1 = slideDirection2, 2 = slideNormal, 3 = slideNormal2
+	const bool			fromStart = options[3] != 0;
+	const MPointArray&	starts = *slideStartPoints;
+	const MPointArray&	ends = *slideEndPoints;
+
+	slideEval.resize(l, 4);
+
 	for(int i = 0; i < l; i++)
 	{
-		
-		if((*maySlide)[i])
-		{
-			if(isRelative)
-			{
-				
-				if(options[3])
-				{
-					if(hasSecondDirection[i])
-					{
-						if(isNormalRelative)
-							
-							FnMesh.setPoint((*slideIndices)[i],(*slideEndPoints)[i] + -1 * ( (clampX(slide) * (*slideDirections)[i]) + clampY(slide)*slideDirections2[i] ) + normal * clampNormalX(slide) * maxStandardScale * (*slideNormals)[i] + normal * clampNormalY(slide) * maxStandardScale * slideNormals2[i]);
-						else
-							//FnMesh.setPoint((*slideIndices)[i],(*slideEndPoints)[i] + -1 * ( (clampX(slide) * (*slideDirections)[i]) + clampY(slide)*slideDirections2[i] ) + normal * clampNormalX(slide) * (*normalScale)[i] * (*slideNormals)[i] + normal * normalScale2[i] * clampNormalY(slide) * slideNormals2[i]);
-							FnMesh.setPoint((*slideIndices)[i],(*slideEndPoints)[i] + -1 * ( (clampY(slide) * (*slideDirections)[i]) + clampX(slide)*slideDirections2[i] ) + normal * clampNormalY(slide) * (*normalScale)[i] * (*slideNormals)[i] + normal * normalScale2[i] * clampNormalX(slide) * slideNormals2[i]);
-						
-					}
-					else
-					{
-						if(isNormalRelative)
-							FnMesh.setPoint((*slideIndices)[i],(*slideStartPoints)[i] + (slide * (*slideDirections)[i]) + (normal * maxStandardScale * (*slideNormals)[i] ));
-						else
-							FnMesh.setPoint((*slideIndices)[i],(*slideStartPoints)[i] + (slide * (*slideDirections)[i]) + ( (normal * (*normalScale)[i]) * (*slideNormals)[i] ));
-					}
-				
-				}
-				else
-				{
-					if(hasSecondDirection[i])
-					{
-						if(isNormalRelative)
-							FnMesh.setPoint((*slideIndices)[i],(*slideStartPoints)[i] + (clampX(slide) * (*slideDirections)[i]) + clampY(slide)*slideDirections2[i] + normal * clampNormalX(slide) * maxStandardScale * (*slideNormals)[i] + normal * clampNormalY(slide) * maxStandardScale * slideNormals2[i]);
-						else
-							FnMesh.setPoint((*slideIndices)[i],(*slideStartPoints)[i] + (clampX(slide) * (*slideDirections)[i]) + clampY(slide)*slideDirections2[i] + normal * (*normalScale)[i] * clampNormalX(slide) * (*slideNormals)[i] + normal * normalScale2[i] * clampNormalY(slide) * slideNormals2[i]);
-						
-					}
-					else
-					{
-						if(isNormalRelative)
-							FnMesh.setPoint((*slideIndices)[i],(*slideEndPoints)[i] + -1 * slide * (*slideDirections)[i] + (normal * (*slideNormals)[i] * maxStandardScale));
-						else
-							FnMesh.setPoint((*slideIndices)[i],(*slideEndPoints)[i] + -1 * slide * (*slideDirections)[i] + ( (normal * (*normalScale)[i]) * (*slideNormals)[i] ));
-					}
-				}
-			}
-			else
-			{
-				//sichergehen, dass auch schon ScaleWerte erzeugt wurden, wenn er hier ankommt 
+		const int		vtx = (*slideIndices)[i];
+		const double	nScale = isNormalRelative ? maxStandardScale : (*normalScale)[i];
 
+		if(!(*maySlide)[i])
+		{
+			slideEval.setBase(i, vtx, starts[i]);
+			slideEval.setTerm(2, i, (*slideNormals)[i], slideKernel::kNormal, nScale);
 
-				if(hasSecondDirection[i])
-				{
-
-					if((*slideScale)[0] == -1)
-						createAbsoluteVectors(*slideDirections,*slideScale);
+			continue;
+		}
 
 
-					if(slideScale2[0] == -1)
-						createAbsoluteVectors(slideDirections2,slideScale2);
+		if(isRelative)
+		{
+			if(hasSecondDirection[i])
+			{
+				const double nScale2 = isNormalRelative ? maxStandardScale : normalScale2[i];
 
+				if(fromStart)
+				{
+					slideEval.setBase(i, vtx, ends[i]);
 
-					if(options[3])
+					// Ohne normalRelative sind X und Y vertauscht - so war es schon immer, also bleibt es dabei
+					if(isNormalRelative)
 					{
-						if(isNormalRelative)
-							FnMesh.setPoint((*slideIndices)[i],(*slideStartPoints)[i] + slide * (*slideScale)[i]* (*slideDirections)[i] + ( normal  * (*slideNormals)[i] * maxStandardScale) );
-						else
-							FnMesh.setPoint((*slideIndices)[i],(*slideStartPoints)[i] + slide * (*slideScale)[i]* (*slideDirections)[i] + ( (normal * (*normalScale)[i]) * (*slideNormals)[i]) );
+						slideEval.setTerm(0, i, (*slideDirections)[i], slideKernel::kClampX, -1.0);
+						slideEval.setTerm(1, i, slideDirections2[i], slideKernel::kClampY, -1.0);
+						slideEval.setTerm(2, i, (*slideNormals)[i], slideKernel::kNormalClampX, nScale);
+						slideEval.setTerm(3, i, slideNormals2[i], slideKernel::kNormalClampY, nScale2);
 					}
 					else
 					{
-						if(isNormalRelative)
-							FnMesh.setPoint((*slideIndices)[i],(*slideEndPoints)[i] + (-1 * slide * slideScale2[i])* slideDirections2[i] + ( normal * (*slideNormals)[i] * maxStandardScale) );
-						else
-							FnMesh.setPoint((*slideIndices)[i],(*slideEndPoints)[i] + (-1 * slide * slideScale2[i])* slideDirections2[i] + ( (normal * normalScale2[i]) * slideNormals2[i]) );
+						slideEval.setTerm(0, i, (*slideDirections)[i], slideKernel::kClampY, -1.0);
+						slideEval.setTerm(1, i, slideDirections2[i], slideKernel::kClampX, -1.0);
+						slideEval.setTerm(2, i, (*slideNormals)[i], slideKernel::kNormalClampY, nScale);
+						slideEval.setTerm(3, i, slideNormals2[i], slideKernel::kNormalClampX, nScale2);
 					}
-					
-
-
 				}
 				else
 				{
-					
-					////cout<<"Bin nach CREATEABSOLUTE VECTORS"<<endl;
-
-					if((*slideScale)[0] == -1)
-						createAbsoluteVectors(*slideDirections,*slideScale);
-
-
-					if(options[3])
-					{
-						if(isNormalRelative)
-							FnMesh.setPoint((*slideIndices)[i],(*slideStartPoints)[i] + (slide * (*slideScale)[i])* (*slideDirections)[i] + ( normal  * (*slideNormals)[i] * maxStandardScale ) );
-						else
-							FnMesh.setPoint((*slideIndices)[i],(*slideStartPoints)[i] + (slide * (*slideScale)[i])* (*slideDirections)[i] + ( (normal * (*normalScale)[i]) * (*slideNormals)[i]) );
-					}
-					else
-					{
-						if(isNormalRelative)
-							FnMesh.setPoint((*slideIndices)[i],(*slideEndPoints)[i] + (-1 * slide * (*slideScale)[i])* (*slideDirections)[i] + ( normal * (*slideNormals)[i] * maxStandardScale) );
-						else
-							FnMesh.setPoint((*slideIndices)[i],(*slideEndPoints)[i] + (-1 * slide * (*slideScale)[i])* (*slideDirections)[i] + ( (normal * (*normalScale)[i]) * (*slideNormals)[i]) );
-					}
+					slideEval.setBase(i, vtx, starts[i]);
+					slideEval.setTerm(0, i, (*slideDirections)[i], slideKernel::kClampX, 1.0);
+					slideEval.setTerm(1, i, slideDirections2[i], slideKernel::kClampY, 1.0);
+					slideEval.setTerm(2, i, (*slideNormals)[i], slideKernel::kNormalClampX, nScale);
+					slideEval.setTerm(3, i, slideNormals2[i], slideKernel::kNormalClampY, nScale2);
 				}
 			}
-			
-			
+			else
+			{
+				slideEval.setBase(i, vtx, fromStart ? starts[i] : ends[i]);
+				slideEval.setTerm(0, i, (*slideDirections)[i], slideKernel::kSlide, fromStart ? 1.0 : -1.0);
+				slideEval.setTerm(2, i, (*slideNormals)[i], slideKernel::kNormal, nScale);
+			}
 		}
 		else
 		{
-			if(isNormalRelative)
+			//sichergehen, dass auch schon ScaleWerte erzeugt wurden, wenn er hier ankommt 
+			if((*slideScale)[0] == -1)
+				createAbsoluteVectors(*slideDirections,*slideScale);
+
+			if(hasSecondDirection[i] && slideScale2[0] == -1)
+				createAbsoluteVectors(slideDirections2,slideScale2);
+
+
+			if(fromStart)
+			{
+				slideEval.setBase(i, vtx, starts[i]);
+				slideEval.setTerm(0, i, (*slideDirections)[i], slideKernel::kSlide, (*slideScale)[i]);
+				slideEval.setTerm(2, i, (*slideNormals)[i], slideKernel::kNormal, nScale);
+			}
+			else if(hasSecondDirection[i])
 			{
-				FnMesh.setPoint((*slideIndices)[i],(*slideStartPoints)[i] + (normal * (*slideNormals)[i] * maxStandardScale) );
+				slideEval.setBase(i, vtx, ends[i]);
+				slideEval.setTerm(1, i, slideDirections2[i], slideKernel::kSlide, -slideScale2[i]);
+
+				if(isNormalRelative)
+					slideEval.setTerm(2, i, (*slideNormals)[i], slideKernel::kNormal, maxStandardScale);
+				else
+					slideEval.setTerm(3, i, slideNormals2[i], slideKernel::kNormal, normalScale2[i]);
 			}
 			else
 			{
-				FnMesh.setPoint((*slideIndices)[i],(*slideStartPoints)[i] + (normal * (*normalScale)[i] *(*slideNormals)[i]) );
+				slideEval.setBase(i, vtx, ends[i]);
+				slideEval.setTerm(0, i, (*slideDirections)[i], slideKernel::kSlide, -(*slideScale)[i]);
+				slideEval.setTerm(2, i, (*slideNormals)[i], slideKernel::kNormal, nScale);
 			}
 		}
 	}
+
+
+	double	factors[slideKernel::kNumFactors] = { 0.0 };
+	factors[slideKernel::kOne] = 1.0;
+	factors[slideKernel::kSlide] = slide;
+	factors[slideKernel::kNormal] = normal;
+	factors[slideKernel::kClampX] = clampX(slide);
+	factors[slideKernel::kClampY] = clampY(slide);
+	factors[slideKernel::kNormalClampX] = normal * clampNormalX(slide);
+	factors[slideKernel::kNormalClampY] = normal * clampNormalY(slide);
+
+	slideEval.apply(FnMesh, factors);
+
 	
 	//UVSlide wird immer gemacht, wenn tweak nicht aktiviert ist
 	if(!tweakEnabled)
@@ -4241,7 +4292,7 @@ bool	BPTfty::isDirConform(	const int index0,
 
 
 //----------------------------------------------------------------------------------------------------------
-void		BPTfty::initEdges(MIntArray& allEdges,MIntArray& edgeIDs,simpleLinkedList<edge>& edgePtrs, bool	createOrigVtxLOT)
+void		BPTfty::initEdges(MIntArray& allEdges,MIntArray& edgeIDs,simpleLinkedList<edge>& edgePtrs, edgeContext& context, bool	createOrigVtxLOT)
 //----------------------------------------------------------------------------------------------------------
 {
 		SPEED("KONVERTIERE MESH IN (BEVEL)");
@@ -4285,11 +4336,11 @@ void		BPTfty::initEdges(MIntArray& allEdges,MIntArray& edgeIDs,simpleLinkedList<
 
 				//erstmal edgeArrays loeschen, für den fall, dass vorher abgestürzt ist
 
-		edge::origVtxDoneBA.setLength(0);
+		context.origVtxDoneBA.setLength(0);
 
-		edge::endFacePtrs.clear();
+		context.endFacePtrs.clear();
 
-		edge::nSelEdgeDataArray.clear();
+		context.nSelEdgeDataArray.clear();
 		
 //		edge::vtxChangedBA.setLength(0);
 		
@@ -4346,7 +4397,7 @@ void		BPTfty::initEdges(MIntArray& allEdges,MIntArray& edgeIDs,simpleLinkedList<
 
 			
 			//jetzt die edgeVerts in BA setzen
-			edge::origVtxDoneBA.add(edgeVertices, 0,0);
+			context.origVtxDoneBA.add(edgeVertices, 0,0);
 	
 		}
 		else
@@ -4536,7 +4587,7 @@ void		BPTfty::initEdges(MIntArray& allEdges,MIntArray& edgeIDs,simpleLinkedList<
 								seVtx[0] = edgeIter.index(0);
 								seVtx[1] = edgeIter.index(1);
 								
-								edge* selEdgeTmp = new selEdge(matchEdges[0]);
+								edge* selEdgeTmp = context.selEdgePool.add( new (context.selEdgePool.allocate()) selEdge(context, matchEdges[0]) );
 								
 								edgePtrs.append(selEdgeTmp); 
 								
@@ -4589,11 +4640,6 @@ void		BPTfty::initEdges(MIntArray& allEdges,MIntArray& edgeIDs,simpleLinkedList<
 								MIntArray					localEdgeIDs;
 								simpleLinkedList<edge>		localEdgePtrs;	//kann in diesem Fall verwendet werden, da sie ihre einheiten nicht loescht, wenn sie selbst geloescht wird
 	
-								//Wegen UVs geht das nicht
-							//	MDoubleArray				arcRatios;		//sync zu localEdgeIDs/Ptrs, hält werte zwischen 0 und 1 (1 = parallel, 0 = orthogonal zu OriginalEdge)
-							//	MPoint						currentPoint = edge::creator->getVtxPoint(verts[i]);
-							//	MVector						currentDir = currentPoint - edge::creator->getVtxPoint(verts[1-i]);
-							//	currentDir.normalize();
 
 								int currentEdge ,lastEdge;
 								
@@ -4651,7 +4697,7 @@ void		BPTfty::initEdges(MIntArray& allEdges,MIntArray& edgeIDs,simpleLinkedList<
 										if(!ptrAvailable)
 										{
 											edgeIDs.append(currentEdge);
-											selPtr = new selEdge(currentEdge);
+											selPtr = context.selEdgePool.add( new (context.selEdgePool.allocate()) selEdge(context, currentEdge) );
 											edgePtrs.append(selPtr);
 											
 											int selVerts[2]; //(Faces sind schon in ceFaces)
@@ -4745,7 +4791,7 @@ void		BPTfty::initEdges(MIntArray& allEdges,MIntArray& edgeIDs,simpleLinkedList<
 									ceVerts[1] = edgeIter.index(1);
 									
 									//edgeIDs.append(currentEdge);
-									edge* nSelEdgeTmp = new nSelEdge(currentEdge);
+									edge* nSelEdgeTmp = context.nSelEdgePool.add( new (context.nSelEdgePool.allocate()) nSelEdge(context, currentEdge) );
 									//edgePtrs.append(nSelEdgeTmp);
 									
 									nSelEdgeTmp->setVtxIDs(ceVerts);
@@ -4755,7 +4801,7 @@ void		BPTfty::initEdges(MIntArray& allEdges,MIntArray& edgeIDs,simpleLinkedList<
 									
 									/*	//Dies darf nicht mehr gemacht werden, da bei der Erzeugung der UVs wiklich die nächstgelegene Edge verwendet werden muss
 									//jetzt die EdgeRatio ausrechnen (origEdge zu current unselEdge)
-									MVector thisDir = currentPoint - edge::creator->getVtxPoint( (ceVerts[0] == verts[i]) ? ceVerts[1] : ceVerts[0] );
+									MVector thisDir = currentPoint - context.creator->getVtxPoint( (ceVerts[0] == verts[i]) ? ceVerts[1] : ceVerts[0] );
 									thisDir.normalize();
 									arcRatios.append( fabs(currentDir * thisDir) );
 									*/									
@@ -4946,7 +4992,7 @@ void		BPTfty::initEdges(MIntArray& allEdges,MIntArray& edgeIDs,simpleLinkedList<
 							nSelVtx[1] = edgeIter.index(1);
 							
 							//nur noch de endEdges dürfen auf array
-							edge* thisEdge = new nSelEdge(matchEdges[0]);
+							edge* thisEdge = context.nSelEdgePool.add( new (context.nSelEdgePool.allocate()) nSelEdge(context, matchEdges[0]) );
 
 
 							//auch diese endEdges benoetigen isFlippedInfos
@@ -5009,7 +5055,7 @@ void		BPTfty::initEdges(MIntArray& allEdges,MIntArray& edgeIDs,simpleLinkedList<
 									refEdge = match[0];
 								
 								//neuen Ptr für refEdge erstellen
-								edge* refEdgePtr = new nSelEdge(refEdge);
+								edge* refEdgePtr = context.nSelEdgePool.add( new (context.nSelEdgePool.allocate()) nSelEdge(context, refEdge) );
 								
 								int refVtx[2]; MIntArray refFaces;
 								edgeIter.setIndex(refEdge,tmp);
@@ -5094,7 +5140,7 @@ void		BPTfty::initEdges(MIntArray& allEdges,MIntArray& edgeIDs,simpleLinkedList<
 				
 				edgeIDs.append(allEdgesZero);
 
-				thisEdge =  new selEdge(nFaces,allEdgesZero);
+				thisEdge =  context.selEdgePool.add( new (context.selEdgePool.allocate()) selEdge(context, nFaces,allEdgesZero) );
 				edgePtrs.append(thisEdge); 
 
 
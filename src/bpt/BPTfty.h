@@ -48,6 +48,8 @@
 #include "selEdge.h"
 #include "nSelEdge.h"
 #include "BPT_Helpers.h"
+#include "slideKernel.h"
+#include "resultArchive.h"
 // General Includes
 //
 #include <maya/MObject.h>
@@ -99,6 +101,15 @@ public:
 	void		doSlide(bool tweakEnabled);
 	
 	void		doSlideSMC(bool tweakEnabled);
+
+	//! verschiebt Start und Endpunkte jedes Slides um die Verschiebung seines Vertex - wenn sich nur die Punkte des inMesh geaendert haben
+	void		offsetSlidePoints(const MVectorArray& vtxOffsets);
+
+	//! kopiert die SlideArrays, damit die Node sie mit ihrem Ergebnis speichern kann
+	void		getSlideData(slideData& data) const;
+
+	//! ersetzt die SlideArrays durch gespeicherte - danach kann ohne doIt geslided werden
+	void		setSlideData(const slideData& data);
 	
 
 
@@ -165,6 +176,7 @@ private:
 	void			initEdges(	MIntArray&				allEdges,
 								MIntArray&				edgeIDs,
 								simpleLinkedList<edge>& edgePtrs,
+								edgeContext&			context,
 								bool					createOrigVtxLOT = false);
 
 	bool			isDirConform(	const int index0, 
@@ -480,6 +492,8 @@ private:
 	MVectorArray	slideNormals2;		//!< ist die 2.normalDirection, die fuer die SMC notwendig sein kann (bei edgeLines)
 	MIntArray		hasSecondDirection;	//!< bestimmt, ob slide ne 2. Direction hat oder nicht;
 
+	slideKernel		slideEval;			//!< aufgeloester slide - wird bei jedem doSlide neu befuellt, behaelt aber seinen Speicher
+
 
 
 //UVSLIDE ARRAYS
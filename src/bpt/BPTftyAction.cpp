@@ -224,6 +224,7 @@ MStatus BPTfty::doIt()//int slideInt)
 			
 		//	face*			facePtrs[500];
 			simpleLinkedList<face> facePtrs;
+			objectPool<face>		facePool;		//besitzt alle faces von facePtrs, gibt sie am Ende des Blocks frei
 			MIntArray		faceIDs;
 			faceIDs.setSizeIncrement( 50 );
 			
@@ -241,8 +242,7 @@ MStatus BPTfty::doIt()//int slideInt)
 		// ist synchron zu facePtr und enthält reguläre IDs
 				
 
-				//Creator aller faces initialisiern
-				face::creator = creator;
+				//Creator wird jedem face bei der Konstruktion mitgegeben
 				
 				//Nun das FaceNetwork aufbauen !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
 				MIntArray		faceVerts,nFaceVerts;
@@ -267,6 +267,9 @@ MStatus BPTfty::doIt()//int slideInt)
 
 				BPT_BA			tmpFaceIDs(polyIter.count());
 
+				//faceSlots[faceID] ist der Index des faces in facePtrs/faceIDs, oder -1 wenn es noch nicht erstellt wurde
+				std::vector<int>	faceSlots(polyIter.count(), -1);
+
 
 				
 				NEWSPEED("KONVERTIERUNG MESH SMARTSPLIT");
@@ -295,17 +298,9 @@ MStatus BPTfty::doIt()//int slideInt)
 						faceMatchWasZero = false;
 						//check, ob Face schon erstellt wurde
 						tmp = neighbors[0];
-						l = faceIDs.length();
-						
 						
-						for(int a = 0; a < l;a++)
-						{
-							if(tmp == faceIDs[a])
-							{
-								existingFacePtr = facePtrs[a];
-								break;
-							}
-						}
+						if(faceSlots[tmp] > -1)
+							existingFacePtr = facePtrs[faceSlots[tmp]];
 
 					//	INVIS(cout<<"CREATE_NETWORK: "<<"FacePtr existed"<<existingFacePtr<<endl;)
 						
@@ -370,7 +365,8 @@ MStatus BPTfty::doIt()//int slideInt)
 							if(!faceMatchWasZero && !alreadyDone)
 							{
 								neighbors.append(faceMatch[x]);
-								facePtrs.append(new face(nFaceVerts,faceMatch[x]) );
+								faceSlots[faceMatch[x]] = facePtrs.length();
+								facePtrs.append(facePool.add( new (facePool.allocate()) face(creator,nFaceVerts,faceMatch[x]) ) );
 								faceIDs.append(faceMatch[x]);
 								tmpFaceIDs.setBitTrue(faceMatch[x]);
 							}
@@ -442,14 +438,9 @@ MStatus BPTfty::doIt()//int slideInt)
 								else
 								{
 									//FaceID im ftyFaceArray finden und ptr in realnachbarn kopieren
-									for(unsigned int o = 0;o < faceIDs.length();o++)
-									{
-										if(nachbarFaces[z] == faceIDs[o] )
-										{
-											realNachbarn[z] = facePtrs[o];
-											break;
-										}
-									}
+									//negative Werte sind Offsets aus insertNachbarOffsets, keine IDs
+									if(nachbarFaces[z] >= 0 && faceSlots[nachbarFaces[z]] > -1)
+										realNachbarn[z] = facePtrs[faceSlots[nachbarFaces[z]]];
 								}
 							}
 							else
@@ -463,8 +454,9 @@ MStatus BPTfty::doIt()//int slideInt)
 						if(existingFacePtr == 0)
 						{
 
-								face* tmpPtr = new face(faceVerts,corners,nachbarFaces,neighbors[0]);
+								face* tmpPtr = facePool.add( new (facePool.allocate()) face(creator,faceVerts,corners,nachbarFaces,neighbors[0]) );
 
+								faceSlots[neighbors[0]] = facePtrs.length();
 								facePtrs.append(tmpPtr);
 								
 								
@@ -675,24 +667,17 @@ MStatus BPTfty::doIt()//int slideInt)
 															slide, 
 															meshPath
 																				);
-		edge::creator = edgeCreator;
+
+		//hält alles, was sich die edges dieser Operation teilen, und besitzt alle edges und ihre Daten
+		//- auch die nSelEdges, die nur als Nachbarn erreichbar sind
+		edgeContext context(edgeCreator);
 		
 		//*******************************************************
 		
 		
 		//Edges initialisieren
-		initEdges(allEdges,edgeIDs,edgePtrs, !isSC);
+		initEdges(allEdges,edgeIDs,edgePtrs,context, !isSC);
 		
-		//für alle Fälle
-		if(edge::MAINFaceDataPtrs.size() != 0)	
-			edge::MAINFaceDataPtrs.clear();	
-
-		if(edge::endFacePtrs.size() != 0)
-			edge::endFacePtrs.clear();
-
-		if(edge::nSelEdgeDataArray.size() != 0)
-			edge::nSelEdgeDataArray.clear();
-
 
 
 		int l = edgeIDs.length();
@@ -724,9 +709,7 @@ MStatus BPTfty::doIt()//int slideInt)
 		}
 
 
-		edge::maxLength = smallest ;	
-		
-		edgeFaceData::numUVSets = edgeCreator->numUVSets;
+		context.maxLength = smallest ;	
 
 		INVIS(cout<<"MAXIMALE VTX-ENTFERNUNG: "<<smallest<<endl;)
 
@@ -745,7 +728,7 @@ MStatus BPTfty::doIt()//int slideInt)
 			//um ganz einfach zu bestimmen, ob das Face an einem Vtx schon erstellt wurde, verwende ich BA auf der edge, welches eh bereits mit allen
 			//origVtx initialisiert wurde 
 			//es jetzt zuruecksetzen
-			edge::origVtxDoneBA.setAllFalse();
+			context.origVtxDoneBA.setAllFalse();
 			
 			//jetzt alle selEdges, die clean sind, dazu bewegen, ihre smallFaces zu erstellen, wenn noetig
 			for(i = 0; i < l; i++)
@@ -759,18 +742,14 @@ MStatus BPTfty::doIt()//int slideInt)
 			
 		}
 
-		//die Edges loeschen
-		for(i = 0; i < l;i++)
-		{
-			delete edgePtrs[i];
-		}
+		//die Edges gehoeren dem context - sie werden zusammen mit den Daten unten freigegeben
 
 		
 		//nun durch die FaceData gehen und diese OriginalFaces wiederherstellen und 
 		//dann alle Faces loeschen
 		
-		l = static_cast<int>(edge::MAINFaceDataPtrs.size());
-		std::list<edgeFaceData*>::iterator fIter = edge::MAINFaceDataPtrs.begin();
+		l = static_cast<int>(context.MAINFaceDataPtrs.size());
+		std::list<edgeFaceData*>::iterator fIter = context.MAINFaceDataPtrs.begin();
 
 //		edgeFaceData* fTmp;
 		for(i = 0; i < l; i++)
@@ -784,8 +763,8 @@ MStatus BPTfty::doIt()//int slideInt)
 		
 
 		//jetzt die nSelEdges wiederherstellen und loeschen, genauso wie ihre edgePtr
-		l = static_cast<int>(edge::nSelEdgeDataArray.size());
-		std::list<nSelEdgeData*>::iterator nIter = edge::nSelEdgeDataArray.begin();
+		l = static_cast<int>(context.nSelEdgeDataArray.size());
+		std::list<nSelEdgeData*>::iterator nIter = context.nSelEdgeDataArray.begin();
 
 		//BA mit anzahl der Faces erstellen - wird an changeFace übrgeben als LUT
 
@@ -807,20 +786,16 @@ MStatus BPTfty::doIt()//int slideInt)
 
 			edgeTmp->changeFace(dTmp->origID, dTmp->newID, dTmp->faceData, maxRec );
 
-			
-			delete dTmp;
-			delete edgeTmp;
-
 			nIter++;
 		}
 
 
 
-		edge::nSelEdgeDataArray.clear();
+		context.nSelEdgeDataArray.clear();
 	
 		//jetzt die endFaces erstellen
-		l = static_cast<int>(edge::endFacePtrs.size());
-		std::list<endFaceData*>::iterator eIter = edge::endFacePtrs.begin();
+		l = static_cast<int>(context.endFacePtrs.size());
+		std::list<endFaceData*>::iterator eIter = context.endFacePtrs.begin();
 		endFaceData* eTmp;	//tmpVariable
 
 		//hier benoetogt man 2 durchgänge: Im ersten werden alle nonConnectEnds faces ausgeführt
@@ -864,7 +839,7 @@ MStatus BPTfty::doIt()//int slideInt)
 
 
 		//jetzt im 2. durchlauf die eigentlichen prozeduren aufrufen, welche originalVtx wieder entfernen (wenn noetig
-		eIter = edge::endFacePtrs.begin();
+		eIter = context.endFacePtrs.begin();
 		for(i = 0; i < l; i++)
 		{
 			eTmp = *eIter;
@@ -904,23 +879,12 @@ MStatus BPTfty::doIt()//int slideInt)
 			}
 
 			eIter++;
-			delete eTmp;
 
 		}
 
 		
-		l = static_cast<int>(edge::MAINFaceDataPtrs.size());
-		fIter = edge::MAINFaceDataPtrs.begin();
-		for(i = 0; i < l; i++)
-		{
-			delete *fIter;
-			fIter++;
-		}
-		//Speicher für die Faces freimachen
-		edge::MAINFaceDataPtrs.clear();
-
-		//speicher für endFaces freimachen
-		edge::endFacePtrs.clear();
+		//Speicher für die Faces und endFaces freimachen - alle Objekte der Operation in einem Rutsch zerstoeren
+		context.clear();
 
 
 
@@ -972,7 +936,7 @@ MStatus BPTfty::doIt()//int slideInt)
 		
 		//alle statischen vaiablen säubern
 
-		edge::origVtxDoneBA.setLength(0);
+		context.origVtxDoneBA.setLength(0);
 
 //		edge::vtxChangedBA.setLength(0);
 
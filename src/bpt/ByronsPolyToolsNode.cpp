@@ -56,6 +56,8 @@ MObject	ByronsPolyToolsNode::BPToutMesh;
 
 MObject	ByronsPolyToolsNode::slideLimitedObj;
 
+resultArchive::attributes	ByronsPolyToolsNode::archiveAttrs;
+
 
 STE_DECLARE_STATIC_PARAMETERS(ByronsPolyToolsNode,BPT)
 
@@ -263,6 +265,8 @@ MStatus		ByronsPolyToolsNode::initialize()
 	FnFloatAttr.setKeyable(false);
 
 
+	status = resultArchive::createAttributes(archiveAttrs);
+	MCheckStatus(status, "AddAttrBPTNode");
 
 
 
@@ -307,6 +311,21 @@ MStatus		ByronsPolyToolsNode::initialize()
 	status = addAttribute(selFaceIDs);
 	MCheckStatus(status, "AddAttrBPTNode");
 
+	status = addAttribute(archiveAttrs.enabled);
+	MCheckStatus(status, "AddAttrBPTNode");
+
+	status = addAttribute(archiveAttrs.key);
+	MCheckStatus(status, "AddAttrBPTNode");
+
+	status = addAttribute(archiveAttrs.mesh);
+	MCheckStatus(status, "AddAttrBPTNode");
+
+	status = addAttribute(archiveAttrs.ints);
+	MCheckStatus(status, "AddAttrBPTNode");
+
+	status = addAttribute(archiveAttrs.doubles);
+	MCheckStatus(status, "AddAttrBPTNode");
+
 
 
 
@@ -330,6 +349,9 @@ MStatus		ByronsPolyToolsNode::initialize()
 		
 	status = attributeAffects( normal, BPToutMesh);
 	MCheckStatus(status, "AddAttrBPTNode");
+
+	status = attributeAffects( archiveAttrs.enabled, BPToutMesh);
+	MCheckStatus(status, "AddAttrBPTNode");
 		
 
 	// Zuletzt die SoftTransformationAttribute hinzufuegen
@@ -387,6 +409,12 @@ bool	ByronsPolyToolsNode::setInternalValue ( const MPlug & plug, const MDataHand
 	if(plug==BPTinMesh)
 		meshDirty = true; 
 
+	if(plug == archiveAttrs.enabled)
+	{//einmal komplett neu berechnen, damit das Ergebnis gespeichert oder das gespeicherte verworfen wird
+		meshDirty = true;
+		resultCache.clear();
+	}
+
 
 	// Sich jetzt um die STE internals kuemmern
 	//
@@ -826,6 +854,109 @@ MStatus ByronsPolyToolsNode::doCompleteCompute(MDataBlock& data)
 
 
 
+//----------------------------------------------------------------------------
+contentHash		ByronsPolyToolsNode::createTopologyKey(MDataBlock& data)
+//----------------------------------------------------------------------------
+{
+	MFnIntArrayData		intDataArray;
+
+	intDataArray.setObject(data.inputValue(selVertIDs).data());
+	MIntArray vertIDs(intDataArray.array());
+
+	intDataArray.setObject(data.inputValue(selEdgeIDs).data());
+	MIntArray edgeIDs(intDataArray.array());
+
+	intDataArray.setObject(data.inputValue(selFaceIDs).data());
+	MIntArray faceIDs(intDataArray.array());
+
+	intDataArray.setObject(data.inputValue(options).data());
+	MIntArray optionsArray(intDataArray.array());
+
+	return topologyCache::createKey(	data.inputValue(BPTinMesh).asMesh(),
+										vertIDs,
+										edgeIDs,
+										faceIDs,
+										optionsArray,
+										data.inputValue(mode).asInt() );
+}
+
+
+//----------------------------------------------------------------------------
+MStatus		ByronsPolyToolsNode::doInterpolatedCompute(MDataBlock& data)
+//----------------------------------------------------------------------------
+{
+	MStatus status;
+
+	MObject			newOutMesh;
+	MVectorArray	changes;
+
+	status = resultCache.apply(data.inputValue(BPTinMesh).asMesh(), newOutMesh, changes);
+	if( !status )
+		return status;
+
+	data.outputValue(BPToutMesh).set(newOutMesh);
+
+	// Topologie, Auswahl und SlideIndices sind dieselben wie bei der letzten kompletten Berechnung -
+	// nur die Punkte, von denen aus geslided wird, muessen mitwandern
+	fBPTfty.offsetSlidePoints(changes);
+
+	return status;
+}
+
+
+//----------------------------------------------------------------------------
+MStatus		ByronsPolyToolsNode::doArchivedCompute(MDataBlock& data, const contentHash& archiveKey)
+//----------------------------------------------------------------------------
+{
+	MStatus status;
+
+	MObject		newOutMesh;
+	slideData	slides;
+
+	status = resultArchive::restore(data, archiveAttrs, archiveKey, newOutMesh, slides);
+	if( !status )
+		return status;
+
+
+	// Wie in doCompleteCompute - die STE braucht ihre Attribute und Pfade, der Slide die Optionen
+	softTransformationEngine::gatherAttributeObjects(thisMObject());
+	softTransformationEngine::saveMeshPathes();
+
+	fBPTfty.setMeshPath(meshPath);
+
+	MFnIntArrayData	intDataArray(data.inputValue(options).data());
+	fBPTfty.setOptions(intDataArray.array());
+
+	fBPTfty.setActionMode(data.inputValue(mode).asInt());
+
+	fBPTfty.setSlideData(slides);
+
+
+	// Die vertexList der STE wurde mit der Szene gespeichert und passt zum Ergebnis
+	data.outputValue(BPToutMesh).set(newOutMesh);
+
+	return status;
+}
+
+
+//----------------------------------------------------------------------------
+void		ByronsPolyToolsNode::archiveResult(MDataBlock& data, const contentHash& archiveKey)
+//----------------------------------------------------------------------------
+{
+	// SMC aendert die Topologie nicht und slided mit weiteren Arrays - da lohnt das Speichern nicht
+	if( !resultArchive::isEnabled(data, archiveAttrs) || data.inputValue(mode).asInt() == 6 )
+	{
+		resultArchive::clear(data, archiveAttrs);
+		return;
+	}
+
+	slideData slides;
+	fBPTfty.getSlideData(slides);
+
+	resultArchive::store(data, archiveAttrs, archiveKey, data.outputValue(BPToutMesh).asMesh(), slides);
+}
+
+
 //----------------------------------------------------------------------------
 MStatus		ByronsPolyToolsNode::compute(const MPlug& plug, MDataBlock& data)
 //----------------------------------------------------------------------------
@@ -878,9 +1009,45 @@ MStatus		ByronsPolyToolsNode::compute(const MPlug& plug, MDataBlock& data)
 					
 				if(meshDirty)
 				{
-					MPRINT("COMPLETE COMPUTE!!!!!!!!!!!!!!!!!!!!!!!!!!!")
-					
-					status = doCompleteCompute(data);
+					// Haben sich am inMesh nur die Punkte geaendert, muss nicht neu geteilt werden
+					const contentHash key = createTopologyKey(data);
+
+					if( resultCache.matches(key) && doInterpolatedCompute(data) == MS::kSuccess )
+					{
+						MPRINT("NUR PUNKTE INTERPOLIERT")
+						status = MS::kSuccess;
+					}
+					else
+					{
+						// Nach dem Laden der Szene ist das Ergebnis eventuell schon gespeichert - der Schluessel hasht alle
+						// Punkte des inMesh und wird deshalb nur gebaut, wenn storeResult an ist
+						const bool useArchive = resultArchive::isEnabled(data, archiveAttrs);
+
+						contentHash archiveKey;
+						if( useArchive )
+							archiveKey = resultArchive::createKey(key, data.inputValue(BPTinMesh).asMesh());
+
+						if( useArchive && doArchivedCompute(data, archiveKey) == MS::kSuccess )
+						{
+							MPRINT("GESPEICHERTES ERGEBNIS VERWENDET")
+							status = MS::kSuccess;
+						}
+						else
+						{
+							MPRINT("COMPLETE COMPUTE!!!!!!!!!!!!!!!!!!!!!!!!!!!")
+
+							status = doCompleteCompute(data);
+
+							if(status == MS::kSuccess)
+								archiveResult(data, archiveKey);
+						}
+
+						// Das Ergebnis merken, bevor der Slide es veraendert
+						if(status == MS::kSuccess)
+							resultCache.store(key, data.inputValue(BPTinMesh).asMesh(), data.outputValue(BPToutMesh).asMesh());
+						else
+							resultCache.clear();
+					}
 					
 					INVIS(cout<<"MeshDirty ist "<<meshDirty<<endl;)
 					INVIS(cout<<"--------------------------------"<<endl;)
@@ -71,6 +71,8 @@
 #include <maya/MPlugArray.h>
 #include <iostream>
 #include <softTransformationEngine.h>
+#include <topologyCache.h>
+#include <resultArchive.h>
  
 
 
@@ -112,6 +114,19 @@ private:
 // ------------------
 	MStatus				doCompleteCompute(MDataBlock& data);
 
+	//! Verwendet das Ergebnis der letzten kompletten Berechnung, wenn sich am inMesh nur die Punkte geaendert haben
+	MStatus				doInterpolatedCompute(MDataBlock& data);
+
+	//! Schluessel fuer den resultCache - Topologie des inMesh, Auswahl, Optionen und Modus
+	contentHash			createTopologyKey(MDataBlock& data);
+
+	//! Verwendet das mit der Szene gespeicherte Ergebnis, wenn es zu den Eingaben passt
+	MStatus				doArchivedCompute(MDataBlock& data, const contentHash& archiveKey);
+
+	//! Speichert das Ergebnis der kompletten Berechnung im resultArchive - oder leert es, wenn storeResult aus ist.
+	//! archiveKey wird nur gelesen, wenn storeResult an ist
+	void				archiveResult(MDataBlock& data, const contentHash& archiveKey);
+
 
 // ------------------
 // OEFFENTLICHE ATTRIBUTE
@@ -145,6 +160,8 @@ public:
 
 	static	MObject		BPTinMesh;	//!<inMeshObj fuer BPTNode
 	static	MObject		BPToutMesh;	//!<inMeshObj fuer BPTNode
+
+	static	resultArchive::attributes	archiveAttrs;	//!< gespeichertes Ergebnis, damit beim Laden nicht neu berechnet werden muss
 	
 	STE_DEFINE_STATIC_PARAMETERS(BPT)
 
@@ -237,6 +254,8 @@ private:
 	BPT_Helpers			helper; 
 	BPTfty				fBPTfty;
 
+	topologyCache		resultCache;	//!< Ergebnis der letzten kompletten Berechnung, ohne Slide
+
 	MPlug				otherOutMeshPlug;
 
 	MDGModifier*		dgMod;
@@ -133,21 +133,21 @@ void IVMeshCreator::doInsertVtx( int edgeID,
 	slideScale->append(-1.0);
 
 	//slideIndices[x] ist immer der erste der neuen Vertizen, ich antizipiere das hier: der erste neue Vtx hat
-	//den Index von vtxPoints->length();
-	insertionID = vtxPoints->length() - 1;	//insertionID setzen, später für InsertVtx benoetigt
+	//den Index von getLastVtxID() + 1;
+	insertionID = getLastVtxID();	//insertionID setzen, später für InsertVtx benoetigt
 	slideIndices->append( insertionID + 1 );
 
 
 	//jetzt noch die SlideArrays aktualisieren
 	if(useSlide)
 	{//direction errechnen und start/End noch eintragen
-		startPoint = (*vtxPoints)[startVtxID];
+		startPoint = getVtxPoint(startVtxID);
 		slideStartPoints->append(startPoint);
 
-		slideEndPoints->append((*vtxPoints)[endVtxID]);
+		slideEndPoints->append(getVtxPoint(endVtxID));
 		
 		//direction definieren
-		direction = (*vtxPoints)[endVtxID] - (*vtxPoints)[startVtxID];
+		direction = getVtxPoint(endVtxID) - startPoint;
 		slideDirections->append(direction);
 
 
@@ -159,10 +159,10 @@ void IVMeshCreator::doInsertVtx( int edgeID,
 		//man kann hier einfach start/endVtxID Variablen verwenden, da sie glech am anfang mit gültigen werten
 		//beschrieben wurden
 
-		startPoint = (*vtxPoints)[ startVtxID ];
+		startPoint = getVtxPoint( startVtxID );
 		slideStartPoints->append(startPoint);
 
-		direction = (*vtxPoints)[ endVtxID] - (*vtxPoints)[startVtxID];
+		direction = getVtxPoint( endVtxID) - startPoint;
 		slideDirections->append( direction );
 		
 		slideEndPoints->append(MPoint());
@@ -196,18 +196,14 @@ void IVMeshCreator::doInsertVtx( int edgeID,
 	//einfügen der neuen Vertizen:
 	for( i = 0; i < splitCount; i++)
 	{
-		vtxPoints->append(startPoint + (r++ * factor) * mySlide * direction);
+		newVtx(startPoint + (r++ * factor) * mySlide * direction);
 	}
 
 	//DIE NEUEN INDICES IN FACEVERTICES EINFUEGEN UND DIE MESHDATEN DAMIT AKTUALISIEREN
 	/////////////////////////////////////////////////////////////////////////////////////////
 
 	//jetzt die angrenzenden Faces aktualisieren
-	UINT		x,y,l2 = vtxPoints->length();			//für iteration, l2 wird später gebraucht
-
-	
-	UINT		offset;			//offset als startMarkierung für faceVtxIDs
-	UINT		length;			//zum einfügen der Vertizen in faceVtxIDs
+	UINT		x,y,l2 = getLastVtxID() + 1;			//für iteration, l2 wird später gebraucht
 
 	for(i = 0; i < connectedFaces.length();i++)
 	{//merke: FaceVertices wurden bereits geholt
@@ -247,21 +243,7 @@ void IVMeshCreator::doInsertVtx( int edgeID,
 
 
 				//meshDaten aktualisieren
-				offset = getValidAbsoluteOffset(connectedFaces[i]);
-				length = offset + vertices[i].length();
-
-				//zuerst faceVtxArray erweitern
-				for(y = 0; y < splitCount; y++)
-					faceVtxIDs->insert(-1,offset);
-
-				//jetzt das verticesArray übertragen
-				UINT r = 0;
-				for(y = offset; y < length; y++)
-					(*faceVtxIDs)[y] = vertices[i][r++];
-
-				//offsetsLUT updaten
-				updateOffsetLUT(connectedFaces[i], splitCount);
-				(*offsets)[ connectedFaces[i] ] += splitCount;
+				changePolyVtxIDs(connectedFaces[i], vertices[i]);
 
 				break;
 
@@ -293,15 +275,13 @@ void IVMeshCreator::generateUVs(MIntArray& connectedFaces,
 	UINT		x,i,l;				//für iterationen
 	int		minMaxIDs[2];	//hält die MinMaxIDs der neu erstellten UVs
 
-	std::list<MIntArray>::iterator iterCounts			= UVCounts->begin();
-	std::list<MIntArray>::iterator iterOffset			= UVAbsOffsets->begin();
-	std::list<MIntArray>::iterator iterLUT				= UVoffsetsLUT->begin();
-	std::list<MIntArray>::iterator iterLUTValues		= UVoffsetsLUTValues->begin();
-	std::list<MIntArray>::iterator iterUVperVtx			= UVperVtx->begin();
+	UVIndexSets::iterator iterCounts			= UVCounts.begin();
+	UVIndexSets::iterator iterOffset			= UVAbsOffsets.begin();
+	UVIndexSets::iterator iterUVperVtx			= UVperVtx.begin();
 
 	
-	std::list<MFloatArray>::iterator iterUPos			= Us->begin();
-	std::list<MFloatArray>::iterator iterVPos			= Vs->begin();
+	UVPositionSets::iterator iterUPos			= Us.begin();
+	UVPositionSets::iterator iterVPos			= Vs.begin();
 
 
 	std::list<MIntArray>::iterator iterSlideIDs			= UVSlideIndices->begin();
@@ -349,8 +329,6 @@ void IVMeshCreator::generateUVs(MIntArray& connectedFaces,
 						faceUVs[0],
 						x,
 						iterOffset,
-						iterLUT,
-						iterLUTValues,
 						iterCounts,
 						iterUVperVtx );
 
@@ -386,8 +364,6 @@ void IVMeshCreator::generateUVs(MIntArray& connectedFaces,
 							faceUVs[1],
 							x,
 							iterOffset,
-							iterLUT,
-							iterLUTValues,
 							iterCounts,
 							iterUVperVtx );
 
@@ -434,8 +410,6 @@ void IVMeshCreator::generateUVs(MIntArray& connectedFaces,
 								minMaxIDs[1],
 								&iterCounts,
 								&iterOffset,
-								&iterLUT,
-								&iterLUTValues,
 								&iterUVperVtx );
 
 			}//if(connectedFaces.length() == 2 && counts[connectedFaces[1] != 0)
@@ -451,8 +425,6 @@ void IVMeshCreator::generateUVs(MIntArray& connectedFaces,
 							minMaxIDs[0],
 							&iterCounts,
 							&iterOffset,
-							&iterLUT,
-							&iterLUTValues,
 							&iterUVperVtx );
 
 		
@@ -463,8 +435,6 @@ void IVMeshCreator::generateUVs(MIntArray& connectedFaces,
 							faceUVs[1],
 							x,
 							iterOffset,
-							iterLUT,
-							iterLUTValues,
 							iterCounts,
 							iterUVperVtx );
 
@@ -504,8 +474,6 @@ void IVMeshCreator::generateUVs(MIntArray& connectedFaces,
 							minMaxIDs[1],
 							&iterCounts,
 							&iterOffset,
-							&iterLUT,
-							&iterLUTValues,
 							&iterUVperVtx );
 
 		}
@@ -514,8 +482,6 @@ void IVMeshCreator::generateUVs(MIntArray& connectedFaces,
 		++iterVPos;
 		++iterCounts;
 		++iterOffset;
-		++iterLUT;
-		++iterLUTValues;
 		++iterUVperVtx;
 
 		++iterSlideIDs;
@@ -604,11 +570,9 @@ void	IVMeshCreator::updateUVArrays(  int faceID,
 										int endLocID,
 										int index,
 										int	 minIndex,	
-										std::list<MIntArray>::iterator* iterCounts,
-										std::list<MIntArray>::iterator* iterOffset,
-										std::list<MIntArray>::iterator* iterLUT,
-										std::list<MIntArray>::iterator* iterLUTValues,
-										std::list<MIntArray>::iterator* iterUVperVtx	
+										UVIndexSets::iterator* iterCounts,
+										UVIndexSets::iterator* iterOffset,
+										UVIndexSets::iterator* iterUVperVtx	
 																						)
 //----------------------------------------------------------------------------------------------------------
 {
@@ -620,9 +584,7 @@ void	IVMeshCreator::updateUVArrays(  int faceID,
 	//erstmal gültiges offset ins UVPerVtxArray holen
 	int offset = getValidAbsoluteUVOffset(	faceID,
 											index,
-											*iterOffset,
-											*iterLUT,
-											*iterLUTValues );
+											*iterOffset );
 
 	//die neuen UVs werden direkt in das grosse UVperVtxArray eingefügt
 
@@ -661,7 +623,7 @@ void	IVMeshCreator::updateUVArrays(  int faceID,
 
 	//gut, jetzt noch die UVArrays updaten
 
-	updateOffsetUVLUT(faceID, splitCount,index,*iterLUT,*iterLUTValues);
+	updateOffsetUVLUT(faceID, splitCount,index);
 	(*(*iterCounts))[faceID] += splitCount;
 
 	
@@ -702,7 +664,7 @@ void IVMeshCreator::generateNormals(	MIntArray&	connectedFaces,
 		 //zwischen diese vorhandenen edges einfügen (direkt in normalVertexIndices)
 			
 
-			int minIndex = vtxPoints->length();
+			int minIndex = getLastVtxID() + 1;
 
 			//erst Kante definieren zwischen start und erstem neuen Vertex - Anfangpositions wird definert durch logIndex
 			//normalVertexIndices.insert(minIndex,++offset);
@@ -103,11 +103,9 @@ private:
 							int  endLocID,
 							int  index,					
 							int	 minIndex,				
-							std::list<MIntArray>::iterator* iterCounts,
-							std::list<MIntArray>::iterator* iterOffset,
-							std::list<MIntArray>::iterator* iterLUT,
-							std::list<MIntArray>::iterator* iterLUTValues,
-							std::list<MIntArray>::iterator* iterUVperVtx	
+							UVIndexSets::iterator* iterCounts,
+							UVIndexSets::iterator* iterOffset,
+							UVIndexSets::iterator* iterUVperVtx	
 																				);
 
 
@@ -134,6 +134,60 @@ void	IVfty::cleanUp()
 	}
 }
 
+//-------------------------------------------------------
+void	IVfty::getSlideData(slideData& data) const
+//-------------------------------------------------------
+{
+	data = slideData();
+
+	if(slideIndices == 0)
+		return;
+
+	data.indices = *slideIndices;	//inklusive des Dummy Eintrags am Ende
+	data.maySlide = *maySlide;
+	data.startPoints = *slideStartPoints;
+	data.endPoints = *slideEndPoints;
+	data.directions = *slideDirections;
+	data.normals = *slideNormals;
+	data.scale = *slideScale;
+	data.normalScale = *normalScale;
+
+	//doUVSlide arbeitet ohnehin nur auf dem ersten UVSet
+	data.hasUVs = UVSlideIndices != 0 && !UVSlideIndices->empty();
+	if(data.hasUVs)
+	{
+		data.UVIndices = UVSlideIndices->front();
+		data.UVStart = UVSlideStart->front();
+		data.UVEnd = UVSlideEnd->front();
+		data.UVDirections = UVSlideDirections->front();
+	}
+}
+
+//-------------------------------------------------------
+void	IVfty::setSlideData(const slideData& data)
+//-------------------------------------------------------
+{
+	cleanUp();
+
+	normalScale = new MDoubleArray(data.normalScale);
+	slideScale = new MDoubleArray(data.scale);
+	slideDirections = new MVectorArray(data.directions);
+	slideNormals = new MVectorArray(data.normals);
+	slideStartPoints = new MPointArray(data.startPoints);
+	slideEndPoints = new MPointArray(data.endPoints);
+	slideIndices = new MIntArray(data.indices);
+	maySlide = new MIntArray(data.maySlide);
+
+	//doUVSlide erwartet mit options[7] immer ein UVSet - ohne UVs ist es eben leer
+	UVSlideStart = new list<MFloatVectorArray>(1, data.UVStart);
+	UVSlideEnd = new list<MFloatVectorArray>(1, data.UVEnd);
+	UVSlideIndices = new list<MIntArray>(1, data.UVIndices);
+	UVSlideDirections = new list<MFloatVectorArray>(1, data.UVDirections);
+	UVSlideScale = new list<MFloatArray>(1);		//wird von doUVSlide bei Bedarf berechnet
+
+	maxStandardScale = 1.0;
+}
+
 //-------------------------
 //::In - None
 //
@@ -630,110 +684,56 @@ MStatus	stat;
 			createAbsoluteVectors(*slideDirections, *slideScale);
 	}
 
-	//checken, welche seite gewünscht ist
-	for(unsigned i = 0; i < l; i++)
-	{
-		r = 1.0;
+	// Modus einmal aufloesen. Jeder Eintrag i steht fuer die Vertizen slideIndices[i] bis slideIndices[i+1] - 1,
+	// der r-te davon wird um factor * r entlang der Richtung verschoben - von der gewaehlten Seite aus gezaehlt
+	const MPointArray&	bases = side ? *slideStartPoints : *slideEndPoints;
+	const double		sign = side ? 1.0 : -1.0;
+	const MDoubleArray*	scale = isSlideRelative ? 0 : slideScale;
 
-		if((*maySlide)[i])
-		{
-			if(isSlideRelative)
-			{
-				
-				if(side)
-				{
-					minIndex = (*slideIndices)[i];
-					maxIndex = (*slideIndices)[i+1];
+	unsigned i, numEntries = 0;
+	for(i = 0; i < l; i++)
+		numEntries += (*slideIndices)[i+1] - (*slideIndices)[i];
 
-					if(isNormalRelative)
-					{//r wurd oben initialisiert (1.0)
-						for(x = minIndex; x < maxIndex; x++)
-							FnMesh.setPoint(x,(*slideStartPoints)[i] + (slide * (*slideDirections)[i] * factor * r++) + (normal * (*slideNormals)[i] * maxStandardScale ));
-					}
-					else
-					{
-						for(x = minIndex; x < maxIndex; x++)
-							FnMesh.setPoint(x,(*slideStartPoints)[i] + (slide * factor * r++ * (*slideDirections)[i]) + ( (normal * (*normalScale)[i]) * (*slideNormals)[i] ));
-					}
-				}
-				else
-				{
-					minIndex = (*slideIndices)[i] - 1;	//MINUS 1, damit ich als bedingung x *>* minIndex sagen kann
-					maxIndex = (*slideIndices)[i+1] - 1;	//hier genauso
-					
-					if(isNormalRelative)
-					{
-						for(x = maxIndex; x > minIndex; x--)
-							FnMesh.setPoint(x,(*slideEndPoints)[i] + -1 * slide * factor * r++ * (*slideDirections)[i] + (normal * (*slideNormals)[i] * maxStandardScale));
-					}
-					else
-					{
-						for(x = maxIndex; x > minIndex; x--)
-							FnMesh.setPoint(x,(*slideEndPoints)[i] + -1 * slide * factor * r++ * (*slideDirections)[i] + ( (normal * (*normalScale)[i]) * (*slideNormals)[i] ));
-					}
-				}
-			}
-			else
-			{
+	slideEval.resize(numEntries, 2);
 
-				
-				////cout<<"Bin nach CREATEABSOLUTE VECTORS"<<endl;
-				if(side)
-				{
-					minIndex = (*slideIndices)[i];
-					maxIndex = (*slideIndices)[i+1];
+	unsigned e = 0;
+	for(i = 0; i < l; i++)
+	{
+		minIndex = (*slideIndices)[i];
+		maxIndex = (*slideIndices)[i+1];
 
-					if(isNormalRelative)
-					{
-						for(x = minIndex; x < maxIndex; x++)
-							FnMesh.setPoint(x,(*slideStartPoints)[i] + (slide * factor * r++ * (*slideScale)[i])* (*slideDirections)[i] + ( normal  * (*slideNormals)[i] * maxStandardScale) );
-					}
-					else
-					{
-						for(x = minIndex; x < maxIndex; x++)
-							FnMesh.setPoint( x,(*slideStartPoints)[i] + (slide * factor * r++ * (*slideScale)[i])* (*slideDirections)[i] + ( (normal * (*normalScale)[i]) * (*slideNormals)[i]) );
-					}
-				}
-				else
-				{
-					minIndex = (*slideIndices)[i] - 1;	//MINUS 1, damit ich als bedingung x *>* minIndex sagen kann
-					maxIndex = (*slideIndices)[i+1] - 1;	//hier genauso
+		const unsigned	n = maxIndex - minIndex;
+		const double	nScale = isNormalRelative ? maxStandardScale : (*normalScale)[i];
 
-					if(isNormalRelative)
-					{
-						for(x = maxIndex; x > minIndex; x--)
-							FnMesh.setPoint(x,(*slideEndPoints)[i] + (-1 * slide * (*slideScale)[i])* (*slideDirections)[i] * factor * r++ + ( normal * (*slideNormals)[i] * maxStandardScale) );
-					}
-					else
-					{
-						for(x = maxIndex; x > minIndex; x--)
-							FnMesh.setPoint(x,(*slideEndPoints)[i] + (-1 * slide * (*slideScale)[i])* (*slideDirections)[i] * factor * r++ + ( (normal * (*normalScale)[i]) * (*slideNormals)[i]) );
-					}
-				}	
-			}
-			
-			
-		}
-		else
+		for(x = 0; x < n; x++, e++)
 		{
-
-			minIndex = (*slideIndices)[i];
-			maxIndex = (*slideIndices)[i+1];
-
-			if(isNormalRelative)
+			if((*maySlide)[i])
 			{
-				for(x = minIndex; x < maxIndex; x++)
-					FnMesh.setPoint(x,(*slideStartPoints)[i] + (*slideDirections)[i] * factor * r++ + (normal * (*slideNormals)[i] * maxStandardScale) );
+				r = side ? x + 1 : n - x;
+
+				slideEval.setBase(e, minIndex + x, bases[i]);
+				slideEval.setTerm(0, e, (*slideDirections)[i], slideKernel::kSlide, sign * factor * r * (scale ? (*scale)[i] : 1.0));
 			}
 			else
 			{
-				for(x = minIndex; x < maxIndex; x++)
-					FnMesh.setPoint(x,(*slideStartPoints)[i] + (*slideDirections)[i] * factor * r++ + (normal * (*normalScale)[i] *(*slideNormals)[i]) );
+				// Nicht slidende Vertizen bleiben gleichmaessig auf der Kante verteilt
+				slideEval.setBase(e, minIndex + x, (*slideStartPoints)[i]);
+				slideEval.setTerm(0, e, (*slideDirections)[i], slideKernel::kOne, factor * (x + 1));
 			}
+
+			slideEval.setTerm(1, e, (*slideNormals)[i], slideKernel::kNormal, nScale);
 		}
 	}
 
 
+	double	factors[slideKernel::kNumFactors] = { 0.0 };
+	factors[slideKernel::kOne] = 1.0;
+	factors[slideKernel::kSlide] = slide;
+	factors[slideKernel::kNormal] = normal;
+
+	slideEval.apply(FnMesh, factors);
+
+
 	if(options[7])	//nur wenn keine Tweaks vorhanden sind dürfen die UVs verändert werden, weil es ansonsten zu ungewollten verzerrungen kommen kann
 		doUVSlide(slideMesh);
 	
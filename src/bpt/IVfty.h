@@ -27,6 +27,8 @@
 #include "meshCreator.h"
 #include "BPT_Helpers.h"
 #include "vertexFty.h"
+#include "slideKernel.h"
+#include "resultArchive.h"
 
 
 // General Includes
@@ -82,6 +84,12 @@ public:
 
 	void		doSlide(MObject& slideMesh);
 
+	//! kopiert die SlideArrays, damit die Node sie mit ihrem Ergebnis speichern kann
+	void		getSlideData(slideData& data) const;
+
+	//! ersetzt die SlideArrays durch gespeicherte - danach kann ohne doIt geslided werden
+	void		setSlideData(const slideData& data);
+
 
 //-------------------------------------
 //ZUGRIFFS METHODEN
@@ -234,6 +242,8 @@ private:	//SLIDE ARRAYS
 
 	double						maxStandardScale;	//!< skaliert normalScale auf die länge der längsten normale
 
+	slideKernel					slideEval;			//!< aufgeloester slide - wird bei jedem doSlide neu befuellt
+
 
 //----------------------------
 private:  //Arbeitsvariablen
@@ -32,13 +32,15 @@
 		static	MObject	prefix##maxWeightsObj;		\
 		static	MObject	prefix##smoothenObj;		\
 		static	MObject	prefix##edgeDistanceObj;	\
+		static	MObject	prefix##geodesicObj;		\
 		static	MObject	prefix##useMatrixRotationObj;\
 		static	MObject	prefix##pushObj;			\
 		static	MObject	prefix##pushRelativeObj;	\
 		static	MObject	prefix##meshMatrixObj;		\
 		static	MObject prefix##vtxColorObj;		\
 		static	MObject prefix##vtxColorObj2;		\
-		static	MObject prefix##pointSizeObj;		
+		static	MObject prefix##pointSizeObj;			\
+		static	MObject	prefix##falloffRampObj;		
 
 
 #	define STE_DECLARE_STATIC_PARAMETERS(classname,prefix)	\
@@ -53,13 +55,15 @@
 		MObject	classname::prefix##maxWeightsObj;		\
 		MObject	classname::prefix##smoothenObj;			\
 		MObject	classname::prefix##edgeDistanceObj;		\
+		MObject	classname::prefix##geodesicObj;			\
 		MObject	classname::prefix##useMatrixRotationObj;\
 		MObject	classname::prefix##pushObj;				\
 		MObject	classname::prefix##pushRelativeObj;		\
 		MObject	classname::prefix##meshMatrixObj;		\
 		MObject classname::prefix##vtxColorObj;			\
 		MObject classname::prefix##vtxColorObj2;		\
-		MObject classname::prefix##pointSizeObj;		
+		MObject classname::prefix##pointSizeObj;		\
+		MObject	classname::prefix##falloffRampObj;		
 
 
 
@@ -158,6 +162,15 @@
 	numFn.setKeyable(true);																	\
 	numFn.setInternal( true );																\
 																							\
+	/*########################################*\											\
+	GEODESIC DISTANCE - distance entlang der Oberflaeche messen								\
+	\*########################################*/											\
+																							\
+	prefix##geodesicObj = numFn.create("geodesicDistance","gd",MFnNumericData::kBoolean);	\
+	numFn.setStorable(true);																\
+	numFn.setWritable(true);																\
+	numFn.setKeyable(true);																	\
+																							\
 	/*########################################*\											\
 		SHOW WEIGHTS																		\
 	\*########################################*/											\
@@ -186,11 +199,19 @@
 	enumFn.addField("smooth", 1);															\
 	enumFn.addField("spike", 2);															\
 	enumFn.addField("dome", 3);																\
+	enumFn.addField("ramp", 4);																\
 	enumFn.setStorable(true);																\
 	enumFn.setWritable(true);																\
 	enumFn.setKeyable(true);																\
 																							\
 																							\
+	/*########################################*\											\
+		FALLOFF RAMP - wird bei falloffType ramp verwendet									\
+	\*########################################*/											\
+																							\
+	prefix##falloffRampObj = MRampAttribute::createCurveRamp("falloffRamp","frp");			\
+																							\
+																							\
 	/*########################################*\											\
 		CACHED VTX POSITIONS																\
 	\*########################################*/											\
@@ -243,6 +264,9 @@
 	MCheckStatus(status, "AddAttrSoftEngine");													\
 																								\
 	status = MPxNode::addAttribute(prefix##edgeDistanceObj);									\
+	MCheckStatus(status, "AddAttrSoftEngine");													\
+																								\
+	status = MPxNode::addAttribute(prefix##geodesicObj);										\
 	MCheckStatus(status, "AddAttrSoftEngine");													\
 																								\
   	status = MPxNode::addAttribute(prefix##pushObj);											\
@@ -255,6 +279,9 @@
 	MCheckStatus(status, "AddAttrSoftEngine");													\
 																								\
 																								\
+	status = MPxNode::addAttribute(prefix##falloffRampObj);										\
+	MCheckStatus(status, "AddAttrSoftEngine");													\
+																								\
 	status = MPxNode::addAttribute(prefix##vtxOrigPosObj);										\
 	MCheckStatus(status, "AddAttrSoftEngine");													\
 																								\
@@ -292,6 +319,9 @@
 	//-------------------------------*/															\
 																								\
 	status = MPxNode::attributeAffects( prefix##ftObj, prefix##outMesh );						\
+	MCheckStatus(status, "SetAttrAffects");														\
+																								\
+	status = MPxNode::attributeAffects( prefix##falloffRampObj, prefix##outMesh );				\
 	MCheckStatus(status, "SetAttrAffects");														\
 																								\
 	status = MPxNode::attributeAffects( prefix##vfObj, prefix##outMesh );						\
@@ -313,6 +343,9 @@
 	MCheckStatus(status, "SetAttrAffects");														\
 																								\
 	status = MPxNode::attributeAffects( prefix##edgeDistanceObj, prefix##outMesh );				\
+	MCheckStatus(status, "SetAttrAffects");														\
+																								\
+	status = MPxNode::attributeAffects( prefix##geodesicObj, prefix##outMesh );					\
 	MCheckStatus(status, "SetAttrAffects");														\
 																								\
 	status = MPxNode::attributeAffects( prefix##useMatrixRotationObj, prefix##outMesh );		\
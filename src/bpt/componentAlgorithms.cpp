@@ -0,0 +1,255 @@
+/*
+ * Copyright (C) 2002 Sebastian Thiel
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ */
+
+#include "componentAlgorithms.h"
+
+#include <string.h>
+
+
+namespace BPT
+{
+
+//-----------------------------------------------------------------------------------------
+void	radixSort(int* ids, unsigned count, std::vector<int>& scratch)
+//-----------------------------------------------------------------------------------------
+{
+	// Bis hierhin ist insertion sort schneller als die vier Histogramme
+	if( count < 64 )
+	{
+		for( unsigned i = 1; i < count; i++ )
+		{
+			const int id = ids[i];
+
+			unsigned x = i;
+			for( ; x > 0 && ids[x-1] > id; x-- )
+				ids[x] = ids[x-1];
+
+			ids[x] = id;
+		}
+
+		return;
+	}
+
+
+	// Das Vorzeichenbit umdrehen, damit negative IDs als unsigned vor den positiven liegen
+	const unsigned signFlip = 0x80000000u;
+
+	unsigned histogram[4][256];
+	memset(histogram, 0, sizeof(histogram));
+
+	unsigned i;
+	for( i = 0; i < count; i++ )
+	{
+		const unsigned key = (unsigned)ids[i] ^ signFlip;
+
+		histogram[0][ key & 0xff ]++;
+		histogram[1][ (key >> 8) & 0xff ]++;
+		histogram[2][ (key >> 16) & 0xff ]++;
+		histogram[3][ key >> 24 ]++;
+	}
+
+
+	scratch.resize(count);
+
+	int* src = ids;
+	int* dst = &scratch[0];
+
+	const unsigned firstKey = (unsigned)ids[0] ^ signFlip;
+
+	for( unsigned pass = 0; pass < 4; pass++ )
+	{
+		const unsigned shift = pass * 8;
+		unsigned* offsets = histogram[pass];
+
+		// Alle IDs haben hier dasselbe Byte - der Durchlauf wuerde nichts aendern
+		if( offsets[ (firstKey >> shift) & 0xff ] == count )
+			continue;
+
+		unsigned sum = 0;
+		for( unsigned b = 0; b < 256; b++ )
+		{
+			const unsigned n = offsets[b];
+			offsets[b] = sum;
+			sum += n;
+		}
+
+		for( i = 0; i < count; i++ )
+		{
+			const unsigned key = (unsigned)src[i] ^ signFlip;
+			dst[ offsets[ (key >> shift) & 0xff ]++ ] = src[i];
+		}
+
+		int* tmp = src;
+		src = dst;
+		dst = tmp;
+	}
+
+	if( src != ids )
+		memcpy(ids, src, count * sizeof(int));
+}
+
+
+//-----------------------------------------------------------------------------------------
+unsigned	uniqueSorted(int* ids, unsigned count)
+//-----------------------------------------------------------------------------------------
+{
+	if( count == 0 )
+		return 0;
+
+	unsigned r = 1;
+	for( unsigned i = 1; i < count; i++ )
+	{
+		if( ids[i] != ids[r-1] )
+			ids[r++] = ids[i];
+	}
+
+	return r;
+}
+
+
+//-----------------------------------------------------------------------------------------
+unsigned	intersectSorted(const int* a, unsigned numA, const int* b, unsigned numB, int* out)
+//-----------------------------------------------------------------------------------------
+{
+	unsigned i = 0, x = 0, r = 0;
+
+	while( i < numA && x < numB )
+	{
+		if( a[i] < b[x] )
+			i++;
+		else if( b[x] < a[i] )
+			x++;
+		else
+		{
+			out[r++] = a[i];
+			i++;
+			x++;
+		}
+	}
+
+	return r;
+}
+
+
+//-----------------------------------------------------------------------------------------
+unsigned	differenceSorted(const int* a, unsigned numA, const int* b, unsigned numB, int* out)
+//-----------------------------------------------------------------------------------------
+{
+	unsigned i = 0, x = 0, r = 0;
+
+	while( i < numA )
+	{
+		while( x < numB && b[x] < a[i] )
+			x++;
+
+		if( x == numB || a[i] != b[x] )
+			out[r++] = a[i];
+
+		i++;
+	}
+
+	return r;
+}
+
+
+//-----------------------------------------------------------------------------------------
+void	idHashSet::reserve(unsigned count)
+//-----------------------------------------------------------------------------------------
+{
+	unsigned capacity = 16;
+	while( capacity < count * 2 )
+		capacity *= 2;
+
+	if( capacity > slots.size() )
+		rehash(capacity);
+}
+
+
+//-----------------------------------------------------------------------------------------
+bool	idHashSet::insert(int id)
+//-----------------------------------------------------------------------------------------
+{
+	// Hoechstens halb voll halten, damit die Sondierketten kurz bleiben
+	if( (numEntries + 1) * 2 > slots.size() )
+		rehash( slots.empty() ? 16 : (unsigned)slots.size() * 2 );
+
+	unsigned slot = hash(id) & mask;
+	for( ; slots[slot] != empty; slot = (slot + 1) & mask )
+	{
+		if( slots[slot] == id )
+			return false;
+	}
+
+	slots[slot] = id;
+	numEntries++;
+
+	return true;
+}
+
+
+//-----------------------------------------------------------------------------------------
+void	idHashSet::clear()
+//-----------------------------------------------------------------------------------------
+{
+	if( numEntries == 0 )
+		return;
+
+	slots.assign(slots.size(), (int)empty);
+	numEntries = 0;
+}
+
+
+//-----------------------------------------------------------------------------------------
+void	idHashSet::rehash(unsigned capacity)
+//-----------------------------------------------------------------------------------------
+{
+	std::vector<int>	old(capacity, (int)empty);
+	old.swap(slots);
+
+	mask = capacity - 1;
+
+	for( unsigned i = 0; i < old.size(); i++ )
+	{
+		if( old[i] == empty )
+			continue;
+
+		unsigned slot = hash(old[i]) & mask;
+		while( slots[slot] != empty )
+			slot = (slot + 1) & mask;
+
+		slots[slot] = old[i];
+	}
+}
+
+
+//-----------------------------------------------------------------------------------------
+void	contentHash::add(const void* data, unsigned length)
+//-----------------------------------------------------------------------------------------
+{
+	const unsigned char* bytes = (const unsigned char*)data;
+
+	for( unsigned i = 0; i < length; i++ )
+	{
+		low = (low ^ bytes[i]) * 16777619u;
+		high = (high * 16777619u) ^ bytes[i];
+	}
+
+	numBytes += length;
+}
+
+}
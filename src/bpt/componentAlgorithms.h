@@ -0,0 +1,151 @@
+/*
+ * Copyright (C) 2002 Sebastian Thiel
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ */
+
+#ifndef COMPONENT_ALGORITHMS_INCLUDE
+#define COMPONENT_ALGORITHMS_INCLUDE
+
+// Absichtlich ohne Maya Includes - die Algorithmen arbeiten nur auf rohen int Arrays, damit BPT_Helpers sie fuer
+// MIntArrays verwenden kann und der componentBenchmark sie ausserhalb von Maya messen kann
+
+#include <vector>
+
+
+namespace BPT
+{
+
+/** Sortiert count KomponentenIDs aufsteigend - LSD Radixsort mit 8 bit pro Durchlauf, also O(n).
+	Durchlaeufe, in denen alle IDs dasselbe Byte haben, werden uebersprungen - bei IDs unter 65536 bleiben so nur zwei.
+	Negative IDs sind erlaubt. Sehr kurze Arrays werden per insertion sort sortiert.
+	scratch ist Arbeitsspeicher, der bei wiederholten Aufrufen wiederverwendet werden kann.
+*/
+void		radixSort(int* ids, unsigned count, std::vector<int>& scratch);
+
+//! Entfernt doppelte aus dem sortierten Array und gibt die neue Laenge zurueck
+unsigned	uniqueSorted(int* ids, unsigned count);
+
+//! Schreibt die IDs, die in beiden sortierten, doppelfreien Arrays liegen, sortiert nach out und gibt ihre Zahl zurueck.
+//! out muss Platz fuer min(numA, numB) IDs haben und darf a sein
+unsigned	intersectSorted(const int* a, unsigned numA, const int* b, unsigned numB, int* out);
+
+//! Schreibt die IDs aus a, die nicht in b liegen, sortiert nach out und gibt ihre Zahl zurueck.
+//! Beide Arrays muessen sortiert und doppelfrei sein, out muss Platz fuer numA IDs haben und darf a sein
+unsigned	differenceSorted(const int* a, unsigned numA, const int* b, unsigned numB, int* out);
+
+
+/** Menge von KomponentenIDs fuer Mitgliedschaftstests in O(1).
+
+	Open addressing mit linearem Sondieren in einer Tabelle mit Zweierpotenz als Groesse, die hoechstens halb voll wird.
+	Eine ID kann nicht wieder entfernt werden - fuer die Helper reicht Einfuegen, Abfragen und Leeren.
+	Die ID empty markiert freie Plaetze und kann deshalb nicht gespeichert werden.
+*/
+
+class idHashSet
+{
+public:
+
+	enum { empty = -2147483647 - 1 };
+
+	idHashSet() : numEntries(0), mask(0) {}
+
+	//! Macht Platz fuer count IDs, damit beim Einfuegen nicht neu aufgebaut werden muss
+	void		reserve(unsigned count);
+
+	//! Fuegt id ein - gibt false zurueck, wenn sie schon vorhanden war
+	bool		insert(int id);
+
+	bool		contains(int id) const
+	{
+		if( numEntries == 0 )
+			return false;
+
+		for( unsigned slot = hash(id) & mask; ; slot = (slot + 1) & mask )
+		{
+			if( slots[slot] == id )
+				return true;
+
+			if( slots[slot] == empty )
+				return false;
+		}
+	}
+
+	unsigned	length() const { return numEntries; }
+
+	//! Entfernt alle IDs, behaelt aber die Tabelle
+	void		clear();
+
+private:
+
+	//! Fibonacci hashing - aufeinanderfolgende IDs landen so nicht in einer Reihe
+	static unsigned	hash(int id)
+	{
+		const unsigned h = (unsigned)id * 2654435761u;
+		return h ^ (h >> 16);
+	}
+
+	//! Baut die Tabelle mit capacity Plaetzen neu auf
+	void		rehash(unsigned capacity);
+
+private:
+
+	std::vector<int>	slots;
+
+	unsigned	numEntries;
+	unsigned	mask;			//!< Tabellengroesse - 1
+};
+
+
+/** Fingerabdruck beliebiger Daten, zum Beispiel der Topologie und Auswahl, auf der eine Berechnung beruht.
+
+	Zwei 32 bit FNV Hashes (FNV-1a und FNV-1 mit verschiedenen Startwerten) und die Zahl der Bytes - zusammen 64 bit
+	Hash, ohne auf long long angewiesen zu sein.
+*/
+
+class contentHash
+{
+public:
+
+	contentHash() : low(2166136261u), high(3987079245u), numBytes(0) {}
+
+	void		add(const void* data, unsigned length);
+
+	void		add(int value) { add(&value, sizeof(value)); }
+
+	bool		operator == (const contentHash& rhs) const
+	{
+		return low == rhs.low && high == rhs.high && numBytes == rhs.numBytes;
+	}
+
+	bool		operator != (const contentHash& rhs) const { return !(*this == rhs); }
+
+	enum { kNumParts = 3 };
+
+	//! die drei Teile des Hashes - zum Speichern in einem Attribut
+	void		getParts(unsigned parts[kNumParts]) const { parts[0] = low; parts[1] = high; parts[2] = numBytes; }
+
+	void		setParts(const unsigned parts[kNumParts]) { low = parts[0]; high = parts[1]; numBytes = parts[2]; }
+
+private:
+
+	unsigned	low;
+	unsigned	high;
+	unsigned	numBytes;
+};
+
+}
+
+#endif
@@ -27,8 +27,12 @@
 // Construction/Destruction
 //////////////////////////////////////////////////////////////////////
 
-edge::edge(int inID)
-	: id(inID)
+edge::edge(edgeContext& inContext, int inID)
+	: context(inContext)
+	, creator(inContext.creator)
+	, side(inContext.side)
+	, dir(inContext.dir)
+	, id(inID)
 	, clean(false)
 {
 	//sicherheitshalber alle nachbarn mit 0 initialisieren
@@ -43,8 +47,12 @@ edge::edge(int inID)
 }
 
 
-edge::edge(MIntArray inFaceIDs,int inID)
-	: faceIDs(inFaceIDs)
+edge::edge(edgeContext& inContext, MIntArray inFaceIDs,int inID)
+	: context(inContext)
+	, creator(inContext.creator)
+	, side(inContext.side)
+	, dir(inContext.dir)
+	, faceIDs(inFaceIDs)
 	, id(inID)
 	, clean(false)
 {
@@ -65,21 +73,6 @@ edge::~edge()
 }
 
 
-edgeMeshCreator*			edge::creator = 0;
-double						edge::maxLength = (0.0);	//wird dann von InitEdges routine gesetzt
-
-
-
-BPT_BA						edge::origVtxDoneBA;
-
-std::list<edgeFaceData*>	edge::MAINFaceDataPtrs;
-std::list<endFaceData*>		edge::endFacePtrs;
-std::list<nSelEdgeData*>	edge::nSelEdgeDataArray;
-
-ULONG						edge::side,edge::dir;
-
-
-
 //////////////////////////////////////////////////////////////////////
 //ZUGRIFFSMETHODEN
 //////////////////////////////////////////////////////////////////////
@@ -373,10 +366,10 @@ void		edge::initFaceData(int extraDirection)
 
 	//jetzt noch faceData Erstellen
 	int thisFaceID = faceIDs[myDir];
-	faceData[myDir] = new edgeFaceData(thisFaceID);
+	faceData[myDir] = context.faceDataPool.add( new (context.faceDataPool.allocate()) edgeFaceData(thisFaceID, creator->numUVSets) );
 
 	//neue Einheit auf die HauptDump packen
-	MAINFaceDataPtrs.push_back(faceData[myDir]);
+	context.MAINFaceDataPtrs.push_back(faceData[myDir]);
 
 
 	
@@ -516,7 +509,7 @@ int			edge::C_fixNewVtxUV(int origVtx,int refVtx, edgeFaceData* faceData)
 		//die neuen Datan muessen als newVtx eingetragen werden an den Anfang, weil ja ein tmpFace erzeugt werden muss mit den entsprechenden infos aus den 2
 		//(normalerweilse vorhandenen faceDatas)
 		
-		int thisNewVtx = edge::creator->newVtx(creator->getVtxPoint(origVtx));
+		int thisNewVtx = creator->newVtx(creator->getVtxPoint(origVtx));
 
 				//jetzt vtx und UVChange neu schreiben
 		faceData->vtxChange.setLength(2);
@@ -531,9 +524,9 @@ int			edge::C_fixNewVtxUV(int origVtx,int refVtx, edgeFaceData* faceData)
 		MIntArray origUVs = faceData->getEdgeVtxUVs(origVtx);
 		
 		MFloatArray origUVPos;
-		edge::creator->getUVPositions(origUVs, origUVPos);
+		creator->getUVPositions(origUVs, origUVPos);
 
-		MIntArray newUVs = edge::creator->createUVs(origUVs, origUVPos);
+		MIntArray newUVs = creator->createUVs(origUVs, origUVPos);
 		
 
 		for(UINT i = 0; i < creator->numUVSets; i++)
@@ -803,7 +796,7 @@ outOfIf:;
 				int validFace = (nFaces[0] == faceIDs[dir]) ? nFaces[1] : nFaces[0] ;
 				
 				//nun das Face veruendern
-				edge::creator->changeSideFace(origVtx, newVtx, validFace, newUVIds);
+				creator->changeSideFace(origVtx, newVtx, validFace, newUVIds);
 
 			}
 
@@ -888,7 +881,7 @@ outOfIf:;
 				//gut: Bei bedarf jetzt die sideFaces auf Queue tun - wenn sie ein face teilen gibt es keine nSelEdges
 				if( edgeTmp[f]->nSelNachbarn[seite[f]][richtung[f]] != 0)
 				{//auch wenn die UVs hier noch nicht eingetragen sind, wird dies bei der benutzung des tmpFacePtr bereits geschehen sein
-					edge::nSelEdgeDataArray.push_back(new nSelEdgeData(edgeTmp[f]->nSelNachbarn[seite[f]][richtung[f]], origVtx, newVtx, tmpFace[f] ) );
+					context.nSelEdgeDataArray.push_back(context.nSelEdgeDataPool.add( new (context.nSelEdgeDataPool.allocate()) nSelEdgeData(edgeTmp[f]->nSelNachbarn[seite[f]][richtung[f]], origVtx, newVtx, tmpFace[f] ) ) );
 				}
 
 				//erstmal checken, ob jetzt noch (nach der bearbeitung der geshareten UVs, UVs vorhanden sind zum erstellen
@@ -970,7 +963,7 @@ void	edge::getUVPos(MPoint newVtxPos, edgeFaceData* thisFace, MFloatArray& newUV
 	//ich baue mir mein eigenes Face anhand der OriginalDaten im Creator -> Diese sind unverueuendert (haben keine EdgeUVs, die direkt auf einer edge liegen, und mir dann die Werte versauen)
 	if(regatherData)
 	{//diese funktion ist deaktiviert, wenn diese methode von nSelEdge gerufen wird, da diese bereits gute Daten uebergibt
-		edgeFaceData* tmpFace = new edgeFaceData(thisFace->id);
+		edgeFaceData* tmpFace = new edgeFaceData(thisFace->id, creator->numUVSets);
 		
 		creator->getFaceVtxIDs(tmpFace->id, tmpFace->faceVertices);
 		tmpFace->UVRelOffsets = (bool*)malloc(creator->numUVSets);
@@ -983,7 +976,7 @@ void	edge::getUVPos(MPoint newVtxPos, edgeFaceData* thisFace, MFloatArray& newUV
 	creator->getVtxPositions(thisFace->faceVertices, positions);
 
 	MFloatArray			UVPositions;	//hueuelt die positionen aller UVs aller UVs aller UVSets dieses Faces
-	edge::creator->getUVPositions(thisFace->UVIndices, UVPositions);
+	creator->getUVPositions(thisFace->UVIndices, UVPositions);
 
 	UINT l = thisFace->faceVertices.length();
 
@@ -1256,7 +1249,7 @@ int			edge::C_checkForEdgeVtx( const edge* requester,		//ptr zum
 						
 						
 						//jetzt noch slide hinzufueuegen, damit die Position des edgeVtx wirklich immer in der Mitte 
-						edge::creator->addSlideAndNormal(vtxIDs[s], edgeVtx[s], faceIDs);
+						creator->addSlideAndNormal(vtxIDs[s], edgeVtx[s], faceIDs);
 						
 						//FERTIG //MERKE: Um normalen kueuemmert sich das Face automatisch
 						
@@ -35,6 +35,7 @@
 #include "nSelEdgeData.h"
 #include "edgeMeshCreator.h"
 #include "BPT_BA.h"
+#include "edgeContext.h"
 #include <math.h>
 
 
@@ -49,9 +50,9 @@ class edge
 {
 public:
 	
-	edge(int inID);
+	edge(edgeContext& inContext, int inID);
 	//edge(MVectorArray inNormals, MIntArray inWingedVtx,MIntArray inFaceIDs,int inId);
-	edge(MIntArray inFaceIDs,int inId);
+	edge(edgeContext& inContext, MIntArray inFaceIDs,int inId);
 	virtual ~edge();
 
 
@@ -147,18 +148,12 @@ protected:
 
 public:
 //----------------------------------
-///STATISCHE ELEMENTE
+///OPERATIONSKONTEXT
 //----------------------------------
-//werden bentigt, im das Mesh spter wieder korrekt aufzubauen, um Dataen zwischen zu speichern,die von jeder Edge aus erreichbar sind
+//alles, was frueher statisch war, teilen sich die edges einer Operation jetzt ueber ihren Kontext
 
-	static edgeMeshCreator*		creator;
-	static double				maxLength ;	//ist die kleinste unSelEdge und sorgt dafuer, dass die Faces nicht uebers ziel hinausschiessen
-	
-	static std::list<edgeFaceData*> MAINFaceDataPtrs;	//!< enthlt Ptr zu allen faceDataEinheiten - wird verwendet, um die origFaces anzupassen und um die einheiten zu lschen
-	static std::list<endFaceData*>	endFacePtrs;		//!< hlt die Ptr zu den EndFaces, welche ganz zum schluss evaluiert/erstellt werden
-	static std::list<nSelEdgeData*> nSelEdgeDataArray;	//!< hlt infos ueber die zu ndernden Faces, welche an nSelEdges angrenzen. Diese werden spter rekonstruiert
-
-	static BPT_BA					origVtxDoneBA;		//!< ist true, wenn vtx gewhlt ist (== selVtx);WIRD VON CHAMFER VERWENDET UND VON SOLIDCHAMFER, allerdings aus erschiedenen Gruenden
+	edgeContext&				context;
+	edgeMeshCreator* const		creator;			//!< == context.creator, steht hier, damit er wie bisher direkt erreichbar ist
 
 
 
@@ -217,8 +212,9 @@ protected:
 	////////////////////////////
 	///PRIVATE DATENELEMENTE////
 	////////////////////////////
-	static			ULONG			side,dir;			/*!< wird fuer iteration verwendet und verhindert, dass man diese Parameter stndig mitgeben muss
-														//vars sind statisch, da sie immer nur von einer Edge zu einem Zeitpunkt verwendet werden
+	ULONG&			side;
+	ULONG&			dir;						/*!< wird fuer iteration verwendet und verhindert, dass man diese Parameter stndig mitgeben muss
+														//vars verweisen auf context.side/dir, da sie immer nur von einer Edge zu einem Zeitpunkt verwendet werden
 														//MERKE: MAN DARF JETZT NICHTS MEHR REKURSIV LOESEN!!! ->GEHT KLAR ;) */
 
 	int				vtxIDs[2];				//!< hlt die VtxIDs der beiden enden
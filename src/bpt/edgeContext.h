@@ -0,0 +1,91 @@
+/*
+ * Copyright (C) 2002 Sebastian Thiel
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ */
+
+#ifndef EDGE_CONTEXT_INCLUDE
+#define EDGE_CONTEXT_INCLUDE
+
+#include "MACROS.h"
+
+#include "BPT_BA.h"
+#include "objectPool.h"
+
+#include <list>
+
+
+namespace BPT
+{
+
+class edgeMeshCreator;
+class edgeFaceData;
+class endFaceData;
+class nSelEdgeData;
+class selEdge;
+class nSelEdge;
+
+
+/** Zustand einer chamfer/solidChamfer Operation, den sich alle edges des Netzwerks teilen.
+
+	Frueher waren das statische Elemente von edge - damit konnte immer nur eine Operation zur Zeit laufen.
+	Jetzt erzeugt BPTfty::doIt pro Operation einen Kontext und jede edge erhaelt ihn bei der Konstruktion.
+	Der Kontext besitzt ausserdem alle Objekte der Operation und gibt sie mit clear() oder seinem Destruktor frei -
+	beides ist in edgeContext.cpp definiert, da dort die Typen der edges vollstaendig bekannt sind.
+*/
+
+struct edgeContext
+{
+	explicit edgeContext(edgeMeshCreator* inCreator)
+		: creator(inCreator)
+		, maxLength(0.0)
+		, side(0)
+		, dir(0)
+	{}
+
+	~edgeContext();
+
+	//! Zerstoert alle Objekte der Operation und leert die Listen
+	void	clear();
+
+
+	edgeMeshCreator*			creator;
+	double						maxLength;			//!< ist die kleinste unSelEdge und sorgt dafuer, dass die Faces nicht uebers ziel hinausschiessen
+
+	ULONG						side, dir;			//!< werden fuer die iteration verwendet - immer nur von einer edge zu einem Zeitpunkt
+
+	std::list<edgeFaceData*>	MAINFaceDataPtrs;	//!< enthaelt Ptr zu allen faceDataEinheiten - wird verwendet, um die origFaces anzupassen
+	std::list<endFaceData*>		endFacePtrs;		//!< haelt die Ptr zu den EndFaces, welche ganz zum schluss evaluiert/erstellt werden
+	std::list<nSelEdgeData*>	nSelEdgeDataArray;	//!< haelt infos ueber die zu aendernden Faces, welche an nSelEdges angrenzen
+
+	BPT_BA						origVtxDoneBA;		//!< ist true, wenn vtx gewaehlt ist (== selVtx)
+
+	//! besitzen die Objekte der obigen Listen und alle edges
+	objectPool<edgeFaceData>	faceDataPool;
+	objectPool<endFaceData>		endFacePool;
+	objectPool<nSelEdgeData>	nSelEdgeDataPool;
+
+	objectPool<selEdge>			selEdgePool;
+	objectPool<nSelEdge>		nSelEdgePool;
+
+private:
+
+	edgeContext(const edgeContext&);
+	edgeContext& operator=(const edgeContext&);
+};
+
+}
+
+#endif
@@ -27,13 +27,13 @@
 // Construction/Destruction
 //////////////////////////////////////////////////////////////////////
 
-unsigned short	edgeFaceData::numUVSets;
 BPT_Helpers		edgeFaceData::helper;
 
 //---------------------------------------------
-edgeFaceData::edgeFaceData(UINT inFaceID)
+edgeFaceData::edgeFaceData(UINT inFaceID, unsigned short inNumUVSets)
 : UVAbsOffsets(0)
 , UVRelOffsets(0)
+, numUVSets(inNumUVSets)
 , id(inFaceID)
 //---------------------------------------------
 {	
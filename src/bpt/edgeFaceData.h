@@ -46,7 +46,7 @@ class edgeFaceData
 //KONSTRUKTION - DESTRUKTION
 public:
 //----------------------------
-	edgeFaceData(UINT inFaceID);
+	edgeFaceData(UINT inFaceID, unsigned short inNumUVSets);
 	~edgeFaceData();
 
 
@@ -124,7 +124,7 @@ public:
 public:
 //----------------------------
 
-	static unsigned short	numUVSets;		//!< wird in ftyAction gesetzt
+	const unsigned short	numUVSets;		//!< == creator->numUVSets, wird bei der Konstruktion uebergeben
 
 	const UINT				id;				//!< hält die FaceID
 
@@ -223,9 +223,9 @@ void	edgeMeshCreator::changeEndFace(int origID,int newID[],int directions[], edg
 		
 		//jetzt müssen die erstellten UVs pro UVSet angehängt werden
 		//ITERATOREN
-		std::list<MIntArray>::iterator	UVCountsIter	=		UVCounts->begin();
-		std::list<MIntArray>::iterator	UVAbsIter		= 		UVAbsOffsets->begin();		
-		std::list<MIntArray>::iterator  UVIDsIter		=		UVperVtx->begin();
+		UVIndexSets::iterator	UVCountsIter	=		UVCounts.begin();
+		UVIndexSets::iterator	UVAbsIter		= 		UVAbsOffsets.begin();		
+		UVIndexSets::iterator  UVIDsIter		=		UVperVtx.begin();
 		
 		//durch jedes UVSet gehen
 		for(x = 0; x < numUVSets; x++,UVCountsIter++,UVAbsIter++,UVIDsIter++)
@@ -384,21 +384,15 @@ void	edgeMeshCreator::changeSideFace(int origVtx, int newVtxID, int faceID, MInt
 	
 	//BEARBEITE ORIGVTX
 
-	int offset = getValidAbsoluteOffset(faceID);
-	int count = offset + (*offsets)[faceID];
+	int offset, count;
 	
-	int newVtxLocID = 0;		//hält den faceRelativen index des newVtxID, wird von UVs benoetigt, um schneller arbeiten zu koennen
-	//ZUERST DEN ORIGVTX IN FACEARRAY MIT DEM NEWVTX TAUSCHEN
+	//ZUERST DEN ORIGVTX IN FACEARRAY MIT DEM NEWVTX TAUSCHEN - origVtx ist eh nur einmal im Face vorhanden
+	//newVtxLocID hält den faceRelativen index des newVtxID, wird von UVs benoetigt, um schneller arbeiten zu koennen
+	int newVtxLocID = topo.replaceFaceVertex(faceID, origVtx, newVtxID);
+	if(newVtxLocID < 0)
+		newVtxLocID = 0;
+
 	int i;
-	for(i = offset; i < count; i++)	
-	{
-		if(	(*faceVtxIDs)[i] == origVtx)
-		{
-			(*faceVtxIDs)[i] = newVtxID;
-			newVtxLocID = i - offset;
-			break;	//Abbruch, da origVtx eh nur einmal im Face vorhanden ist
-		}
-	}
 
 
 	//BEARBEITE NORMALEN
@@ -426,11 +420,9 @@ void	edgeMeshCreator::changeSideFace(int origVtx, int newVtxID, int faceID, MInt
 	//jetzt jede UV in jedem UVSet verändern, wenn moeglich
 	
 	//iteratoren
-	std::list<MIntArray>::iterator iterCounts			= UVCounts->begin();
-	std::list<MIntArray>::iterator iterOffset			= UVAbsOffsets->begin();
-	std::list<MIntArray>::iterator iterLUT				= UVoffsetsLUT->begin();
-	std::list<MIntArray>::iterator iterLUTValues		= UVoffsetsLUTValues->begin();
-	std::list<MIntArray>::iterator iterUVIDs			= UVperVtx->begin();
+	UVIndexSets::iterator iterCounts			= UVCounts.begin();
+	UVIndexSets::iterator iterOffset			= UVAbsOffsets.begin();
+	UVIndexSets::iterator iterUVIDs			= UVperVtx.begin();
 	
 	
 	
@@ -442,7 +434,7 @@ void	edgeMeshCreator::changeSideFace(int origVtx, int newVtxID, int faceID, MInt
 		{
 			
 			//faceUVs verändern
-			offset = getValidAbsoluteUVOffset(faceID,i,iterOffset,iterLUT,iterLUTValues);
+			offset = getValidAbsoluteUVOffset(faceID,i,iterOffset);
 			
 			(*iterUVIDs)[offset + newVtxLocID] = newUVIds[i];
 			
@@ -452,8 +444,6 @@ void	edgeMeshCreator::changeSideFace(int origVtx, int newVtxID, int faceID, MInt
 		
 		++iterCounts;
 		++iterOffset;
-		++iterLUT;
-		++iterLUTValues;
 		++iterUVIDs;
 		
 	}
@@ -629,41 +619,20 @@ void	edgeMeshCreator::insertVtx(const edgeFaceData* faceData, int origID, int ne
 void	edgeMeshCreator::removeVtx(int vtxID, int faceID)
 //-----------------------------------------------------------------
 {
-	unsigned offset = getValidAbsoluteOffset(faceID);
-
-	unsigned aOffset = offset + (*offsets)[faceID];
-
-	unsigned vtxLocID;	// == der faceRelative index des Vtx
-
-	bool found = false;
-
-	//jetzt den vtx finden:
-	UINT i;
-	for(i = offset; i < aOffset; i++)
-	{
-
-		if((*faceVtxIDs)[i] == vtxID)
-		{
-			vtxLocID = i - offset;
-			
-			faceVtxIDs->remove(i);
-
-			found = true;
-
-			break;
-		}
+	unsigned offset, aOffset;
 
-	}
+	//jetzt den vtx finden und entfernen:
+	int found = topo.removeFaceVertex(faceID, vtxID);
 
-	if(!found)
+	if(found < 0)
 	{
 		INVIS(cout<<"WARNUNG: HABE VTX "<<vtxID<<" NICHT GEFUNDEN. KONNTE IHN NICHT ENTFERNEN. ABBRUCH!"<<endl);
 		return;
 	}
 
-	//aktualisieren der LUT Arrays
-	(*offsets)[faceID]--;
-	updateOffsetLUT(faceID, -1);
+	unsigned vtxLocID = found;	// == der faceRelative index des Vtx
+
+	UINT i;
 
 
 //wenn vtx eine Kante beginnt, wird die ganze Kante entfernt, 
@@ -706,12 +675,10 @@ void	edgeMeshCreator::removeVtx(int vtxID, int faceID)
 	UINT l;
 
 	//ITERATOREN
-	std::list<MIntArray>::iterator iterCounts		=		UVCounts->begin();
-	std::list<MIntArray>::iterator iterOffset		=		UVAbsOffsets->begin();
-	std::list<MIntArray>::iterator iterLUT			=		UVoffsetsLUT->begin();
-	std::list<MIntArray>::iterator iterLUTValues	=		UVoffsetsLUTValues->begin();
+	UVIndexSets::iterator iterCounts		=		UVCounts.begin();
+	UVIndexSets::iterator iterOffset		=		UVAbsOffsets.begin();
 	
-	std::list<MIntArray>::iterator iterUVIDs		=		UVperVtx->begin();
+	UVIndexSets::iterator iterUVIDs		=		UVperVtx.begin();
 	
 	
 	for(i = 0; i < numUVSets;i++)
@@ -722,7 +689,7 @@ void	edgeMeshCreator::removeVtx(int vtxID, int faceID)
 		
 		l = (*iterCounts)[faceID];
 		
-		offset = getValidAbsoluteUVOffset(faceID, i, iterOffset, iterLUT, iterLUTValues);
+		offset = getValidAbsoluteUVOffset(faceID, i, iterOffset);
 		
 		aOffset = offset + l;
 		
@@ -735,7 +702,7 @@ void	edgeMeshCreator::removeVtx(int vtxID, int faceID)
 		
 		
 		
-		updateOffsetUVLUT(faceID,-1,i,iterLUT,iterLUTValues);
+		updateOffsetUVLUT(faceID,-1,i);
 		(*iterCounts)[faceID]--;
 		
 		
@@ -743,8 +710,6 @@ void	edgeMeshCreator::removeVtx(int vtxID, int faceID)
 		++iterCounts;
 		++iterUVIDs;
 		
-		++iterLUT;
-		++iterLUTValues;
 		++iterOffset;
 		
 	}
@@ -761,7 +726,7 @@ void	edgeMeshCreator::changePolyVtxIDs(const edgeFaceData* faceData)
 {
 	int faceID = faceData->id;
 
-	UINT l = (*offsets)[faceID];
+	UINT l = topo.faceVertexCount(faceID);
 
 	int change = faceData->faceVertices.length() - l;	//change muss in jedem Fall bereits hier gesetzt werden, da es nach der changeVtx prozedur sowieso gleich faceVertices.length() ist
 
@@ -787,12 +752,10 @@ void	edgeMeshCreator::changePolyVtxIDs(const edgeFaceData* faceData)
 	
 	
 	//ITERATOREN
-	std::list<MIntArray>::iterator iterCounts		=		UVCounts->begin();
-	std::list<MIntArray>::iterator iterOffset		=		UVAbsOffsets->begin();
-	std::list<MIntArray>::iterator iterLUT			=		UVoffsetsLUT->begin();
-	std::list<MIntArray>::iterator iterLUTValues	=		UVoffsetsLUTValues->begin();
+	UVIndexSets::iterator iterCounts		=		UVCounts.begin();
+	UVIndexSets::iterator iterOffset		=		UVAbsOffsets.begin();
 	
-	std::list<MIntArray>::iterator iterUVIDs		=		UVperVtx->begin();
+	UVIndexSets::iterator iterUVIDs		=		UVperVtx.begin();
 	
 	
 	for(UINT i = 0; i < numUVSets;i++)
@@ -803,7 +766,7 @@ void	edgeMeshCreator::changePolyVtxIDs(const edgeFaceData* faceData)
 		
 		
 		
-		offset = getValidAbsoluteUVOffset(faceID, i, iterOffset, iterLUT, iterLUTValues);
+		offset = getValidAbsoluteUVOffset(faceID, i, iterOffset);
 		
 		aOffset = offset + l;
 		
@@ -832,7 +795,7 @@ void	edgeMeshCreator::changePolyVtxIDs(const edgeFaceData* faceData)
 		//LUT aktualisieren
 		if(change != 0)
 		{
-			updateOffsetUVLUT(faceID,change,i,iterLUT,iterLUTValues);
+			updateOffsetUVLUT(faceID,change,i);
 			(*iterCounts)[faceID] += change;
 		}
 		
@@ -840,8 +803,6 @@ void	edgeMeshCreator::changePolyVtxIDs(const edgeFaceData* faceData)
 		++iterCounts;
 		++iterUVIDs;
 		
-		++iterLUT;
-		++iterLUTValues;
 		++iterOffset;
 		
 	}
@@ -868,11 +829,7 @@ void	edgeMeshCreator::createPoly(const edgeFaceData* data)
 
 	//VTXARRAY UPDATEN
 	
-	(*offsets).append(data->faceVertices.length());
-	helper.addIntArrayToLHS(*faceVtxIDs,data->faceVertices);
-	
-
-	offsetsAbsolute->append( (*offsetsAbsolute)[ offsetsAbsolute->length() - 1 ] + data->faceVertices.length() );
+	appendFace(data->faceVertices);
 
 	
 
@@ -883,9 +840,9 @@ void	edgeMeshCreator::createPoly(const edgeFaceData* data)
 	
 	
 	//ITERATOREN
-	std::list<MIntArray>::iterator UVCountsIter		=		UVCounts->begin();
-	std::list<MIntArray>::iterator UVAOIter			=		UVAbsOffsets->begin();
-	std::list<MIntArray>::iterator UVIDIter			=		UVperVtx->begin();			
+	UVIndexSets::iterator UVCountsIter		=		UVCounts.begin();
+	UVIndexSets::iterator UVAOIter			=		UVAbsOffsets.begin();
+	UVIndexSets::iterator UVIDIter			=		UVperVtx.begin();			
 	
 	UINT r, x;
 	
@@ -953,11 +910,7 @@ void	edgeMeshCreator::createPoly(MIntArray& vtxIDs, edgeFaceData* faceData)
 
 	//FACE ERSTELLEN
 
-	(*offsets).append(vtxIDs.length());
-	helper.addIntArrayToLHS(*faceVtxIDs,vtxIDs);
-	
-
-	offsetsAbsolute->append( (*offsetsAbsolute)[ offsetsAbsolute->length() - 1 ] + vtxIDs.length() );
+	appendFace(vtxIDs);
 
 
 	//UVS BEARBEITEN
@@ -969,9 +922,9 @@ void	edgeMeshCreator::createPoly(MIntArray& vtxIDs, edgeFaceData* faceData)
 	int cVtx;		//tmpVariable für vtx aus vtxIDs -> currentVtx
 	
 	//ITERATOREN
-	std::list<MIntArray>::iterator UVCountsIter		=		UVCounts->begin();
-	std::list<MIntArray>::iterator UVAOIter			=		UVAbsOffsets->begin();
-	std::list<MIntArray>::iterator UVIDIter			=		UVperVtx->begin();			
+	UVIndexSets::iterator UVCountsIter		=		UVCounts.begin();
+	UVIndexSets::iterator UVAOIter			=		UVAbsOffsets.begin();
+	UVIndexSets::iterator UVIDIter			=		UVperVtx.begin();			
 	
 	
 	
@@ -1140,9 +1093,7 @@ void	edgeMeshCreator::recreateOriginalFace(edgeFaceData* origFace)
 	
 	UINT l = origFace->vtxChange.length();
 
-	UINT vOffset = getValidAbsoluteOffset(origFace->id);	//gültiges offset in faceVtxArray
-	UINT vCount =  vOffset + (*offsets)[origFace->id];
-	UINT newVtxLocID;										//ID, die drekt auf die position vom OrigVtx zeigt, und somit auch die entsprechende UV referenziert
+	int	 newVtxLocID;										//ID, die drekt auf die position vom OrigVtx zeigt, und somit auch die entsprechende UV referenziert
 	int	 origVtx;											//speicher für den originalVtx
 	int	 newVtxID;											//speicher für den newVtx
 
@@ -1167,27 +1118,12 @@ void	edgeMeshCreator::recreateOriginalFace(edgeFaceData* origFace)
 		//ZUERST DEN ORIGVTX IN FACEARRAY MIT DEM NEWVTX TAUSCHEN
 		origVtx = origFace->vtxChange[a];
 		
-		bool notFound = true;
-
-
-		unsigned i;
-		for(i = vOffset; i < vCount; i++)	
-		{
-			if(	(*faceVtxIDs)[i] == origVtx)
-			{
-				newVtxID = origFace->vtxChange[a+1];	
-
-				(*faceVtxIDs)[i] = newVtxID;
-				
-				newVtxLocID = i - vOffset;				//wird später für schnellen UVLookup benoetigt
+		newVtxID = origFace->vtxChange[a+1];	
 
-				notFound = false;
-
-				break;	//Abbruch, da origVtx eh nur einmal im Face vorhanden ist
-			}
-		}
+		//origVtx ist eh nur einmal im Face vorhanden - newVtxLocID wird später für schnellen UVLookup benoetigt
+		newVtxLocID = topo.replaceFaceVertex(origFace->id, origVtx, newVtxID);
 		
-		if(notFound)
+		if(newVtxLocID < 0)
 		{
 			//wenn er diesen Vtx nicht finden konnte, dann wurde er wahrscheinlich vorher schon verändert von einer FaceData instanz, die das selbe Face bezeichnete
 			//dies kann vorkommen bei bestimmten konstellationen von endEdges uns selEdges, die sich ein grosses nGon teilen, ohne dabei miteinander verbunden zu sein
@@ -1197,6 +1133,7 @@ void	edgeMeshCreator::recreateOriginalFace(edgeFaceData* origFace)
 		//BEARBEITE NORMALEN
 		
 
+		unsigned i;
 		
 		//JEDES VORKOMMEN VON ORIGVTX DURCH NEWVTX ERSETZEN
 		for(i = nOffset; i < nCount; i++)
@@ -1215,11 +1152,9 @@ void	edgeMeshCreator::recreateOriginalFace(edgeFaceData* origFace)
 			//jetzt jede UV in jedem UVSet verändern, wenn moeglich
 			
 			//iteratoren
-			std::list<MIntArray>::iterator iterCounts			= UVCounts->begin();
-			std::list<MIntArray>::iterator iterOffset			= UVAbsOffsets->begin();
-			std::list<MIntArray>::iterator iterLUT				= UVoffsetsLUT->begin();
-			std::list<MIntArray>::iterator iterLUTValues		= UVoffsetsLUTValues->begin();
-			std::list<MIntArray>::iterator iterUVIDs			= UVperVtx->begin();
+			UVIndexSets::iterator iterCounts			= UVCounts.begin();
+			UVIndexSets::iterator iterOffset			= UVAbsOffsets.begin();
+			UVIndexSets::iterator iterUVIDs			= UVperVtx.begin();
 			
 			
 			
@@ -1234,7 +1169,7 @@ void	edgeMeshCreator::recreateOriginalFace(edgeFaceData* origFace)
 					
 					if(uOffset[i] == -2)
 					{	//es muss also noch ein passender Offset erstellt werden
-						uOffset[i] = getValidAbsoluteUVOffset(origFace->id,i,iterOffset,iterLUT,iterLUTValues);
+						uOffset[i] = getValidAbsoluteUVOffset(origFace->id,i,iterOffset);
 					}
 					
 					
@@ -1247,8 +1182,6 @@ void	edgeMeshCreator::recreateOriginalFace(edgeFaceData* origFace)
 				
 				++iterCounts;
 				++iterOffset;
-				++iterLUT;
-				++iterLUTValues;
 				++iterUVIDs;
 				
 			}
@@ -1307,8 +1240,8 @@ void	edgeMeshCreator::addNormalSlide(int vtxID)
 void	edgeMeshCreator::addSlide(int startID,int endID)
 //--------------------------------------------------------
 {
-	MPoint start = (*vtxPoints)[endID];
-	MPoint end = (*vtxPoints)[startID];
+	MPoint start = getVtxPoint(endID);
+	MPoint end = getVtxPoint(startID);
 
 	MVector direction = end - start;
 
@@ -1369,9 +1302,9 @@ void	edgeMeshCreator::addSlideAndNormal(int startID, int newVtx, MPoint& positio
 	if(usePositionInstead)
 		start = position;
 	else
-		start = (*vtxPoints)[newVtx];
+		start = getVtxPoint(newVtx);
 
-	end = (*vtxPoints)[startID];
+	end = getVtxPoint(startID);
 
 	MVector direction = end - start;
 
@@ -1478,8 +1411,8 @@ void	edgeMeshCreator::addSlideAndNormal(int startID, int edgeVtx,MIntArray& face
 
 	normal.normalize();
 
-	MPoint start = (*vtxPoints)[edgeVtx];
-	MPoint end = (*vtxPoints)[startID];
+	MPoint start = getVtxPoint(edgeVtx);
+	MPoint end = getVtxPoint(startID);
 
 	MVector direction = end - start;
 
@@ -1505,14 +1438,14 @@ void	edgeMeshCreator::addSlideAndNormal(int startID, int edgeVtx,MIntArray& face
 int		edgeMeshCreator::addWingedDisplacedVtx(int wingedVtx, MVector& preMultipliedNormal)
 //-------------------------------------------------------------------------------------------
 {
-	return meshCreator::newVtx((*vtxPoints)[wingedVtx] + preMultipliedNormal);
+	return meshCreator::newVtx(getVtxPoint(wingedVtx) + preMultipliedNormal);
 }
 
 //-------------------------------------------------------------------------------------------
 MPoint		edgeMeshCreator::getWingedDisplacedPoint(int wingedVtx, MVector& preMultipliedNormal)
 //-------------------------------------------------------------------------------------------
 {
-	return ((*vtxPoints)[wingedVtx] + preMultipliedNormal);
+	return (getVtxPoint(wingedVtx) + preMultipliedNormal);
 }
 
 
@@ -1538,8 +1471,8 @@ void	edgeMeshCreator::setUVPositions(MIntArray& UVIds, MFloatArray& UVPos)
 	//UVIDs: Hält die entsprechende UVId des UVSets, wenn in einem Set keine UVs vorhanden sind für das betreffende Face, dann ist UVIDs[x] == -1
 
 	//ITERATOREN
-	std::list<MFloatArray>::iterator UIter = Us->begin();
-	std::list<MFloatArray>::iterator VIter = Vs->begin();
+	UVPositionSets::iterator UIter = Us.begin();
+	UVPositionSets::iterator VIter = Vs.begin();
 
 	
 	for(UINT i = 0; i < numUVSets; i++)
@@ -1568,8 +1501,8 @@ MIntArray		edgeMeshCreator::createUVs(MIntArray& validator, MFloatArray& UVPos)
 	//erzeugt neue UVID, wenn der validator positiv ist
 
 		//ITERATOREN
-	std::list<MFloatArray>::iterator UIter = Us->begin();
-	std::list<MFloatArray>::iterator VIter = Vs->begin();
+	UVPositionSets::iterator UIter = Us.begin();
+	UVPositionSets::iterator VIter = Vs.begin();
 
 	MIntArray returnValue(numUVSets, -1);
 
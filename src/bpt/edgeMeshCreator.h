@@ -74,9 +74,7 @@ public:
 
 	MPoint	getWingedDisplacedPoint(int wingedVtx, MVector& preMultipliedNormal);
 	
-	MPoint	getVtxPoint(int ID){return (*vtxPoints)[ID];};
-
-	void	setVtxPoint(int ID,MPoint& inPoint){ (*vtxPoints)[ID] = inPoint;};
+	void	setVtxPoint(int ID,MPoint& inPoint){ topo.setPoint(ID, inPoint.x, inPoint.y, inPoint.z);};
 
 	void	getFaceNormal(int faceID, MVector& inNormal);
 
@@ -112,7 +110,7 @@ public:
 
 	int		addWingedDisplacedVtx(int wingedVtx, MVector& preMultipliedNormal);
 
-	void	removeLastVtxPoint(){vtxPoints->remove(vtxPoints->length() - 1);};
+	void	removeLastVtxPoint(){topo.removeLastVertex();};
 
 
 	void	updateFaceData(edgeFaceData* faceData);
@@ -28,7 +28,7 @@
 // Construction/Destruction
 //////////////////////////////////////////////////////////////////////
 //--------------------------------------------------------------------------------------------------------------------
-face::face(MIntArray inVtx,int inID):vtx(inVtx),clean(false),id(inID)
+face::face(meshCreator* inCreator,MIntArray inVtx,int inID):creator(inCreator),vtx(inVtx),clean(false),id(inID)
 //--------------------------------------------------------------------------------------------------------------------
 {
 	for(int i = 0; i < 20;i++)
@@ -41,8 +41,9 @@ face::face(MIntArray inVtx,int inID):vtx(inVtx),clean(false),id(inID)
 	}
 }
 //--------------------------------------------------------------------------------------------------------------------
-face::face(MIntArray inVtx,MIntArray inCorners,MIntArray inNachbarIDs, int inID)
-: vtx(inVtx)
+face::face(meshCreator* inCreator,MIntArray inVtx,MIntArray inCorners,MIntArray inNachbarIDs, int inID)
+: creator(inCreator)
+, vtx(inVtx)
 , corners(inCorners)
 , nachbarIDs(inNachbarIDs)
 , clean(false)
@@ -65,7 +66,6 @@ face::~face()
 
 }
 
-meshCreator* face::creator = 0;
 
 
 //--------------------------------------------------------------------------
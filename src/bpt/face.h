@@ -51,9 +51,9 @@ namespace BPT
 class face  
 {
 public:
-	face(){};
-	face(MIntArray inVtx,int inID);
-	face(MIntArray inVtx,MIntArray inCorners,MIntArray inNachbarIDs,int inID);
+	face():creator(0){};
+	face(meshCreator* inCreator,MIntArray inVtx,int inID);
+	face(meshCreator* inCreator,MIntArray inVtx,MIntArray inCorners,MIntArray inNachbarIDs,int inID);
 	virtual ~face();
 
 
@@ -102,10 +102,10 @@ public:
 
 public:
 //-------------------------------------
-//STATISCHE ELEMENTE
+//OPERATIONSKONTEXT
 //-------------------------------------
 //
-	static	meshCreator*	creator;	//!< ist bei allen Faces gleich, wird mit 0 initialisiert
+	meshCreator*	creator;	//!< ist bei allen Faces einer Operation gleich, wird bei der Konstruktion uebergeben
 
 
 
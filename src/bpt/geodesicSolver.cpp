@@ -0,0 +1,220 @@
+/*
+ * Copyright (C) 2002 Sebastian Thiel
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ */
+
+#include "geodesicSolver.h"
+
+#include <algorithm>
+#include <math.h>
+
+
+using namespace BPT;
+
+
+//-----------------------------------------------------------------------------------------
+geodesicSolver::geodesicSolver()
+: labelOffsets(1, 0)
+, stride(1)
+//-----------------------------------------------------------------------------------------
+{
+}
+
+
+//-----------------------------------------------------------------------------------------
+void	geodesicSolver::clear()
+//-----------------------------------------------------------------------------------------
+{
+	reached.clear();
+	labelOffsets.assign(1, 0);
+	labels.clear();
+}
+
+
+//-----------------------------------------------------------------------------------------
+bool	geodesicSolver::improve(int vtx, double distance, int source)
+//-----------------------------------------------------------------------------------------
+{
+	label*			first = &best[ (size_t)vtx * stride ];
+	const unsigned	n = numBest[vtx];
+
+	unsigned j;
+	for( j = 0; j < n && first[j].second != source; j++ ) {}
+
+
+	if( j < n )
+	{
+		// Die Quelle ist schon eingetragen - endgueltige Labels sind nie groesser als ein neuer Kandidat
+		if( distance >= first[j].first )
+			return false;
+	}
+	else if( n < stride )
+	{
+		j = numBest[vtx]++;
+	}
+	else
+	{
+		// Voll - nur das schlechteste, noch nicht endgueltige Label darf verdraengt werden
+		if( numSettled[vtx] == n || distance >= first[n-1].first )
+			return false;
+
+		j = n - 1;
+	}
+
+
+	// Einsortieren - die endgueltigen Labels am Anfang werden dabei nie ueberholt
+	while( j > 0 && first[j-1].first > distance )
+	{
+		first[j] = first[j-1];
+		j--;
+	}
+
+	first[j] = label(distance, source);
+
+	return true;
+}
+
+
+//-----------------------------------------------------------------------------------------
+void	geodesicSolver::solve(	unsigned numVertices,
+								const unsigned* offsets,
+								const int* neighbours,
+								const double* positions,
+								const int* sources,
+								unsigned numSources,
+								double radius,
+								unsigned maxLabels )
+//-----------------------------------------------------------------------------------------
+{
+	clear();
+
+	if( numVertices == 0 || numSources == 0 || maxLabels == 0 || radius < 0.0 )
+		return;
+
+	// Die Zahl der Labels wird in einem Byte gezaehlt
+	stride = std::min(maxLabels, 255u);
+
+
+	heap.clear();
+
+	best.resize( (size_t)numVertices * stride );
+	numBest.assign(numVertices, 0);
+	numSettled.assign(numVertices, 0);
+
+
+	// Die Quellen haben die Distanz 0 zu sich selbst
+	unsigned s;
+	for( s = 0; s < numSources; s++ )
+	{
+		if( sources[s] < 0 || (unsigned)sources[s] >= numVertices )
+			continue;
+
+		if( !improve(sources[s], 0.0, (int)s) )
+			continue;
+
+		candidate c;
+		c.distance = 0.0;
+		c.vtx = sources[s];
+		c.source = (int)s;
+
+		heap.push_back(c);
+	}
+
+	std::make_heap(heap.begin(), heap.end());
+
+
+	while( !heap.empty() )
+	{
+		std::pop_heap(heap.begin(), heap.end());
+		const candidate c = heap.back();
+		heap.pop_back();
+
+		const int v = c.vtx;
+
+
+		// Veraltete Eintraege verwerfen - der Kandidat muss noch unter den besten Labels stehen. Da der Heap nach
+		// Distanz geordnet ist, ist er dann das kleinste noch nicht endgueltige Label (bis auf gleich lange)
+		label*			first = &best[ (size_t)v * stride ];
+		const unsigned	settledCount = numSettled[v];
+
+		unsigned j;
+		for( j = settledCount; j < numBest[v] && first[j].first == c.distance; j++ )
+		{
+			if( first[j].second == c.source )
+				break;
+		}
+
+		if( j == numBest[v] || first[j].first != c.distance || first[j].second != c.source )
+			continue;
+
+		std::swap( first[j], first[settledCount] );
+
+
+		// Das Label ist jetzt endgueltig
+		if( settledCount == 0 )
+			reached.push_back(v);		// Reihenfolge des ersten Labels == Reihenfolge der naechsten Distanz
+
+		numSettled[v]++;
+
+
+		// Nachbarn relaxieren
+		const double* pv = positions + 3 * v;
+
+		for( unsigned i = offsets[v]; i < offsets[v+1]; i++ )
+		{
+			const int n = neighbours[i];
+
+			if( numSettled[n] >= stride )
+				continue;
+
+			const double* pn = positions + 3 * n;
+			const double dx = pn[0] - pv[0], dy = pn[1] - pv[1], dz = pn[2] - pv[2];
+
+			const double d = c.distance + sqrt(dx*dx + dy*dy + dz*dz);
+
+			if( d > radius || !improve(n, d, c.source) )
+				continue;
+
+			candidate nc;
+			nc.distance = d;
+			nc.vtx = n;
+			nc.source = c.source;
+
+			heap.push_back(nc);
+			std::push_heap(heap.begin(), heap.end());
+
+		}// for each neighbour
+
+	}
+
+
+	// Ergebnis kompakt ablegen - am Ende sind alle Labels in best endgueltig und aufsteigend sortiert
+	const unsigned numReached = (unsigned)reached.size();
+
+	labelOffsets.resize(numReached + 1);
+	labels.clear();
+
+	for( unsigned r = 0; r < numReached; r++ )
+	{
+		const int		v = reached[r];
+		const label*	first = &best[ (size_t)v * stride ];
+
+		labelOffsets[r] = (unsigned)labels.size();
+		labels.insert( labels.end(), first, first + numSettled[v] );
+	}
+
+	labelOffsets[numReached] = (unsigned)labels.size();
+}
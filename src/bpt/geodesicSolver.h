@@ -0,0 +1,110 @@
+/*
+ * Copyright (C) 2002 Sebastian Thiel
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ */
+
+#ifndef GEODESIC_SOLVER_INCLUDE
+#define GEODESIC_SOLVER_INCLUDE
+
+// Absichtlich ohne Maya Includes - der Solver arbeitet nur auf rohen Arrays, damit er auch ausserhalb
+// von Maya (zum Beispiel im Benchmark) verwendet werden kann
+
+#include <vector>
+#include <utility>
+
+
+namespace BPT
+{
+
+/** Berechnet Oberflaechendistanzen von mehreren Quellvertizen aus, begrenzt auf einen Radius.
+
+	Es handelt sich um einen Dijkstra mit mehreren Labels pro Vertex: jeder Vertex erhaelt die Distanzen zu den
+	maxLabels naechsten Quellen, jede Quelle hoechstens einmal. Ein Kandidat kommt nur in den Heap, wenn er eines
+	der maxLabels besten Labels des Vertex verbessert - so bleibt der Heap klein, auch bei vielen Quellen.
+
+	Die Kantenlaengen sind die euklidischen Abstaende der Nachbarn - mit der Nachbarschaft ueber die Faces
+	(vertexAdjacency) sind also auch die Diagonalen enthalten.
+
+	Die Nachbarschaft wird wie bei vertexAdjacency uebergeben: die Nachbarn von v liegen in
+	neighbours[ offsets[v] ] bis neighbours[ offsets[v+1] - 1 ].
+*/
+
+class geodesicSolver
+{
+public:
+
+	typedef std::pair<double, int>	label;		//!< Distanz und Index der Quelle im sources Array
+
+	geodesicSolver();
+
+	//! Berechnet die Distanzen. positions enthaelt xyz pro Vertex, sources die VertexIDs der Quellen.
+	//! Vertizen, die weiter als radius von allen Quellen entfernt sind, werden nicht erreicht
+	void	solve(	unsigned numVertices,
+					const unsigned* offsets,
+					const int* neighbours,
+					const double* positions,
+					const int* sources,
+					unsigned numSources,
+					double radius,
+					unsigned maxLabels );
+
+	//! Zahl der erreichten Vertizen
+	unsigned	numReached() const { return (unsigned)reached.size(); }
+
+	//! i-ter erreichter Vertex - die Vertizen sind aufsteigend nach der Distanz zu ihrer naechsten Quelle sortiert
+	int			vertex(unsigned i) const { return reached[i]; }
+
+	//! Labels des i-ten erreichten Vertex, aufsteigend nach Distanz sortiert
+	const label*	labelsBegin(unsigned i) const { return &labels[0] + labelOffsets[i]; }
+	const label*	labelsEnd(unsigned i) const { return &labels[0] + labelOffsets[i+1]; }
+
+	void	clear();
+
+private:
+
+	//! Eintrag der PriorityQueue
+	struct	candidate
+	{
+		double	distance;
+		int		vtx;
+		int		source;
+
+		// umgekehrt, damit der std::heap die kleinste Distanz oben hat
+		bool	operator < (const candidate& rhs) const { return distance > rhs.distance; }
+	};
+
+	//! Traegt (distance, source) in die besten Labels von vtx ein - gibt false zurueck, wenn es keine Verbesserung ist
+	bool	improve(int vtx, double distance, int source);
+
+private:
+
+	// Ergebnis
+	std::vector<int>		reached;
+	std::vector<unsigned>	labelOffsets;	//!< numReached() + 1 Eintraege
+	std::vector<label>		labels;
+
+	// Arbeitsspeicher - bleibt zwischen den Aufrufen erhalten, damit nicht jedesmal neu alloziert werden muss
+	std::vector<candidate>		heap;
+	std::vector<label>			best;			//!< pro Vertex maxLabels Plaetze: die besten bisher gefundenen Labels, aufsteigend
+	std::vector<unsigned char>	numBest;		//!< pro Vertex belegte Plaetze in best
+	std::vector<unsigned char>	numSettled;		//!< pro Vertex endgueltige Labels - sie sind immer der Anfang von best
+
+	unsigned	stride;							//!< maxLabels des laufenden solve
+};
+
+}
+
+#endif
@@ -22,6 +22,8 @@
 
 #include "meshCreator.h"
 
+#include <algorithm>
+
 
 
 //////////////////////////////////////////////////////////////////////
@@ -41,32 +43,11 @@ meshCreator::meshCreator(	MObject&		fMesh,
 , polyIter(fMesh)
 , meshFn(fMesh)
 
-, minID(999999999)
-, maxID(0)
-, nMinID(999999999)
-, nMaxID(0)
-
 , slide(inSlide)
 
-, deallocUVs(true)
-
 																	
 {
 //-----------------------------------------------------------------------------------------------------------------
-//----------------------
-//MESHARRAYS ERZEUGEN
-//----------------------
-
-
-	vtxPoints = new MPointArray();
-	offsets = new MIntArray();
-	offsetsAbsolute = new MIntArray();
-	faceVtxIDs = new MIntArray();
-
-	offsetsLUT = new MIntArray();
-	offsetsLUTValues = new MIntArray();
-
-
 //----------------------
 //SLIDE ARRAYS ERZEUGEN
 //----------------------
@@ -120,52 +101,37 @@ meshCreator::meshCreator(	MObject&		fMesh,
 	UINT				count = 0;
 	int					tmp = 0;
 	MIntArray			vertIDs;
+	MPointArray			points;
 	
 
 //	alle Punkte holen	
-	meshFn.getPoints(*vtxPoints);
+	meshFn.getPoints(points);
 	
+	int polyCount = polyIter.count();
+
+	//Speicher fuer das Mesh vorab holen, damit beim Aufbau nicht umkopiert werden muss
+	topo.reserve(points.length(), polyCount, meshFn.numFaceVertices());
+
+	for(UINT i = 0; i < points.length(); i++)
+		topo.addVertex(points[i].x, points[i].y, points[i].z);
 
 	
 	//-1, da Vtx count 0 based ist
-	initialVtxCount = vtxPoints->length() - 1;
+	initialVtxCount = topo.numVertices() - 1;
 
 	ULONG incrementSize = ULONG(initialVtxCount / 8);	//1/8 der vtxZahl ist das default Increment, um das ständige umkopieren der Arrays zu vermeiden
 														//bei append
-	vtxPoints->setSizeIncrement(incrementSize);
 	
 	//ARRAYS müssen nicht zurückgesetzt werden, da meshCreator eh nicht dauerhaft existiert
 	
 
-
-	int polyCount = polyIter.count();
-	
-	//arrayGroesse anpassen, um effizienter zu sein
-	offsets->setLength(polyCount);
-	offsetsAbsolute->setLength(polyCount);
-
-	//damit nicht wegen  jedem append eine Reallocation vorgenommen werden muss
-	faceVtxIDs->setSizeIncrement(incrementSize);
-	
-	unsigned int x = 0;	//counter für zuweisung der Daten zu offsetArrays
-
 	for(;!polyIter.isDone();polyIter.next())
 	{
 		polyIter.getVertices(vertIDs);
-
-		tmp = vertIDs.length();
-
-		(*offsets)[x] = tmp;
-		(*offsetsAbsolute)[x++] = count;
-
-		count += tmp;
-		
-		helper.addIntArrayToLHS(*faceVtxIDs,vertIDs);
-
+		appendFace(vertIDs);
 	}
 	
-	offsets->setSizeIncrement(incrementSize);
-	offsetsAbsolute->setSizeIncrement(incrementSize);
+	normalOffsetIndex.reserve(polyCount);
 	//UVs und normalen extrahieren
 	
 
@@ -182,18 +148,6 @@ meshCreator::meshCreator(	MObject&		fMesh,
 	standardFloat.setSizeIncrement(incrementSize);
 	standardVec.setSizeIncrement(incrementSize);
 	
-	Us = new list<MFloatArray>();
-	Vs = new list<MFloatArray>();
-	
-	UVCounts =  new list<MIntArray>();
-	UVperVtx = new list<MIntArray>();
-	UVoffsetsLUT = new list<MIntArray>();
-	UVoffsetsLUTValues = new list<MIntArray>();
-	
-	UVAbsOffsets = new list<MIntArray>();
-	
-	
-	
 	UVSlideDirections = new list<MFloatVectorArray>();
 	UVSlideStart = new list<MFloatVectorArray>();
 	UVSlideEnd = new list<MFloatVectorArray>();
@@ -214,17 +168,17 @@ meshCreator::meshCreator(	MObject&		fMesh,
 	//DEBUG !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
 
 	
-	UVMin.setLength(numUVSets);	//werden während der initialisierung gesetzt
-	UVMax.setLength(numUVSets);
-	//initialisieren
-	UINT i;
-	for(i = 0; i < numUVSets; i++)
-	{
-		UVMin[i] = 999999999;
-		UVMax[i] = 0;
-	}
+	UVOffsetIndex.resize(numUVSets);
+
+	//vorher reservieren - sonst wuerde der vector beim Wachsen alle bisherigen Arrays kopieren
+	Us.reserve(numUVSets);
+	Vs.reserve(numUVSets);
+	UVCounts.reserve(numUVSets);
+	UVperVtx.reserve(numUVSets);
+	UVAbsOffsets.reserve(numUVSets);
 	
 	
+	UINT i;
 	for(i = 0; i < numUVSets;i++)
 	{
 		MFloatArray tUs;
@@ -245,8 +199,8 @@ meshCreator::meshCreator(	MObject&		fMesh,
 		INVIS(cout<<"Num UVs: "<<tUs.length()<<endl;);
 		
 		
-		Us->push_back(tUs);
-		Vs->push_back(tVs);
+		Us.push_back(tUs);
+		Vs.push_back(tVs);
 		
 		
 		
@@ -254,11 +208,10 @@ meshCreator::meshCreator(	MObject&		fMesh,
 		meshFn.getAssignedUVs(tUVCounts,tUVs);
 		
 		
-		UVCounts->push_back(tUVCounts);
-		UVperVtx->push_back(tUVs);
+		UVCounts.push_back(tUVCounts);
+		UVperVtx.push_back(tUVs);
 		
-		UVoffsetsLUT->push_back(standardInt);
-		UVoffsetsLUTValues->push_back(standardInt);
+		UVOffsetIndex[i].reserve(polyCount);
 		
 		
 		
@@ -291,7 +244,7 @@ meshCreator::meshCreator(	MObject&		fMesh,
 			tmp += tUVCounts[x];
 		}
 		
-		UVAbsOffsets->push_back(tAbsOffsets);
+		UVAbsOffsets.push_back(tAbsOffsets);
 		
 		
 		
@@ -313,10 +266,6 @@ meshCreator::meshCreator(	MObject&		fMesh,
 	
 	normalAbsOffsets.setSizeIncrement(incrementSize);	
 	
-	//diese Beiden Arrays bleiben erstmal 0
-	normalOffsetsLUT.setSizeIncrement(incrementSize);	
-	normalOffsetsLUTValues.setSizeIncrement(incrementSize);
-	
 	
 	
 	
@@ -410,33 +359,7 @@ meshCreator::~meshCreator()
 {
 //memory cleanup
 
-	//mesh loeschen
-	delete vtxPoints;
-	delete offsets;
-	delete offsetsAbsolute;
-	delete faceVtxIDs;
-
-	delete offsetsLUT;
-	delete offsetsLUTValues;
-
-
-
-		if(deallocUVs)
-		{//diese Daten werden eventuell von aussen benutzt, auch nachdem der meshcreatr zerstoert wurde
-			//deshalb shutz durch flag
-			delete Us;
-			delete Vs;
-
-			delete UVCounts;
-			delete UVperVtx;
-		}
-		
-
-		delete UVoffsetsLUT;
-		delete UVoffsetsLUTValues;
-
-		delete UVAbsOffsets;
-
+		//topo und die UVArrays sind Member und werden automatisch geloescht
 		
 		//slide Arrays werden nie hier zerstoert, sondern von fty selbst
 
@@ -458,7 +381,35 @@ MStatus 	meshCreator::createMesh(MObject& newMeshData)
 	MFnMeshData	FnMeshData;
 
 	newMeshData = FnMeshData.create();
-	meshCreator.create(vtxPoints->length(),offsets->length(), *vtxPoints, *offsets, *faceVtxIDs,newMeshData,&status);
+
+	{
+		std::vector<double>	points;
+		std::vector<int>	counts, connects;
+		topo.getMeshArrays(points, counts, connects);
+
+		//ab hier wird topo nicht mehr gebraucht - sofort freigeben, damit bei grossen meshes nicht mehrere Kopien
+		//gleichzeitig im Speicher liegen. Der creator bleibt gueltig, ist aber leer
+		topo.clear();
+
+		MPointArray	vtxPoints;
+		vtxPoints.setLength(points.size() / 3);
+
+		UINT l = vtxPoints.length();
+		for(UINT i = 0; i < l; i++)
+			vtxPoints[i] = MPoint(points[i * 3], points[i * 3 + 1], points[i * 3 + 2]);
+
+		std::vector<double>().swap(points);
+
+		MIntArray	offsets( counts.empty() ? 0 : &counts[0], (UINT)counts.size() );
+		MIntArray	faceVtxIDs( connects.empty() ? 0 : &connects[0], (UINT)connects.size() );
+
+		std::vector<int>().swap(counts);
+		std::vector<int>().swap(connects);
+
+		meshCreator.create(vtxPoints.length(),offsets.length(), vtxPoints, offsets, faceVtxIDs,newMeshData,&status);
+
+		//MFnMesh hat jetzt seine eigene Kopie - die Arrays hier werden am Ende des Blocks freigegeben
+	}
 	
 	
 	//jetzt die UVs aufs mesh übertragen 
@@ -476,14 +427,18 @@ MStatus 	meshCreator::createMesh(MObject& newMeshData)
 		INVIS(status.perror("UV-PROBLEM, CreateSet"););
 	}	
 	
+	//die Offsets werden nur zum Bearbeiten gebraucht
+	UVIndexSets().swap(UVAbsOffsets);
+	UVBackup.clear();
+	
 	//Iteratoren für UVPositions holen
-	std::list<MFloatArray>::iterator UIter = Us->begin();
-	std::list<MFloatArray>::iterator VIter = Vs->begin();
+	UVPositionSets::iterator UIter = Us.begin();
+	UVPositionSets::iterator VIter = Vs.begin();
 	
 	
 	//Iteratoren für Counts && UVPerVtx holen
-	std::list<MIntArray>::iterator iterCount = UVCounts->begin();
-	std::list<MIntArray>::iterator iterUVIDs = UVperVtx->begin();
+	UVIndexSets::iterator iterCount = UVCounts.begin();
+	UVIndexSets::iterator iterUVIDs = UVperVtx.begin();
 	
 	
 	
@@ -510,7 +465,11 @@ MStatus 	meshCreator::createMesh(MObject& newMeshData)
 		
 	}
 	
-	//Loeschen der UVDaten darf nict hier vorgenommen werden, da sie später vom destruktor der FTY geloescht werden
+	//auch die UVs hat MFnMesh jetzt kopiert
+	UVPositionSets().swap(Us);
+	UVPositionSets().swap(Vs);
+	UVIndexSets().swap(UVCounts);
+	UVIndexSets().swap(UVperVtx);
 	
 	
 	
@@ -529,7 +488,7 @@ MStatus 	meshCreator::createMesh(MObject& newMeshData)
 	MIntArray vertices;
 	MIntArray edges;
 	MIntArray smoothEdgeList;
-	smoothEdgeList.setSizeIncrement(normalOffsetsLUT.length() + 20);	//so dürfte das Array ohne realloc auskommen
+	smoothEdgeList.setSizeIncrement(normalOffsetIndex.length() + 20);	//so dürfte das Array ohne realloc auskommen
 	
 	MFnMesh meshFn(newMeshData,&status);	//hier knnte man eigentlich auch den meshCreator nehmen
 	MItMeshPolygon polyIter(newMeshData);
@@ -650,14 +609,14 @@ MStatus 	meshCreator::createMesh(MObject& newMeshData)
 	if(useUVs)\
 	{\
 		//statistik für UVs drucken//DEBUG
-		std::list<MFloatArray>::iterator UIter= Us->begin();\
-		std::list<MIntArray>::iterator countIter = UVCounts->begin();\
-		std::list<MIntArray>::iterator UVIDsIter = UVperVtx->begin();\
+		UVPositionSets::iterator UIter= Us.begin();\
+		UVIndexSets::iterator countIter = UVCounts.begin();\
+		UVIndexSets::iterator UVIDsIter = UVperVtx.begin();\
 
 		cout<<(*UIter).length()<<" = Länge des UVArrays"<<endl;\
 		cout<<(*countIter).length()<<" = Länge des CountArrays"<<endl;\
 		cout<<UVSetNames.length()<<" = UVSetNames"<<endl;\
-		cout<<faceVtxIDs->length()<<" = FaceVtxIDs"<<endl;\
+		cout<<topo.numFaceVertices()<<" = FaceVtxIDs"<<endl;\
 
 		unsigned int l = (*countIter).length();\
 		int counter = 0;\
@@ -747,28 +706,6 @@ inUVSlideScale = UVSlideScale;
 }
 
 
-//-----------------------------------------------------------------------------------------
-void	meshCreator::getUVData(	list<MFloatArray>*&			inUs,
-								list<MFloatArray>*&			inVs,
-								list<MIntArray>*&			inUVCounts,
-								list<MIntArray>*&			inUVperVtx,
-								MStringArray&				inUVSetNames
-																		)
-//-----------------------------------------------------------------------------------------
-{
-
-	inUs = Us;
-	inVs = Vs;
-
-	inUVCounts = UVCounts;
-	inUVperVtx = UVperVtx;
-
-	inUVSetNames = UVSetNames;
-
-	//in diesem Fall wird dann die procedur, die dir Ptr geholt hat, für die deallokalisiereung verantwortlich
-	//flag wird auf false gesetzt, so dass der Creator das nicht mehr macht
-	deallocUVs = false;
-}
 																		
 //---------------------------------------------------------------------------------------------------------------------------------
 void	meshCreator::addSlide(int vtxID,MPoint startPos,MPoint endPos, MVector& direction, MVector& normal, double normalScaleValue)
@@ -791,7 +728,7 @@ void	meshCreator::addNormalSlide(int vtxID, MVector& normal,double normalScaleVa
 //---------------------------------------------------------------------------------------------------------------------------------
 {
 	slideIndices->append(vtxID);
-	slideStartPoints->append((*vtxPoints)[vtxID]);
+	slideStartPoints->append(getVtxPoint(vtxID));
 	slideNormals->append(normal);
 	normalScale->append(normalScaleValue);
 	
@@ -811,16 +748,13 @@ void	meshCreator::getFaceVtxIDs(int faceID, MIntArray& array) const
 //-----------------------------------------------------------
 {
 	
-	int offset = getValidAbsoluteOffset(faceID);
-	int count = offset + (*offsets)[faceID];
+	const int*	faceVtx = topo.faceBegin(faceID);
+	UINT		count = topo.faceVertexCount(faceID);
 	
-	array.setLength((*offsets)[faceID]);	//nun hat das Array garantiert genug slots zum halten der Infos
-											//so dass beim append kein realloc gemacht wird
+	array.setLength(count);
 
-	array.clear();							//vohandene Einträge logisch loeschen
-	
-	for(int i = offset; i < count; i++)
-		array.append( (*faceVtxIDs)[i]);
+	for(UINT i = 0; i < count; i++)
+		array[i] = faceVtx[i];
 
 
 }
@@ -831,8 +765,7 @@ void	meshCreator::getFaceVtxIDs(int faceID, MIntArray& array) const
 int		meshCreator::newVtx(MPoint position)
 //-----------------------------------------------------------------
 {
-	vtxPoints->append(position);
-	return (vtxPoints->length() - 1);
+	return topo.addVertex(position.x, position.y, position.z);
 }
 
 
@@ -846,20 +779,7 @@ int		meshCreator::createCenterVtx(int faceID)
 	//polyIter.setIndex(faceID,tmp);
 	//MPoint centerPos = polyIter.center();
 
-	MPoint centerPos;
-	MIntArray faceVtx;
-	getFaceVtxIDs(faceID,faceVtx);
-
-	unsigned int l = faceVtx.length();
-	for(unsigned int i = 0; i < l; i++)
-		centerPos += (*vtxPoints)[faceVtx[i]];
-
-	centerPos = centerPos / l;
-	
-	vtxPoints->append(centerPos);
-	
-
-	return vtxPoints->length() - 1;
+	return topo.createCenterVertex(faceID);
 }
 
 
@@ -1017,10 +937,7 @@ int 	meshCreator::doFaceOneSplit(int faceID,
 					int middleLeft = vtxMatch.length() / 2 - 1;
 					int middleRight = middleLeft + 1;		//alles locIDs
 					
-					MVector dir = (*vtxPoints)[vtxMatch[middleRight]] - (*vtxPoints)[vtxMatch[middleLeft]];
-					
-					vtxPoints->append( (*vtxPoints)[vtxMatch[middleLeft]] + slide * dir);
-					int newID = vtxPoints->length() - 1;
+					int newID = topo.newVertexBetween(vtxMatch[middleLeft], vtxMatch[middleRight], slide);
 					
 					//jetzt newID in verts eintragen und locID in newIDs
 					int l2 = verts.length();
@@ -1274,13 +1191,7 @@ int		meshCreator::newVtxBetweenIDs(int startID,int endID,int currentFace,bool us
 		mySlide = slide;
 	//!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
 	//Slide ist immer relativ zum startVtx. Wenn das anders sein soll, muss man bei der AgumentUEbergabe Start/EndVtxID vertauschen
-	MPoint start = (*vtxPoints)[startID];
-	MPoint end = (*vtxPoints)[endID];
-	MVector direction = end - start;
-
-	vtxPoints->append( start + mySlide * direction );
-
-	newID = vtxPoints->length() - 1;
+	newID = topo.newVertexBetween(startID, endID, mySlide);
 
 
 	
@@ -1409,7 +1320,7 @@ void	meshCreator::getVtxPositions(const MIntArray& vtxList, MPointArray& pointsR
 
 	for(; i < l; i++)
 	{
-		pointsResult[i] = (*vtxPoints)[vtxList[i]];
+		pointsResult[i] = getVtxPoint(vtxList[i]);
 	}
 
 }
@@ -1663,15 +1574,13 @@ void	meshCreator::createUV(int			currentFace,
 	//dies wird nur von doFaceOneSplit so benoetigt
 
 	//iteratoren
-	std::list<MIntArray>::iterator iterCounts			= UVCounts->begin();
-	std::list<MIntArray>::iterator iterOffset			= UVAbsOffsets->begin();
-	std::list<MIntArray>::iterator iterLUT				= UVoffsetsLUT->begin();
-	std::list<MIntArray>::iterator iterLUTValues		= UVoffsetsLUTValues->begin();
-	std::list<MIntArray>::iterator iterUVperVtx			= UVperVtx->begin();
+	UVIndexSets::iterator iterCounts			= UVCounts.begin();
+	UVIndexSets::iterator iterOffset			= UVAbsOffsets.begin();
+	UVIndexSets::iterator iterUVperVtx			= UVperVtx.begin();
 
 	
-	std::list<MFloatArray>::iterator iterUPos			= Us->begin();
-	std::list<MFloatArray>::iterator iterVPos			= Vs->begin();
+	UVPositionSets::iterator iterUPos			= Us.begin();
+	UVPositionSets::iterator iterVPos			= Vs.begin();
 
 
 	std::list<MIntArray>::iterator iterSlideIDs			= UVSlideIndices->begin();
@@ -1745,7 +1654,7 @@ void	meshCreator::createUV(int			currentFace,
 		if(counts[currentFace])
 		{//wenn UVs, dann bearbeiten
 			MIntArray faceUVs;
-			getFaceUVs(currentFace,faceUVs,i,iterOffset,iterLUT,iterLUTValues,iterCounts,iterUVperVtx);
+			getFaceUVs(currentFace,faceUVs,i,iterOffset,iterCounts,iterUVperVtx);
 
 			INVIS(cout<<endl<<endl;);
 			INVIS(for(unsigned int u = 0; u < faceUVs.length(); u++))
@@ -1859,8 +1768,6 @@ void	meshCreator::createUV(int			currentFace,
 		++iterVPos;
 		++iterCounts;
 		++iterOffset;
-		++iterLUT;
-		++iterLUTValues;
 		++iterUVperVtx;
 
 		++iterSlideIDs;
@@ -1888,15 +1795,13 @@ void	meshCreator::checkForUV(int thisFaceID,
  //useSlide wird benoetigt, wenn diese Prozedur doch einen Vtx erzeugen muss, welcher dann natürlich einen eigenen slide benoetigt
  //wenn noetig
 
-	std::list<MIntArray>::iterator iterCounts		=		UVCounts->begin();
-	std::list<MIntArray>::iterator iterOffset		=		UVAbsOffsets->begin();
-	std::list<MIntArray>::iterator iterLUT			=		UVoffsetsLUT->begin();
-	std::list<MIntArray>::iterator iterLUTValues	=		UVoffsetsLUTValues->begin();
+	UVIndexSets::iterator iterCounts		=		UVCounts.begin();
+	UVIndexSets::iterator iterOffset		=		UVAbsOffsets.begin();
 	
-	std::list<MIntArray>::iterator iterUVperVtx		=		UVperVtx->begin();
+	UVIndexSets::iterator iterUVperVtx		=		UVperVtx.begin();
 
-	std::list<MFloatArray>::iterator iterUPos		=		Us->begin();
-	std::list<MFloatArray>::iterator iterVPos		=		Vs->begin();
+	UVPositionSets::iterator iterUPos		=		Us.begin();
+	UVPositionSets::iterator iterVPos		=		Vs.begin();
 
 
 
@@ -1951,7 +1856,7 @@ void	meshCreator::checkForUV(int thisFaceID,
 		if(counts[thisFaceID])
 		{//wenn UVs, dann bearbeiten
 			
-			getFaceUVs(thisFaceID,thisFaceUVs,i,iterOffset,iterLUT,iterLUTValues,iterCounts,iterUVperVtx);
+			getFaceUVs(thisFaceID,thisFaceUVs,i,iterOffset,iterCounts,iterUVperVtx);
 
 		}
 		else	//hat keine UVs, also nächste Iteration starten
@@ -1961,7 +1866,7 @@ void	meshCreator::checkForUV(int thisFaceID,
 		if(counts[otherFaceID])
 		{
 
-			getFaceUVs(otherFaceID,otherFaceUVs,i,iterOffset,iterLUT,iterLUTValues,iterCounts,iterUVperVtx);
+			getFaceUVs(otherFaceID,otherFaceUVs,i,iterOffset,iterCounts,iterUVperVtx);
 
 		}
 		
@@ -2069,8 +1974,6 @@ void	meshCreator::checkForUV(int thisFaceID,
 		++iterVPos;
 		++iterCounts;
 		++iterOffset;
-		++iterLUT;
-		++iterLUTValues;
 		++iterUVperVtx;
 
 
@@ -2110,15 +2013,13 @@ void	meshCreator::addUVSlide(int slideAbsVtx, int startAbsVtxID,int endAbsVtxID,
 
 	//diese procedur fügt sliding entsprechend der übergebenen parameter zu den UVS hinzu.
 	
-	std::list<MIntArray>::iterator iterCounts		=		UVCounts->begin();
-	std::list<MIntArray>::iterator iterOffset		=		UVAbsOffsets->begin();
-	std::list<MIntArray>::iterator iterLUT			=		UVoffsetsLUT->begin();
-	std::list<MIntArray>::iterator iterLUTValues	=		UVoffsetsLUTValues->begin();
+	UVIndexSets::iterator iterCounts		=		UVCounts.begin();
+	UVIndexSets::iterator iterOffset		=		UVAbsOffsets.begin();
 	
-	std::list<MIntArray>::iterator iterUVperVtx		=		UVperVtx->begin();
+	UVIndexSets::iterator iterUVperVtx		=		UVperVtx.begin();
 
-	std::list<MFloatArray>::iterator iterUPos		=		Us->begin();
-	std::list<MFloatArray>::iterator iterVPos		=		Vs->begin();
+	UVPositionSets::iterator iterUPos		=		Us.begin();
+	UVPositionSets::iterator iterVPos		=		Vs.begin();
 
 
 
@@ -2136,7 +2037,7 @@ void	meshCreator::addUVSlide(int slideAbsVtx, int startAbsVtxID,int endAbsVtxID,
 		if(counts[faceID])
 		{
 			MIntArray faceUVs;
-			getFaceUVs(faceID,faceUVs,i,iterOffset,iterLUT,iterLUTValues,iterCounts,iterUVperVtx);
+			getFaceUVs(faceID,faceUVs,i,iterOffset,iterCounts,iterUVperVtx);
 
 			MIntArray faceVtx;
 			getFaceVtxIDs(faceID,faceVtx);
@@ -2223,8 +2124,6 @@ void	meshCreator::addUVSlide(int slideAbsVtx, int startAbsVtxID,int endAbsVtxID,
 		++iterVPos;
 		++iterCounts;
 		++iterOffset;
-		++iterLUT;
-		++iterLUTValues;
 		++iterUVperVtx;
 
 
@@ -2248,11 +2147,9 @@ void	meshCreator::getFaceUVs(int faceID, MIntArray& UVIDs,bool UVRelOffsets[]) c
 	UVIDs.clear();
 	
 	//iteratoren
-	std::list<MIntArray>::iterator iterCounts			= UVCounts->begin();
-	std::list<MIntArray>::iterator iterOffset			= UVAbsOffsets->begin();
-	std::list<MIntArray>::iterator iterLUT				= UVoffsetsLUT->begin();
-	std::list<MIntArray>::iterator iterLUTValues		= UVoffsetsLUTValues->begin();
-	std::list<MIntArray>::iterator iterUVIDs			= UVperVtx->begin();
+	UVIndexSets::iterator iterCounts			= UVCounts.begin();
+	UVIndexSets::iterator iterOffset			= UVAbsOffsets.begin();
+	UVIndexSets::iterator iterUVIDs			= UVperVtx.begin();
 	
 	
 	MIntArray resultTmp;
@@ -2266,7 +2163,7 @@ void	meshCreator::getFaceUVs(int faceID, MIntArray& UVIDs,bool UVRelOffsets[]) c
 		if( UVRelOffsets[i] )
 		{
 			
-			getFaceUVs(faceID, resultTmp, i, iterOffset, iterLUT, iterLUTValues, iterCounts, iterUVIDs);
+			getFaceUVs(faceID, resultTmp, i, iterOffset, iterCounts, iterUVIDs);
 			
 			helper.addIntArrayToLHS(UVIDs, resultTmp);
 			
@@ -2275,8 +2172,6 @@ void	meshCreator::getFaceUVs(int faceID, MIntArray& UVIDs,bool UVRelOffsets[]) c
 		
 		++iterCounts;
 		++iterOffset;
-		++iterLUT;
-		++iterLUTValues;
 		++iterUVIDs;
 		
 		
@@ -2301,8 +2196,8 @@ void	meshCreator::getUVPositions(const MIntArray& UVIds, MFloatArray& UVPos) con
 	//diese Prozedur funktioniert mit beliebiger Zahl von UVs, allerdings nur, wenn deren Zahl pro UVSet nicht vari
 
 	//ITERATOREN
-	std::list<MFloatArray>::iterator UIter = Us->begin();
-	std::list<MFloatArray>::iterator VIter = Vs->begin();
+	UVPositionSets::iterator UIter = Us.begin();
+	UVPositionSets::iterator VIter = Vs.begin();
 
 	UINT l = UVIds.length() / numUVSets;
 
@@ -2341,15 +2236,13 @@ void	meshCreator::getUVPositions(const MIntArray& UVIds, MFloatArray& UVPos) con
 void	meshCreator::getFaceUVs(int faceID,
 								MIntArray& result,
 								int uvSetIndex,
-								std::list<MIntArray>::iterator& iterOffset,
-								std::list<MIntArray>::iterator& iterLUT,
-								std::list<MIntArray>::iterator& iterLUTValues,
-								std::list<MIntArray>::iterator& iterCounts,
-								std::list<MIntArray>::iterator& iterUVIDs) const
+								UVIndexSets::iterator& iterOffset,
+								UVIndexSets::iterator& iterCounts,
+								UVIndexSets::iterator& iterUVIDs) const
 //--------------------------------------------------------------------------------
 {
 
-	int offset = getValidAbsoluteUVOffset(faceID,uvSetIndex,iterOffset,iterLUT,iterLUTValues);
+	int offset = getValidAbsoluteUVOffset(faceID,uvSetIndex,iterOffset);
 	
 	int length = offset + (*iterCounts)[faceID];
 
@@ -2461,8 +2354,8 @@ void	meshCreator::addSlide(int vtxID,
 		normal *= 0;
 
 	//dann die SlideDirection holen
-	MPoint start = (*vtxPoints)[startID];
-	MPoint end = (*vtxPoints)[endID];
+	MPoint start = getVtxPoint(startID);
+	MPoint end = getVtxPoint(endID);
 	MVector direction = end - start;
 
 
@@ -2488,40 +2381,16 @@ void	meshCreator::addVtx(int vtxID,
 	
 	//cout<<"startID: "<<startID<<endl;
 	
-	int aOffset = getValidAbsoluteOffset(faceID);
-	//cout <<"arbeite mit OFfset: "<<aOffset<<endl;
-
 //	jetzt richtige Stelle für neuen Vtx finden und ihn einfügen
-	int l = aOffset + (*offsets)[faceID];
-
-
-
-	
-	//korrekte insertPosition finden
-	for(int i = aOffset; i < l; i++) 
-	{
-		if((*faceVtxIDs)[i] == startID)
-		{
-			if((*faceVtxIDs)[i+1] == endID)
-			{
-				(*faceVtxIDs).insert(vtxID,i+1);
-			}
-			else
-			{
-				(*faceVtxIDs).insert(vtxID,i-1);
-			}
-		}
-	}
-
-
-//	faceVtxCount(relativ) inkrementieren
-	(*offsets)[faceID] = (*offsets)[faceID]++;
+	int start = topo.localIndex(faceID, startID);
+	if(start < 0)
+		return;
 
-	updateOffsetLUT(faceID,1);
+	//folgt endID auf startID, kommt der Vtx dahinter, sonst liegt die Edge vor startID
+	int count = topo.faceVertexCount(faceID);
+	int insertAt = ( topo.faceBegin(faceID)[(start + 1) % count] == endID ) ? start + 1 : start;
 
-//	zum Test alles ausdrucken
-//	for(i = aOffset; i < l+1; i++)
-//		//cout<<faceVtxIDs[i]<<" = id nach bearbeitung"<<endl;
+	topo.insertFaceVertices(faceID, insertAt, &vtxID, 1);
 
 }
 
@@ -2534,15 +2403,7 @@ void	meshCreator::createPoly(MIntArray& vtxIDs)
 	//Diese Methode geht davon aus, dass das VtxArray richtig geordnet
 	//ist und diese Vtx im VtxPointsArray existieren
 
-	(*offsets).append(vtxIDs.length());
-	helper.addIntArrayToLHS(*faceVtxIDs,vtxIDs);
-	
-	//offsetsAbsolute muss nicht verändert werden, da er 
-	//für die MeshCreation nicht benoetigt wird.
-	//er ist nur für reele faces noetig
-	//->DIE ABSOLUTEN OFFSETS WERDEN AUCH FUER NEUE FACES BENÖTIGT, WENN NORMALEN ERSTELLT WERDEN
-	//-->ALSO AUCH ABSOFFSETS AKTUALISIEREN
-	offsetsAbsolute->append( (*offsetsAbsolute)[ offsetsAbsolute->length() - 1 ] + vtxIDs.length() );
+	appendFace(vtxIDs);
 
 	//UVs werden von der aufrufenden Procedur in "Face" erzeugt bzw. die entsprechende methode wird aufgerufen
 	//weil sie unbedingt die ID des original Faces benoetigt
@@ -2553,41 +2414,9 @@ void	meshCreator::createPoly(MIntArray& vtxIDs)
 void	meshCreator::changePolyVtxIDs(int faceID,const MIntArray& localVtxChange)
 //----------------------------------------------------------------------------------------------------------------------------
 {
-	//Jede ID des Faces muss im Array sein
-	int change;
-	MIntArray	a,faceVtx;
-	
-
-	int aOffset = getValidAbsoluteOffset(faceID);
-	
-
-	int l = aOffset + localVtxChange.length();
-
-
-	change =  localVtxChange.length() - (*offsets)[faceID];
-
-	//erstmal neue element erstellen bzw. alte rausschmeissen wenn noetig/moeglich
-	if(change > 0)
-		for(int i = 0; i < change; i++)
-			faceVtxIDs->insert(-1,aOffset);
-	else if(change < 0)
-		for(int i = 0; i > change; i--)	
-			faceVtxIDs->remove(aOffset);
-
-	//jetzt stimmt das VtxArray auf jeden Fall mit der Zahl von VtxChange überein, un man kann die Daten 
-	//übertragen
-	int r = 0;
-	for(int i = aOffset; i < l;i++)
-		(*faceVtxIDs)[i] = localVtxChange[r++];
-
-	//wenn vtcChangeArray groesser/kleiner als original faceVtxCount
-	//dann wird auch der OffsetArray verändert
-
-	if(change != 0)
-	{
-		updateOffsetLUT(faceID,change);
-		(*offsets)[faceID] += change;
-	}
+	//Jede ID des Faces muss im Array sein - waechst das Face, verschiebt topo es ans Ende statt alle folgenden Faces
+	toIDBuffer(localVtxChange);
+	topo.changeFaceVertices(faceID, idBuffer.empty() ? 0 : &idBuffer[0], (UINT)idBuffer.size());
 
 	//UVs werden von der aufrufenden prozedur in Face erstellt über meshCreator
 
@@ -2612,12 +2441,10 @@ void	meshCreator::changeUVIds(int faceID,
 	//wenn append wahr ist, ist ein neues poly erstellt worden und die gefundenen UVs werden angehängt, gearbeitet wird dann allerding nur auf UVBackup
 	//da das originalFace schon verändert wurde
 
-	std::list<MIntArray>::iterator iterCounts		=		UVCounts->begin();
-	std::list<MIntArray>::iterator iterOffset		=		UVAbsOffsets->begin();
-	std::list<MIntArray>::iterator iterLUT			=		UVoffsetsLUT->begin();
-	std::list<MIntArray>::iterator iterLUTValues	=		UVoffsetsLUTValues->begin();
+	UVIndexSets::iterator iterCounts		=		UVCounts.begin();
+	UVIndexSets::iterator iterOffset		=		UVAbsOffsets.begin();
 	
-	std::list<MIntArray>::iterator iterUVIDs		=		UVperVtx->begin();
+	UVIndexSets::iterator iterUVIDs		=		UVperVtx.begin();
 
 
 	
@@ -2648,14 +2475,14 @@ void	meshCreator::changeUVIds(int faceID,
 		if(UVCountArray[faceID] != 0)
 		{
 			
-			int offset = getValidAbsoluteUVOffset(faceID,i,iterOffset,iterLUT,iterLUTValues);
+			int offset = getValidAbsoluteUVOffset(faceID,i,iterOffset);
 			 
 			MIntArray faceUVs;
 			
 
 			if(!append)
 			{
-				getFaceUVs(faceID,faceUVs,i,iterOffset,iterLUT,iterLUTValues,iterCounts,iterUVIDs);
+				getFaceUVs(faceID,faceUVs,i,iterOffset,iterCounts,iterUVIDs);
 				*iterBak = faceUVs;
 			}
 			else
@@ -2786,7 +2613,7 @@ startNextCycle:;
 				//LUT aktualisieren
 				if(change != 0)
 				{
-					updateOffsetUVLUT(faceID,change,i,iterLUT,iterLUTValues);
+					updateOffsetUVLUT(faceID,change,i);
 					(*iterCounts)[faceID] += change;
 				}
 			}
@@ -2804,8 +2631,6 @@ startNextCycle:;
 		++iterCounts;
 		++iterUVIDs;
 		
-		++iterLUT;
-		++iterLUTValues;
 		++iterOffset;
 
 		++iterBak;
@@ -2867,300 +2692,67 @@ double		meshCreator::getFaceSize( const MPointArray& pointList) const
 int		meshCreator::getValidAbsNormalOffset(int faceID) const
 //-----------------------------------------------------------------
 {
-
-	int offset = normalAbsOffsets[faceID];
-	int l = normalOffsetsLUT.length();
-
-
-	if(nMinID > faceID)
-		return offset;
-	
-
-	for(int i = 0;i < l ;i++)
-	{
-		if( normalOffsetsLUT[i] < faceID)
-			offset += normalOffsetsLUTValues[i];			
-	}
-
-	
-
-	return offset;
-
-
-}
-
-//-----------------------------------------------------------------
-int		meshCreator::getValidAbsoluteOffset(int faceID) const
-//-----------------------------------------------------------------
-{
-	int offset = (*offsetsAbsolute)[faceID];
-	int l = offsetsLUT->length();
-
-
-/*	//das hier lohnt sich im grunde nicht
-	if(l == 0)
-	{
-		return offset;
-	}
-	else
-	{*/
-		//wenn faceID vor allen offsets, dann gleich abrechen
-		if(minID > faceID)
-			return offset;
-		
-
-		for(int i = 0;i < l ;i++)
-		{
-			if((*offsetsLUT)[i] < faceID)
-				offset += (*offsetsLUTValues)[i];
-			//else ... hier nicht abbrechen, da die IDs ungeordnet im array sind und später
-			//nochmal eine passende ID kommen kann
-			
-		}
-		
-//	}
-
-
-	return offset;
+	return normalAbsOffsets[faceID] + normalOffsetIndex.sumBefore(faceID);
 }
 
 //-----------------------------------------------------------------
 int		meshCreator::getValidAbsoluteUVOffset(int faceID,
 											  int index,
-											  std::list<MIntArray>::iterator& iterOffset,
-											  std::list<MIntArray>::iterator& iterLUT,
-											  std::list<MIntArray>::iterator& iterLUTValues) const
+											  UVIndexSets::iterator& iterOffset) const
 //-----------------------------------------------------------------
 {
-
-
-	
-	MIntArray& absOffset = *iterOffset;
-	
-
-	int offset = absOffset[faceID];
-	
-	MIntArray& LUT = *iterLUT;
-	unsigned int l = LUT.length();
-
-/*	//lohnt sich nicht
-	if(l == 0)
-	{	
-		return offset;
-	}
-	else
-	{*/
-		if(UVMin[index] > faceID)
-		{
-			return offset;
-		}
-		else
-		{
-			
-			MIntArray& LUTValues = *iterLUTValues;
-
-			for(unsigned i = 0;i < l ;i++)
-			{
-				if(LUT[i] < faceID)
-					offset += LUTValues[i];
-				//else ... hier nicht abbrechen, da die IDs ungeordnet im array sind und später
-				//nochmal eine passende ID kommen kann
-			}
-			
-			return offset;
-			
-		}
-		
-//	}
-		
-		
-	
-	
-	return offset;
+	return (*iterOffset)[faceID] + UVOffsetIndex[index].sumBefore(faceID);
 }
 
 
-//-----------------------------------------------------------------
-void	 meshCreator::updateOffsetLUT(int faceID, int offsetCount)
-//-----------------------------------------------------------------
-{
-
-	//wenn er hier hin kommt, dann sind UVs für faceID vorhanden - dies wird von master Proc gecheckt
-
-	int l = offsetsLUT->length();
-
-
-	
-	//IDBounds setzen
-	if(faceID < minID)
-		minID = faceID;
-	if(faceID > maxID)
-		maxID = faceID;
-	
-
-	
-//	if( (l == 0) || (faceID > maxID))
-	if( (faceID > maxID) )
-	{
-		offsetsLUT->append(faceID);
-		offsetsLUTValues->append(offsetCount);
-		//cout <<"!!Habe erstes LUT element angehängt!!"<<endl;
-		return;
-	}
-	
-	
-	//Eintrag im LUT suchen und offset aktualisieren
-	for(int i = 0; i < l; i++)
-	{
-		if((*offsetsLUT)[i] == faceID)
-		{
-			(*offsetsLUTValues)[i] +=offsetCount;
-
-
-			return;
-		}
-	}	
-
-	offsetsLUT->append(faceID);
-	offsetsLUTValues->append(offsetCount);
-	//cout <<"!!Habe OFFset nich gefunden und deshalb angehängt!!"<<endl;
-
-
-	
-
-}
-
 //-----------------------------------------------------------------
 void	meshCreator::updateNormalOffsetLUT(int faceID, int offsetCount)
 //-----------------------------------------------------------------
 {
-	int l = normalOffsetsLUT.length();
-
-
-	if(faceID < nMinID)
-		nMinID = faceID;
-	if(faceID > nMaxID)
-		nMaxID = faceID;
-	
-	
-	if(faceID > nMaxID)
-	{
-		normalOffsetsLUT.append(faceID);
-		normalOffsetsLUTValues.append(offsetCount);
-
-		return;
-	}
-
-	//Eintrag im LUT suchen und offset aktualisieren
-	for(int i = 0; i < l; i++)
-	{
-		if( normalOffsetsLUT[i] == faceID)
-		{
-			normalOffsetsLUTValues[i] +=offsetCount;
-			return;
-		}
-	}	
-
-	//ansonsten offset anhängen
-	normalOffsetsLUT.append(faceID);
-	normalOffsetsLUTValues.append(offsetCount);
-	
-
-	
-
+	normalOffsetIndex.add(faceID, offsetCount);
 }
 
 //--------------------------------------------------------------------------------
 void	meshCreator::getConnectedFaces(UINT vtxID, MIntArray& connectedFaces) const
 //--------------------------------------------------------------------------------
 {
-	//die verbundenen Vtx herausfinden, indem man durchs CountArray parsed und 
-	//im FaceVtxIndicesArray checkt, ob die übergebene VtxID vorhanden ist
-
-	connectedFaces.clear();
+	//statt jedesmal durch alle Faces zu parsen, baut topo den Index einmal auf und haelt ihn danach aktuell
+	const std::vector<int>& faces = topo.connectedFaces(vtxID);
 
-	UINT l = offsets->length();
-	UINT absOffset = 0;
-	UINT maxLength,x;
+	UINT l = faces.size();
+	connectedFaces.setLength(l);
 
 	for(UINT i = 0; i < l; i++)
-	{
-		maxLength = absOffset + (*offsets)[i];
-
-		for(x = absOffset; x < maxLength;x++)
-		{
-			if((*faceVtxIDs)[x] == (int)vtxID)
-			{//face i beinhaltet vtx, also auf liste setzen und mit nächster iteration in huptschleife weitermachen
-				connectedFaces.append(i);
-				break;
-			}
-
-		}
+		connectedFaces[i] = faces[i];
+}
 
-		absOffset += (*offsets)[i];
-	}
+//--------------------------------------------------------------------------------
+void	meshCreator::toIDBuffer(const MIntArray& vtxIDs)
+//--------------------------------------------------------------------------------
+{
+	UINT l = vtxIDs.length();
+	idBuffer.resize(l);
 
-	return;
+	for(UINT i = 0; i < l; i++)
+		idBuffer[i] = vtxIDs[i];
+}
 
+//--------------------------------------------------------------------------------
+int		meshCreator::appendFace(const MIntArray& vtxIDs)
+//--------------------------------------------------------------------------------
+{
+	toIDBuffer(vtxIDs);
+	return topo.addFace(idBuffer.empty() ? 0 : &idBuffer[0], (UINT)idBuffer.size());
 }
 
 //-----------------------------------------------------------------
 void	 meshCreator::updateOffsetUVLUT(int faceID, 
 										int offsetCount, 
-										int index,
-										std::list<MIntArray>::iterator& iterLUT,
-										std::list<MIntArray>::iterator& iterLUTValues)
+										int index)
 //-----------------------------------------------------------------
 {
 	//wenn er hier hin kommt, dann sind UVs für faceID vorhanden - dies wird von master Proc gecheckt
-
-
-
-	MIntArray* LUT = &(*iterLUT);
-	MIntArray* LUTValues = &(*iterLUTValues);
-
-	int l = LUT->length();
-
-
-	
-	//IDBounds setzen
-	if(faceID < UVMin[index])
-		UVMin[index] = faceID;
-	if(faceID > UVMax[index])
-		UVMax[index] = faceID;
-	
-
-	
-//	if( (l == 0) || (faceID > maxID))
-	if(  faceID > maxID )
-	{
-		LUT->append(faceID);
-		LUTValues->append(offsetCount);
-		
-		return;
-		//cout <<"!!Habe erstes LUT element angehängt!!"<<endl;
-	}
-	else
-	{
-		//Eintrag im LUT suchen und offset aktualisieren
-		for(int i = 0; i < l; i++)
-		{
-			if((*LUT)[i] == faceID)
-			{
-				(*LUTValues)[i] +=offsetCount;
-				//cout <<"!!Habe Offset im array gefunden!!"<<endl;
-				return;
-			}
-		}
-		
-		//wenn nichts gefunden wurde, dann einfach offset anhängen
-		LUT->append(faceID);
-		LUTValues->append(offsetCount);
-			//cout <<"!!Habe OFFset nich gefunden und deshalb angehängt!!"<<endl;
-	
-	
-	}
-
+	UVOffsetIndex[index].add(faceID, offsetCount);
 }
 
 
@@ -24,6 +24,8 @@
 #define AFX_MESHCREATOR_H__847CAC89_2F15_4C0D_8109_3094B92707C6__INCLUDED_
 
 #include "BPT_Helpers.h"
+#include "offsetIndex.h"
+#include "meshTopology.h"
 #include "MACROS.h"
 
 #include <maya/MObject.h>
@@ -50,12 +52,18 @@
 #include <iostream>
 
 #include <list>
+#include <vector>
 using std::list;
 
 
 namespace BPT
 {
 
+//! Ein Eintrag pro UVSet, so wie MFnMesh::setUVs/assignUVs sie nehmen - zusammenhaengend, nicht als Liste
+typedef std::vector<MFloatArray>	UVPositionSets;
+typedef std::vector<MIntArray>		UVIndexSets;
+
+
 /** Der MeshCreator implememtiert die grundlegende funktionalitt, um meshes verndern zu knnen und wird so  nur 
 	von smartSplit genutzt
 
@@ -81,6 +89,10 @@ public:
 //	MESH Extraction/Creation
 /////////////////////////////////////////////
 	//extrahiert wird das Mesh direkt im Konstruktor
+
+	/** Erzeugt das Mesh aus den Arrays des creators und gibt jedes davon frei, sobald MFnMesh es kopiert hat.
+		Danach sind die MeshDaten des creators leer - createMesh muss also das letzte sein, was mit ihm gemacht wird
+	*/
 	MStatus createMesh(MObject& newMeshData);
 
 
@@ -92,15 +104,8 @@ public:
 //
 
 	//*sorgt dafuer, das der initialValue neu definiert wird wird verwendet von der connectEngine
-	void	applyCurrentState(){initialVtxCount = vtxPoints->length() - 1;}		
+	void	applyCurrentState(){initialVtxCount = topo.numVertices() - 1;}		
 
-	void	getUVData(	list<MFloatArray>*&			inUs,
-						list<MFloatArray>*&			inVs,
-						list<MIntArray>*&			inUVCounts,
-						list<MIntArray>*&			inUVperVtx,
-						MStringArray&				inUVSetNames
-																	);
-																
 
 	void	getSlideArrays(MDoubleArray*& inNormalScale,
 							MDoubleArray*& inSlideScale,
@@ -117,8 +122,8 @@ public:
 								list<MFloatVectorArray>*&		inUVSlideDirections,
 								list<MFloatArray>*&				inUVSlideScale);
 
-	int		getLastFaceID() const {return offsets->length()-1;};
-	int		getLastVtxID() const {return vtxPoints->length() -1;};
+	int		getLastFaceID() const {return (int)topo.numFaces() - 1;};
+	int		getLastVtxID() const {return (int)topo.numVertices() - 1;};
 	int		getInitialVtxCount() const {return initialVtxCount;};
 
 public:
@@ -224,11 +229,13 @@ public:
 /////////////////////////////////////////////
 //WERDEN VON AUssERHALB BENUTZT
 //
-	int		getNumFaces() const {return offsets->length();}; 
+	int		getNumFaces() const {return topo.numFaces();}; 
 
 	//* gibt die aktuellen IDs der Vtx
 	void	getFaceVtxIDs(int faceID, MIntArray& array) const;	
 
+	MPoint	getVtxPoint(int vtxID) const { const double* p = topo.point(vtxID); return MPoint(p[0], p[1], p[2]); };
+
 	//*gibt offset zurueck, so dass die Procs ihn nicht doppelt holen muessen
 	void	getFaceNormalIDs(	int			faceID,			
 								MIntArray&	normalIndices) const 
@@ -273,31 +280,29 @@ protected:
 //---------------
 //MESH HELFER
 //---------------
-//Halten die Topologie der MeshDaten korrekt
+//Wandeln zwischen MIntArray und topo um
+
+	//* kopiert vtxIDs nach idBuffer, damit topo sie als int* bekommt
+	void	toIDBuffer(const MIntArray& vtxIDs);
 
-	int		getValidAbsoluteOffset(int faceID) const;
-	void	updateOffsetLUT(int faceID, int offsetCount);
+	//* haengt ein neues Face an und gibt seine ID zurueck
+	int		appendFace(const MIntArray& vtxIDs);
 
 //---------------
 //UV HELFER
 //---------------
 
-	int		getValidAbsoluteUVOffset(int faceID, int index, std::list<MIntArray>::iterator& iterOffset,
-															std::list<MIntArray>::iterator& iterLUT,
-															std::list<MIntArray>::iterator& iterLUTValues) const;
+	int		getValidAbsoluteUVOffset(int faceID, int index, UVIndexSets::iterator& iterOffset) const;
 
-	void	updateOffsetUVLUT(int faceID, int offsetCount, int index, std::list<MIntArray>::iterator& iterLUT,
-																	  std::list<MIntArray>::iterator& iterLUTValues);
+	void	updateOffsetUVLUT(int faceID, int offsetCount, int index);
 
 
 	void	getFaceUVs(	int								faceID,
 						MIntArray&						result,
 						int								uvSetIndex,
-						std::list<MIntArray>::iterator& iterOffset,
-						std::list<MIntArray>::iterator& iterLUT,
-						std::list<MIntArray>::iterator& iterLUTValues,
-						std::list<MIntArray>::iterator& iterCounts,
-						std::list<MIntArray>::iterator& iterUVIDs) const;
+						UVIndexSets::iterator& iterOffset,
+						UVIndexSets::iterator& iterCounts,
+						UVIndexSets::iterator& iterUVIDs) const;
 	
 //---------------
 //NORMAL HELFER
@@ -333,25 +338,17 @@ protected:
 	MFnMesh				meshFn;
 
 //----------------
-//MESH ARRAYS
+//MESH DATEN
 //----------------
-//Arrays fuer MeshDaten - werden sicherheitshalber im Heap erstellt, um stackoverflows bei grossen meshes zu vermeiden
 
-	MPointArray*		vtxPoints;		//!< VTXIds und deren Position							
-	MIntArray*			faceVtxIDs;		//!< Die VtxIDs, so wie sie die Faces definieren		
-	MIntArray*			offsets;		//!< relativer offset(zahl der vtx/face) pro faceID	
-	MIntArray*			offsetsAbsolute;//!< absoluter offset zum finden des richtigen insertpoints fuer neue vtx/zum ndern der vtxNumerierung
+	meshTopology		topo;			//!< Punkte und Faces - auch die Vtx/Face Zuordnung fuer getConnectedFaces
+	std::vector<int>	idBuffer;		//!< Arbeitsspeicher fuer toIDBuffer
 
 	MPlugArray			compPlugs;		//!< speichert die Plugs, welche selectionLists enthalten
 	MObjectArray		compLists;		//!< speichert ComponentListen, sync zu CompPlugs
 	MFnSingleIndexedComponent	compFn;	//!< dient der Bearbeitung der compList Objekte
 	
 
-	MIntArray*		offsetsLUT;			//!< beinhaltet index, an dem vtx hinzufgefuegt/genommen wurde
-	MIntArray*		offsetsLUTValues;	//!< Beinhaltet den Wert zum entsprechenden Slot in offsetsALookUp
-	int				minID;				//!< die kleinste ID im LUT, efizienzsteigerung
-	int				maxID;				//!< die gsste ID usw.
-
 
 //----------------
 //NORMAL ARRAYS
@@ -370,37 +367,26 @@ protected:
 	MIntArray					normalAbsOffsets;	//!< hlt verweise direkt ins normalIndices Array (absolut), (im gegensatz dazu \
 													ist normalCount relativ)
 	
-	MIntArray					normalOffsetsLUT;	//!< beinhaltet index, an dem normale hinzufgefuegt/genommen \
-													wurde (was einhergeht mit faceVtxChanges)
-	
-	MIntArray					normalOffsetsLUTValues; //!< beinhaltet den Wert zum entsprechenden slot im OffsetsLUT (Wieviele Normalen wurden hinzugefuegt?)\
-														synchron zu offsetsLUT
+	offsetIndex					normalOffsetIndex;	//!< Verschiebung der normalAbsOffsets durch hinzugefuegte/entfernte Normalen (was einhergeht mit faceVtxChanges)
 
 
 	MIntArray					normalIndicesBak;	//!< sie werden in den darauf folgenden Appends verwendet
 
-	int							nMinID;			//!< minimale und maximale IDs im Offset LUT - verhindert unsinnige suchen
-	int							nMaxID;
-
 
 //----------------
 //UV ARRAYS
 //----------------
 
 	//UVs
-	list<MFloatArray>*			Us;
-	list<MFloatArray>*			Vs;
+	UVPositionSets				Us;
+	UVPositionSets				Vs;
 	
-	list<MIntArray>*			UVCounts;
-	list<MIntArray>*			UVAbsOffsets;		//!< enthlt die absoluten offsets der UVs zum referenzieren der UVs im
-	list<MIntArray>*			UVperVtx;			//!< eigentlich scheisse benannt: sollte UVIDs heissen, und definiert die UVs pro Face
+	UVIndexSets					UVCounts;
+	UVIndexSets					UVAbsOffsets;		//!< enthlt die absoluten offsets der UVs zum referenzieren der UVs im
+	UVIndexSets					UVperVtx;			//!< eigentlich scheisse benannt: sollte UVIDs heissen, und definiert die UVs pro Face
 
 	
-	MIntArray					UVMin;				//!< verbessert die LUTPerformance im offsets Array
-	MIntArray					UVMax;
-
-	list<MIntArray>*			UVoffsetsLUT;
-	list<MIntArray>*			UVoffsetsLUTValues;
+	std::vector<offsetIndex>	UVOffsetIndex;		//!< Verschiebung der UVAbsOffsets durch hinzugefuegte/entfernte UVs, pro UVSet
 
 
 	list<MIntArray>				UVBackup;			//!< enthlt die originalUVs des faces, welches gerade von changeUVs gendert wurde.\
@@ -446,8 +432,6 @@ protected:
 	int					initialVtxCount;	//!< Anzahl der Vertizen bevor sie bearbeitet wurden.
 
 	//BPT_Helpers			helper;	//hat hilfsprozeduren, und ist ffentlich (dies ist ein reminder )
-
-	bool				deallocUVs;		//!< sollen die UVDaten mit der zerstrung des creators ebenfalls gelscht werden oder soll das jemand anders machen? default = false;
 };
 
 }
@@ -0,0 +1,58 @@
+/*
+ * Copyright (C) 2002 Sebastian Thiel
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ */
+
+#include "meshSnapshot.h"
+
+#include <maya/MFnMesh.h>
+#include <maya/MFnMeshData.h>
+
+
+using namespace BPT;
+
+
+//-----------------------------------------------------------------------------------------
+MStatus		meshSnapshot::capture(const MObject& meshNode)
+//-----------------------------------------------------------------------------------------
+{
+	clear();
+
+	MStatus status;
+
+	MFnMeshData	dataFn;
+	MObject		data = dataFn.create(&status);
+	if( !status )
+		return status;
+
+	//kopiert nur die Meshdaten - es entsteht keine neue Node im DG
+	MFnMesh meshFn;
+	meshFn.copy(meshNode, data, &status);
+	if( !status )
+		return status;
+
+	meshData = data;
+
+	return status;
+}
+
+
+//-----------------------------------------------------------------------------------------
+void		meshSnapshot::clear()
+//-----------------------------------------------------------------------------------------
+{
+	meshData = MObject::kNullObj;
+}
@@ -0,0 +1,61 @@
+/*
+ * Copyright (C) 2002 Sebastian Thiel
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ */
+
+#ifndef MESH_SNAPSHOT_INCLUDE
+#define MESH_SNAPSHOT_INCLUDE
+
+#include <maya/MObject.h>
+#include <maya/MStatus.h>
+
+
+namespace BPT
+{
+
+/** Haelt den Zustand eines Meshes vor einer Operation, damit polyModifierCmd sie ohne History rueckgaengig machen kann.
+
+	capture() kopiert die Meshdaten der Shape direkt in einen MFnMeshData Block - frueher wurde dafuer die ganze
+	Shape dupliziert, ihr outMesh gelesen und die Kopie wieder geloescht.
+
+	Gehalten wird immer die volle Kopie - alle BPT Operationen aendern die Topologie, nur die Punkte zu behalten
+	kaeme also nie in Frage.
+*/
+
+class meshSnapshot
+{
+public:
+
+	meshSnapshot() {}
+
+	//! kopiert das Mesh der Shape - vorherige Daten werden verworfen
+	MStatus		capture(const MObject& meshNode);
+
+	bool		hasMeshData() const { return !meshData.isNull(); }
+
+	//! die Kopie - nur gueltig, wenn hasMeshData()
+	MObject		getMeshData() const { return meshData; }
+
+	void		clear();
+
+private:
+
+	MObject			meshData;		//!< Kopie der Meshdaten, ohne eigene Node im DG
+};
+
+}
+
+#endif
@@ -0,0 +1,308 @@
+/*
+ * Copyright (C) 2002 Sebastian Thiel
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ */
+
+#include "meshTopology.h"
+
+#include <algorithm>
+
+
+using namespace BPT;
+
+
+//-----------------------------------------------------------------------------------------
+void	meshTopology::clear()
+//-----------------------------------------------------------------------------------------
+{
+	//swap statt clear, damit der Speicher wirklich freigegeben wird
+	std::vector<double>().swap(points);
+	std::vector<int>().swap(faceVertices);
+	std::vector<int>().swap(faceCounts);
+	std::vector<int>().swap(faceStarts);
+	std::vector<int>().swap(faceBuffer);
+
+	numLiveFaceVertices = 0;
+	numGarbage = 0;
+
+	vtxFaces.clear();
+}
+
+
+//-----------------------------------------------------------------------------------------
+void	meshTopology::reserve(unsigned numVertices, unsigned numFaces, unsigned numFaceVertices)
+//-----------------------------------------------------------------------------------------
+{
+	points.reserve(numVertices * 3);
+	faceVertices.reserve(numFaceVertices);
+	faceCounts.reserve(numFaces);
+	faceStarts.reserve(numFaces);
+}
+
+
+//-----------------------------------------------------------------------------------------
+int		meshTopology::addVertex(double x, double y, double z)
+//-----------------------------------------------------------------------------------------
+{
+	points.push_back(x);
+	points.push_back(y);
+	points.push_back(z);
+
+	return numVertices() - 1;
+}
+
+
+//-----------------------------------------------------------------------------------------
+void	meshTopology::setPoint(int vtxID, double x, double y, double z)
+//-----------------------------------------------------------------------------------------
+{
+	double* p = &points[vtxID * 3];
+
+	p[0] = x;	p[1] = y;	p[2] = z;
+}
+
+
+//-----------------------------------------------------------------------------------------
+int		meshTopology::addFace(const int* vertices, unsigned count)
+//-----------------------------------------------------------------------------------------
+{
+	const int faceID = numFaces();
+
+	faceStarts.push_back( (int)faceVertices.size() );
+	faceCounts.push_back(count);
+
+	faceVertices.insert(faceVertices.end(), vertices, vertices + count);
+	numLiveFaceVertices += count;
+
+	for( unsigned i = 0; i < count; i++ )
+		vtxFaces.link(vertices[i], faceID);
+
+	return faceID;
+}
+
+
+//-----------------------------------------------------------------------------------------
+void	meshTopology::getFaceVertices(int faceID, std::vector<int>& result) const
+//-----------------------------------------------------------------------------------------
+{
+	const int* begin = faceBegin(faceID);
+
+	result.assign( begin, begin + faceCounts[faceID] );
+}
+
+
+//-----------------------------------------------------------------------------------------
+int		meshTopology::localIndex(int faceID, int vtxID) const
+//-----------------------------------------------------------------------------------------
+{
+	const int* begin = faceBegin(faceID);
+	const int count = faceCounts[faceID];
+
+	for( int i = 0; i < count; i++ )
+	{
+		if( begin[i] == vtxID )
+			return i;
+	}
+
+	return -1;
+}
+
+
+//-----------------------------------------------------------------------------------------
+const std::vector<int>&	meshTopology::connectedFaces(int vtxID) const
+//-----------------------------------------------------------------------------------------
+{
+	if( !vtxFaces.valid() )
+		vtxFaces.build(numVertices(), faceCounts, faceStarts, faceVertices);
+
+	return vtxFaces.faces(vtxID);
+}
+
+
+//-----------------------------------------------------------------------------------------
+void	meshTopology::getMeshArrays(	std::vector<double>& outPoints,
+										std::vector<int>& outCounts,
+										std::vector<int>& outConnects ) const
+//-----------------------------------------------------------------------------------------
+{
+	outPoints = points;
+	outCounts = faceCounts;
+
+	// verschobene Faces liegen nicht mehr in FaceReihenfolge - also Face fuer Face einsammeln
+	outConnects.clear();
+	outConnects.reserve(numLiveFaceVertices);
+
+	const unsigned l = numFaces();
+	for( unsigned f = 0; f < l; f++ )
+	{
+		const int* begin = faceBegin(f);
+		outConnects.insert( outConnects.end(), begin, begin + faceCounts[f] );
+	}
+}
+
+
+//-----------------------------------------------------------------------------------------
+int		meshTopology::newVertexBetween(int startID, int endID, double t)
+//-----------------------------------------------------------------------------------------
+{
+	const double* s = point(startID);
+	const double* e = point(endID);
+
+	return addVertex(	s[0] + (e[0] - s[0]) * t,
+						s[1] + (e[1] - s[1]) * t,
+						s[2] + (e[2] - s[2]) * t );
+}
+
+
+//-----------------------------------------------------------------------------------------
+int		meshTopology::createCenterVertex(int faceID)
+//-----------------------------------------------------------------------------------------
+{
+	const int* begin = faceBegin(faceID);
+	const int count = faceCounts[faceID];
+
+	double center[3] = { 0.0, 0.0, 0.0 };
+
+	for( int i = 0; i < count; i++ )
+	{
+		const double* p = point( begin[i] );
+
+		center[0] += p[0];
+		center[1] += p[1];
+		center[2] += p[2];
+	}
+
+	return addVertex(center[0] / count, center[1] / count, center[2] / count);
+}
+
+
+//-----------------------------------------------------------------------------------------
+void	meshTopology::changeFaceVertices(int faceID, const int* vertices, unsigned count)
+//-----------------------------------------------------------------------------------------
+{
+	const unsigned oldCount = faceCounts[faceID];
+	int start = faceStarts[faceID];
+
+	// die bisherigen Vtx verlassen das Face - die neuen werden unten eingetragen
+	if( vtxFaces.valid() )
+	{
+		for( unsigned i = 0; i < oldCount; i++ )
+			vtxFaces.unlink(faceVertices[start + i], faceID);
+	}
+
+	if( count > oldCount )
+	{
+		// nur das letzte Face kann an Ort und Stelle wachsen - alle anderen ziehen ans Ende um, statt alles dahinter
+		// zu verschieben
+		if( (size_t)(start + oldCount) != faceVertices.size() )
+		{
+			numGarbage += oldCount;
+
+			start = (int)faceVertices.size();
+			faceStarts[faceID] = start;
+		}
+
+		faceVertices.resize(start + count);
+	}
+	else
+		numGarbage += oldCount - count;
+
+	std::copy(vertices, vertices + count, faceVertices.begin() + start);
+
+	for( unsigned i = 0; i < count; i++ )
+		vtxFaces.link(vertices[i], faceID);
+
+	faceCounts[faceID] = count;
+	numLiveFaceVertices += count - oldCount;
+
+	if( numGarbage > numLiveFaceVertices )
+		compact();
+}
+
+
+//-----------------------------------------------------------------------------------------
+void	meshTopology::insertFaceVertices(int faceID, unsigned localIndex, const int* vertices, unsigned count)
+//-----------------------------------------------------------------------------------------
+{
+	getFaceVertices(faceID, faceBuffer);
+	faceBuffer.insert(faceBuffer.begin() + localIndex, vertices, vertices + count);
+
+	changeFaceVertices(faceID, &faceBuffer[0], (unsigned)faceBuffer.size());
+}
+
+
+//-----------------------------------------------------------------------------------------
+int		meshTopology::replaceFaceVertex(int faceID, int oldVtx, int newVtx)
+//-----------------------------------------------------------------------------------------
+{
+	const int local = localIndex(faceID, oldVtx);
+	if( local < 0 )
+		return -1;
+
+	faceVertices[ faceStarts[faceID] + local ] = newVtx;
+
+	// ein Vtx kann in entarteten Faces mehrfach vorkommen
+	if( localIndex(faceID, oldVtx) < 0 )
+		vtxFaces.unlink(oldVtx, faceID);
+
+	vtxFaces.link(newVtx, faceID);
+
+	return local;
+}
+
+
+//-----------------------------------------------------------------------------------------
+int		meshTopology::removeFaceVertex(int faceID, int vtxID)
+//-----------------------------------------------------------------------------------------
+{
+	const int local = localIndex(faceID, vtxID);
+	if( local < 0 )
+		return -1;
+
+	// das Face schrumpft an Ort und Stelle - sein letzter Platz wird zur Luecke
+	std::vector<int>::iterator begin = faceVertices.begin() + faceStarts[faceID];
+	std::copy(begin + local + 1, begin + faceCounts[faceID], begin + local);
+
+	faceCounts[faceID]--;
+	numLiveFaceVertices--;
+	numGarbage++;
+
+	if( localIndex(faceID, vtxID) < 0 )
+		vtxFaces.unlink(vtxID, faceID);
+
+	return local;
+}
+
+
+//-----------------------------------------------------------------------------------------
+void	meshTopology::compact()
+//-----------------------------------------------------------------------------------------
+{
+	std::vector<int> packed;
+	packed.reserve(numLiveFaceVertices);
+
+	const unsigned l = numFaces();
+	for( unsigned f = 0; f < l; f++ )
+	{
+		const int start = (int)packed.size();
+
+		packed.insert( packed.end(), faceVertices.begin() + faceStarts[f], faceVertices.begin() + faceStarts[f] + faceCounts[f] );
+		faceStarts[f] = start;
+	}
+
+	faceVertices.swap(packed);
+	numGarbage = 0;
+}
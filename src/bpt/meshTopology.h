@@ -0,0 +1,149 @@
+/*
+ * Copyright (C) 2002 Sebastian Thiel
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ */
+
+#ifndef MESH_TOPOLOGY_INCLUDE
+#define MESH_TOPOLOGY_INCLUDE
+
+// Absichtlich ohne Maya Includes - meshCreator haelt seine Vertizen und Faces hierin, der topologyBenchmark misst
+// die Speicherung ausserhalb von Maya (nicht die Aktionen von BPT selbst)
+
+#include "vertexFaceIndex.h"
+
+#include <vector>
+
+
+namespace BPT
+{
+
+/** Vertex/Face Daten eines Meshes und die grundlegenden Topologie Aenderungen darauf - ohne Maya.
+
+	meshCreator (und damit edgeMeshCreator und IVMeshCreator) speichern Punkte und Faces hier und wandeln nur an der
+	Schnittstelle in MPoint und MIntArray um. Normalen, UVs und SlideDaten bleiben im meshCreator.
+
+	Alle FaceVertizen liegen in einem Array, jedes Face zusammenhaengend ab seinem Start. Waechst ein Face, das nicht
+	am Ende liegt, wird es ans Ende verschoben statt alle folgenden Faces zu verschieben - eine Aenderung kostet also
+	nur O(Groesse des Faces) und nicht O(alle FaceVertizen). Der alte Platz bleibt als Luecke liegen, bis die Luecken
+	mehr Platz belegen als die Faces selbst - dann wird das Array einmal in FaceReihenfolge zusammengeschoben.
+	Neue Faces kommen immer ans Ende.
+*/
+
+class meshTopology
+{
+public:
+
+	meshTopology() : numLiveFaceVertices(0), numGarbage(0) {}
+
+	//! Entfernt alle Vertizen und Faces und gibt den Speicher frei
+	void		clear();
+
+	//! Reserviert Speicher, damit beim Aufbau nicht umkopiert werden muss
+	void		reserve(unsigned numVertices, unsigned numFaces, unsigned numFaceVertices);
+
+//---------------
+//AUFBAU
+//---------------
+
+	int			addVertex(double x, double y, double z);
+
+	//! haengt ein Face mit den gegebenen Vertizen an und gibt seine ID zurueck
+	int			addFace(const int* vertices, unsigned count);
+
+//---------------
+//ZUGRIFF
+//---------------
+
+	unsigned	numVertices() const { return (unsigned)points.size() / 3; }
+	unsigned	numFaces() const { return (unsigned)faceCounts.size(); }
+	unsigned	numFaceVertices() const { return numLiveFaceVertices; }
+
+	unsigned	faceVertexCount(int faceID) const { return faceCounts[faceID]; }
+
+	//! Die Vertizen des Faces liegen von hier an zusammenhaengend - gueltig bis zur naechsten Aenderung
+	const int*	faceBegin(int faceID) const { return faceVertices.empty() ? 0 : &faceVertices[0] + faceStarts[faceID]; }
+
+	void		getFaceVertices(int faceID, std::vector<int>& result) const;
+
+	//! lokaler Index von vtxID im Face oder -1
+	int			localIndex(int faceID, int vtxID) const;
+
+	//! xyz des Vertex
+	const double*	point(int vtxID) const { return &points[vtxID * 3]; }
+
+	void		setPoint(int vtxID, double x, double y, double z);
+
+	//! Entfernt den zuletzt angelegten Vertex - er darf in keinem Face mehr vorkommen
+	void		removeLastVertex() { points.resize(points.size() - 3); }
+
+	//! Die Faces, in denen vtxID vorkommt - aufsteigend sortiert
+	const std::vector<int>&	connectedFaces(int vtxID) const;
+
+	/** Schreibt das Mesh so, wie MFnMesh::create es erwartet: Punkte als xyz, Vertexzahl pro Face und alle
+		FaceVertizen nach Faces geordnet
+	*/
+	void		getMeshArrays(	std::vector<double>& outPoints,
+								std::vector<int>& outCounts,
+								std::vector<int>& outConnects ) const;
+
+//---------------
+//MODIFIKATOREN
+//---------------
+
+	//! Neuer Vertex zwischen den beiden Vertizen, bei t = 0 liegt er auf startID - wie bei newVtxBetweenIDs
+	int			newVertexBetween(int startID, int endID, double t = 0.5);
+
+	//! Neuer Vertex im Mittelpunkt des Faces - wie bei createCenterVtx
+	int			createCenterVertex(int faceID);
+
+	/** Ersetzt die Vertizen des Faces - vertices darf nicht in die Daten der meshTopology selbst zeigen, da das Face
+		dabei verschoben werden kann
+	*/
+	void		changeFaceVertices(int faceID, const int* vertices, unsigned count);
+
+	//! Fuegt count Vertizen vor dem lokalen Index ein - bei localIndex == faceVertexCount ans Ende
+	void		insertFaceVertices(int faceID, unsigned localIndex, const int* vertices, unsigned count);
+
+	//! Ersetzt oldVtx im Face durch newVtx und gibt seinen lokalen Index zurueck, -1 wenn oldVtx nicht im Face ist
+	int			replaceFaceVertex(int faceID, int oldVtx, int newVtx);
+
+	//! Entfernt vtxID aus dem Face und gibt seinen bisherigen lokalen Index zurueck, -1 wenn er nicht im Face ist
+	int			removeFaceVertex(int faceID, int vtxID);
+
+private:
+
+	//! Schiebt alle Faces in FaceReihenfolge ohne Luecken zusammen
+	void		compact();
+
+private:
+
+	std::vector<double>		points;			//!< xyz pro Vertex
+
+	std::vector<int>		faceVertices;	//!< die Vertizen aller Faces, jedes zusammenhaengend - mit Luecken
+	std::vector<int>		faceCounts;		//!< Zahl der Vertizen pro Face
+	std::vector<int>		faceStarts;		//!< Beginn jedes Faces in faceVertices
+
+	unsigned				numLiveFaceVertices;	//!< Summe der faceCounts
+	unsigned				numGarbage;				//!< Plaetze in faceVertices, die zu keinem Face mehr gehoeren
+
+	mutable vertexFaceIndex	vtxFaces;
+
+	std::vector<int>		faceBuffer;		//!< Arbeitsspeicher fuer insertFaceVertices
+};
+
+}
+
+#endif
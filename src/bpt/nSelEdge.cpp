@@ -28,14 +28,14 @@
 // Construction/Destruction
 //////////////////////////////////////////////////////////////////////
 
-nSelEdge::nSelEdge(int inID):edge(inID)
+nSelEdge::nSelEdge(edgeContext& inContext, int inID):edge(inContext, inID)
 {
 
 }
 
 
 
-nSelEdge::nSelEdge(MIntArray inFaceIDs,int inID):edge(inFaceIDs,inID)
+nSelEdge::nSelEdge(edgeContext& inContext, MIntArray inFaceIDs,int inID):edge(inContext, inFaceIDs,inID)
 {
 
 }
@@ -44,24 +44,8 @@ nSelEdge::nSelEdge(MIntArray inFaceIDs,int inID):edge(inFaceIDs,inID)
 nSelEdge::~nSelEdge()
 //-------------------------------------------------------
 {
-	//MUSS HIER ALL IHRE NACHBARN LÖSCHEN
-	//MERKE: NSEL EDGES HABEN NIE PTS ZU SELEDGES; SO DASS MAN DIESE GETROST von "Oben" loeschen kann
-
-	for(int i = 0; i < 2; i++)
-	{
-		for(int a = 0; a < 2; a++)
-		{
-			if(nachbarn[i][a] != 0)
-			{//zuerst sich selbst beim nachban 0 setzen, damit der nicht wiederum versucht, diesen hier zu loeschen - feedbackschleife
-
-				nachbarn[i][a]->setThisNachbarZero(this);
-				//jetzt kann man diesen nachbarn ebenfalls loeschen
-				delete nachbarn[i][a];
-			}
-		}
-
-	}
-
+	//Die Nachbarn werden hier nicht mehr geloescht - alle edges einer Operation gehoeren dem edgeContext in BPTfty::doIt
+	//und werden dort gemeinsam zerstoert
 }
 
 
@@ -239,7 +223,7 @@ void		nSelEdge::changeFace(int origVtx, int newVtx,const edgeFaceData* faceData,
 				
 				//das Face, welches übergeben wurde ist ein referenzface, welches auf jeden Fall in der anderen Richtung der edge angrenzt
 				//FACE AUFBAUEN
-				thisFace = new edgeFaceData(faceIDs[i]);
+				thisFace = new edgeFaceData(faceIDs[i], creator->numUVSets);
 
 				creator->getFaceVtxIDs(faceIDs[i], thisFace->faceVertices);
 
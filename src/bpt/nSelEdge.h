@@ -42,8 +42,8 @@ class nSelEdge : public edge
 {
 
 public:
-	nSelEdge(int inID);
-	nSelEdge(MIntArray inFaceIDs,int inID);
+	nSelEdge(edgeContext& inContext, int inID);
+	nSelEdge(edgeContext& inContext, MIntArray inFaceIDs,int inID);
 
 	virtual ~nSelEdge();
 
@@ -0,0 +1,133 @@
+/*
+ * Copyright (C) 2002 Sebastian Thiel
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ */
+
+#ifndef OBJECT_POOL_INCLUDE
+#define OBJECT_POOL_INCLUDE
+
+#include <new>
+#include <vector>
+
+
+namespace BPT
+{
+
+/** Arena fuer die Objekte einer BPT Operation - alle vom selben Typ T.
+
+	Die Objekte liegen zusammenhaengend in Bloecken zu je blockSize Stueck und werden nie einzeln geloescht:
+	clear() (oder der Destruktor) ruft alle Destruktoren in einem Rutsch auf und gibt die Bloecke frei.
+	Der erste Block bleibt erhalten, damit die naechste Operation nicht gleich wieder allozieren muss.
+
+	Erzeugt wird mit placement new im Speicher von allocate(), gezaehlt wird das Objekt erst von add() - wirft der
+	Konstruktor, bleibt der Pool unveraendert und der Platz wird beim naechsten allocate() wiederverwendet:
+
+		edgeFaceData* data = pool.add( new (pool.allocate()) edgeFaceData(faceID, numUVSets) );
+
+	Der Konstruktor darf deshalb selbst nichts aus demselben Pool erzeugen.
+
+	Objekte aus dem Pool duerfen niemals mit delete geloescht werden.
+*/
+
+template <class T>
+class objectPool
+{
+public:
+
+	explicit objectPool(unsigned inBlockSize = 256) : blockSize(inBlockSize), count(0) {}
+	~objectPool() { clear(); release(); }
+
+	//! Speicher fuer ein weiteres T - gilt erst nach add() als konstruiert
+	void*		allocate();
+
+	//! zaehlt das eben im Speicher von allocate() konstruierte Objekt
+	T*			add( T* object ) { count++; return object; }
+
+	//! Zerstoert alle Objekte, behaelt aber den ersten Block
+	void		clear();
+
+	//! Zahl der erzeugten Objekte
+	unsigned	length() const { return count; }
+
+	T*			operator[]( unsigned index ) const
+	{
+		return reinterpret_cast<T*>(blocks[index / blockSize]) + index % blockSize;
+	}
+
+private:
+
+	//! Gibt alle Bloecke frei - der Pool muss leer sein
+	void		release();
+
+	// nicht kopierbar - die Objekte gehoeren genau einem Pool
+	objectPool(const objectPool&);
+	objectPool& operator=(const objectPool&);
+
+private:
+
+	std::vector<char*>	blocks;
+
+	unsigned	blockSize;
+	unsigned	count;
+};
+
+
+//-----------------------------------------------------------------------------------------
+template <class T>
+void*	objectPool<T>::allocate()
+//-----------------------------------------------------------------------------------------
+{
+	const unsigned block = count / blockSize;
+
+	if( block == blocks.size() )
+		blocks.push_back( static_cast<char*>( ::operator new( sizeof(T) * blockSize ) ) );
+
+	return reinterpret_cast<T*>(blocks[block]) + count % blockSize;
+}
+
+
+//-----------------------------------------------------------------------------------------
+template <class T>
+void	objectPool<T>::clear()
+//-----------------------------------------------------------------------------------------
+{
+	for( unsigned i = 0; i < count; i++ )
+		(*this)[i]->~T();
+
+	count = 0;
+
+	for( unsigned b = 1; b < blocks.size(); b++ )
+		::operator delete(blocks[b]);
+
+	if( blocks.size() > 1 )
+		blocks.resize(1);
+}
+
+
+//-----------------------------------------------------------------------------------------
+template <class T>
+void	objectPool<T>::release()
+//-----------------------------------------------------------------------------------------
+{
+	for( unsigned b = 0; b < blocks.size(); b++ )
+		::operator delete(blocks[b]);
+
+	blocks.clear();
+}
+
+}
+
+#endif
@@ -0,0 +1,122 @@
+/*
+ * Copyright (C) 2002 Sebastian Thiel
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ */
+
+#include "offsetIndex.h"
+
+
+using namespace BPT;
+
+
+//-----------------------------------------------------------------------------------------
+void	offsetIndex::reserve(unsigned numFaces)
+//-----------------------------------------------------------------------------------------
+{
+	if( numFaces > values.size() )
+		grow(numFaces);
+}
+
+
+//-----------------------------------------------------------------------------------------
+void	offsetIndex::grow(unsigned size)
+//-----------------------------------------------------------------------------------------
+{
+	values.resize(size, 0);
+	changed.resize(size, 0);
+
+	// Linearer Aufbau: jeder Knoten gibt seine Summe an den naechsten ihn umfassenden Knoten weiter
+	tree.assign(size + 1, 0);
+
+	unsigned i;
+	for( i = 1; i <= size; i++ )
+		tree[i] += values[i-1];
+
+	for( i = 1; i <= size; i++ )
+	{
+		const unsigned parent = i + ( i & (0 - i) );
+
+		if( parent <= size )
+			tree[parent] += tree[i];
+	}
+}
+
+
+//-----------------------------------------------------------------------------------------
+void	offsetIndex::add(int faceID, int count)
+//-----------------------------------------------------------------------------------------
+{
+	if( faceID < 0 )
+		return;
+
+	const unsigned id = (unsigned)faceID;
+
+	// Neue Faces kommen am Ende dazu - verdoppeln, damit der Neuaufbau nur selten noetig ist
+	if( id >= values.size() )
+	{
+		unsigned size = values.size() * 2;
+		if( size <= id )
+			size = id + 1;
+
+		grow(size);
+	}
+
+	if( !changed[id] )
+	{
+		changed[id] = 1;
+		numChanged++;
+	}
+
+	values[id] += count;
+	total += count;
+
+	const unsigned size = values.size();
+
+	for( unsigned i = id + 1; i <= size; i += i & (0 - i) )
+		tree[i] += count;
+}
+
+
+//-----------------------------------------------------------------------------------------
+int		offsetIndex::sumBefore(int faceID) const
+//-----------------------------------------------------------------------------------------
+{
+	if( faceID <= 0 )
+		return 0;
+
+	if( (unsigned)faceID > values.size() )
+		return total;
+
+	int sum = 0;
+
+	for( unsigned i = (unsigned)faceID; i > 0; i -= i & (0 - i) )
+		sum += tree[i];
+
+	return sum;
+}
+
+
+//-----------------------------------------------------------------------------------------
+void	offsetIndex::clear()
+//-----------------------------------------------------------------------------------------
+{
+	tree.clear();
+	values.clear();
+	changed.clear();
+
+	numChanged = 0;
+	total = 0;
+}
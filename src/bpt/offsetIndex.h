@@ -0,0 +1,75 @@
+/*
+ * Copyright (C) 2002 Sebastian Thiel
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ */
+
+#ifndef OFFSET_INDEX_INCLUDE
+#define OFFSET_INDEX_INCLUDE
+
+#include <vector>
+
+
+namespace BPT
+{
+
+/** Summiert die Verschiebungen der absoluten Offsets pro Face auf.
+
+	Wenn ein Face Vertizen, Normalen oder UVs erhaelt oder verliert, verschieben sich die absoluten Offsets aller
+	Faces dahinter. Statt sie jedesmal umzuschreiben, wird die Aenderung hier unter der FaceID eingetragen - das
+	gueltige Offset eines Faces ist dann sein urspruengliches plus die Summe aller Aenderungen an kleineren FaceIDs.
+
+	Intern ein Fenwick Tree (binary indexed tree): Eintragen und Abfragen kosten beide O(log n).
+	Die Zahl der Faces darf waehrend der Bearbeitung wachsen - der Baum vergroessert sich dann selbst.
+*/
+
+class offsetIndex
+{
+public:
+
+	offsetIndex() : numChanged(0), total(0) {}
+
+	//! Reserviert Platz fuer numFaces Faces, damit der Baum nicht waehrend der Bearbeitung neu aufgebaut werden muss
+	void	reserve(unsigned numFaces);
+
+	//! Das Face faceID hat count Elemente hinzubekommen (oder bei negativem count verloren)
+	void	add(int faceID, int count);
+
+	//! Summe aller Aenderungen an Faces mit einer ID kleiner als faceID
+	int		sumBefore(int faceID) const;
+
+	//! Zahl der Faces, die schon einmal geaendert wurden
+	unsigned	length() const { return numChanged; }
+
+	void	clear();
+
+private:
+
+	//! Baut den Baum fuer mindestens size Faces neu auf - aus values in O(n)
+	void	grow(unsigned size);
+
+private:
+
+	std::vector<int>			tree;		//!< 1-basiert, tree[i] haelt die Summe der Faces (i - lowbit(i), i]
+	std::vector<int>			values;		//!< Aenderung pro Face - wird nur zum Neuaufbau gebraucht
+	std::vector<unsigned char>	changed;	//!< wurde das Face schon einmal eingetragen ?
+
+	unsigned	numChanged;
+	int			total;						//!< Summe ueber alle Faces, fuer Abfragen hinter dem Ende des Baums
+};
+
+}
+
+#endif
@@ -0,0 +1,193 @@
+/*
+ * Copyright (C) 2002 Sebastian Thiel
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ */
+
+#include "pointGrid.h"
+
+#include <algorithm>
+#include <math.h>
+
+
+// 21 bit pro Achse, damit alle drei Koordinaten in einen 64 bit Schluessel passen
+static const int	maxCellCoord = (1 << 21) - 1;
+
+
+//-----------------------------------------------------------------------------------------
+pointGrid::pointGrid()
+: invCellSize(1.0)
+//-----------------------------------------------------------------------------------------
+{
+	origin[0] = origin[1] = origin[2] = 0.0;
+}
+
+
+//-----------------------------------------------------------------------------------------
+void	pointGrid::clear()
+//-----------------------------------------------------------------------------------------
+{
+	entries.clear();
+	points.clear();
+}
+
+
+//-----------------------------------------------------------------------------------------
+MUint64	pointGrid::cellKey(int x, int y, int z)
+//-----------------------------------------------------------------------------------------
+{
+	return ((MUint64)x << 42) | ((MUint64)y << 21) | (MUint64)z;
+}
+
+
+//-----------------------------------------------------------------------------------------
+int		pointGrid::cellCoord(double v, double o) const
+//-----------------------------------------------------------------------------------------
+{
+	// Punkte ausserhalb der BoundingBox landen in den Randzellen - das Clampen ist monoton, so dass
+	// die Nachbarzellen trotzdem alle Kandidaten enthalten
+	double c = floor( (v - o) * invCellSize );
+
+	if( c < 0.0 )
+		return 0;
+	if( c > (double)maxCellCoord )
+		return maxCellCoord;
+
+	return (int)c;
+}
+
+
+//-----------------------------------------------------------------------------------------
+void	pointGrid::build(const MPointArray& inPoints, double cellSize)
+//-----------------------------------------------------------------------------------------
+{
+	clear();
+
+	const unsigned l = inPoints.length();
+	if( l == 0 )
+		return;
+
+
+	// BoundingBox bestimmen
+	double	bmin[3] = { inPoints[0].x, inPoints[0].y, inPoints[0].z };
+	double	bmax[3] = { bmin[0], bmin[1], bmin[2] };
+
+	unsigned i;
+	for( i = 1; i < l; i++ )
+	{
+		const MPoint& p = inPoints[i];
+
+		bmin[0] = std::min(bmin[0], p.x);	bmax[0] = std::max(bmax[0], p.x);
+		bmin[1] = std::min(bmin[1], p.y);	bmax[1] = std::max(bmax[1], p.y);
+		bmin[2] = std::min(bmin[2], p.z);	bmax[2] = std::max(bmax[2], p.z);
+	}
+
+	double extent = std::max(bmax[0] - bmin[0], std::max(bmax[1] - bmin[1], bmax[2] - bmin[2]));
+
+	// Zellen nicht so klein werden lassen, dass die Koordinaten nicht mehr in den Schluessel passen
+	cellSize = std::max(cellSize, extent / (double)(1 << 20));
+	if( cellSize <= 0.0 )
+		cellSize = 1.0;
+
+	invCellSize = 1.0 / cellSize;
+	origin[0] = bmin[0];	origin[1] = bmin[1];	origin[2] = bmin[2];
+
+
+	entries.resize(l);
+	for( i = 0; i < l; i++ )
+	{
+		const MPoint& p = inPoints[i];
+
+		entries[i].key = cellKey( cellCoord(p.x, origin[0]), cellCoord(p.y, origin[1]), cellCoord(p.z, origin[2]) );
+		entries[i].id = (int)i;
+	}
+
+	std::sort(entries.begin(), entries.end());
+
+
+	points.resize(l);
+	for( i = 0; i < l; i++ )
+		points[i] = inPoints[ entries[i].id ];
+}
+
+
+//-----------------------------------------------------------------------------------------
+unsigned	pointGrid::findNearest(const MPoint& p, double radius, unsigned maxResults, result* out) const
+//-----------------------------------------------------------------------------------------
+{
+	if( maxResults == 0 || entries.empty() )
+		return 0;
+
+	const double	radius2 = radius * radius;
+	const int		c[3] = { cellCoord(p.x, origin[0]), cellCoord(p.y, origin[1]), cellCoord(p.z, origin[2]) };
+
+	unsigned n = 0;		// Zahl der Eintraege im Heap - out[0] ist immer der am weitesten entfernte
+
+	for( int z = c[2] - 1; z <= c[2] + 1; z++ )
+	{
+		if( z < 0 || z > maxCellCoord )
+			continue;
+
+		for( int y = c[1] - 1; y <= c[1] + 1; y++ )
+		{
+			if( y < 0 || y > maxCellCoord )
+				continue;
+
+			for( int x = c[0] - 1; x <= c[0] + 1; x++ )
+			{
+				if( x < 0 || x > maxCellCoord )
+					continue;
+
+				entry	search;
+				search.key = cellKey(x, y, z);
+				search.id = -1;		// kleiner als jede gueltige id - lower_bound liefert also den Zellenanfang
+
+				std::vector<entry>::const_iterator iter = std::lower_bound(entries.begin(), entries.end(), search);
+
+				for( ; iter != entries.end() && iter->key == search.key; ++iter )
+				{
+					const MPoint&	q = points[ iter - entries.begin() ];
+					const double	dx = q.x - p.x, dy = q.y - p.y, dz = q.z - p.z;
+					const double	d2 = dx*dx + dy*dy + dz*dz;
+
+					if( d2 > radius2 )
+						continue;
+
+					const result r( sqrt(d2), iter->id );
+
+					if( n < maxResults )
+					{
+						out[n++] = r;
+						std::push_heap(out, out + n);
+					}
+					else if( r < out[0] )
+					{
+						std::pop_heap(out, out + n);
+						out[n-1] = r;
+						std::push_heap(out, out + n);
+					}
+
+				}// for each point in cell
+
+			}
+		}
+	}
+
+
+	// Aufsteigend sortiert zurueckgeben - kleinste Distanz zuerst
+	std::sort_heap(out, out + n);
+
+	return n;
+}
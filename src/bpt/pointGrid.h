@@ -0,0 +1,85 @@
+/*
+ * Copyright (C) 2002 Sebastian Thiel
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ */
+
+#ifndef POINT_GRID_INCLUDE
+#define POINT_GRID_INCLUDE
+
+#include <maya/MPoint.h>
+#include <maya/MPointArray.h>
+#include <maya/MTypes.h>
+
+#include <MACROS.h>
+
+#include <vector>
+#include <utility>
+
+
+namespace BPT
+{
+
+/** Gleichmaessiges Gitter ueber eine Punktmenge, fuer schnelle radius-begrenzte Nachbarschaftsabfragen.
+
+	Die Punkte werden nach ihrer Zelle sortiert abgelegt, eine Zelle wird per binaerer Suche gefunden.
+	Nach build() ist die Klasse nur noch lesend - findNearest darf also parallel gerufen werden.
+*/
+
+class pointGrid
+{
+public:
+
+	typedef std::pair<double, int>	result;	//!< Distanz und Index in das Punktarray
+
+	pointGrid();
+
+	//! Baut das Gitter ueber points auf, cellSize sollte dem SuchRadius entsprechen
+	void	build(const MPointArray& points, double cellSize);
+
+	//! Findet hoechstens maxResults Punkte mit Distanz <= radius zu p und schreibt sie aufsteigend sortiert nach out.
+	//! out muss Platz fuer maxResults Eintraege haben. radius darf nicht groesser als die cellSize sein.
+	//! Gibt die Zahl der gefundenen Punkte zurueck
+	unsigned	findNearest(const MPoint& p, double radius, unsigned maxResults, result* out) const;
+
+	void	clear();
+
+private:
+
+	//! Zellenkoordinate auf einer Achse, geclamped auf den darstellbaren Bereich
+	int		cellCoord(double v, double origin) const;
+
+	static	MUint64	cellKey(int x, int y, int z);
+
+private:
+
+	struct	entry
+	{
+		MUint64	key;	//!< Zellenschluessel
+		int		id;		//!< Index in das Punktarray
+
+		bool	operator < (const entry& rhs) const { return key < rhs.key || (key == rhs.key && id < rhs.id); }
+	};
+
+	std::vector<entry>	entries;	//!< nach key sortiert
+	std::vector<MPoint>	points;		//!< Kopie der Punkte, in entries Reihenfolge - fuer Cache-freundliche Abfragen
+
+	double	origin[3];				//!< Minimum der BoundingBox
+	double	invCellSize;
+};
+
+}
+
+#endif
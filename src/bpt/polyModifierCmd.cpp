@@ -1160,42 +1160,17 @@ MStatus polyModifierCmd::connectNodes( MObject modifierNode )
 
 
 
+// --------------------------------------------------------------------------------------------
 MStatus polyModifierCmd::cacheMeshData()
+// --------------------------------------------------------------------------------------------
 {
-	MStatus status = MS::kSuccess;
-
-	MFnDependencyNode depNodeFn;
-	MFnDagNode dagNodeFn;
-
-	MObject meshNode = fDagPath.node();
-	MObject dupMeshNode;
-	MPlug dupMeshNodeOutMeshPlug;
-
-	// Duplicate the mesh
-	//
-	dagNodeFn.setObject( meshNode );
-	dupMeshNode = dagNodeFn.duplicate();
-
-	MDagPath dupMeshDagPath;
-	MDagPath::getAPathTo( dupMeshNode, dupMeshDagPath );
-	dupMeshDagPath.extendToShape();
-
-	depNodeFn.setObject( dupMeshDagPath.node() );
-	dupMeshNodeOutMeshPlug = depNodeFn.findPlug( "outMesh", &status );
-	MCheckStatus( status, "Could not retrieve outMesh" );
-
-	// Retrieve the meshData
-	//
-	status = dupMeshNodeOutMeshPlug.getValue( fMeshData );
-	MCheckStatus( status, "Could not retrieve meshData" );
+	MStatus status;
 
-	// Delete the duplicated node
+	// Copy the meshData directly - duplicating the whole mesh node just to
+	// read its outMesh is as expensive as the operation itself on heavy meshes
 	//
-
-	MDGModifier deleter;
-	deleter.deleteNode(dupMeshNode);
-	deleter.doIt();
-	//MGlobal::deleteNode( dupMeshNode );
+	status = fMeshSnapshot.capture( fDagPath.node() );
+	MCheckStatus( status, "Could not copy meshData" );
 
 	return status;
 }
@@ -1449,7 +1424,7 @@ MStatus polyModifierCmd::undoDirectModifier()
 		depNodeFn.setObject( dupMeshDagPath.node() );
 		MPlug dupMeshNodeOutMeshPlug = depNodeFn.findPlug( "outMesh", &status );
 		MCheckStatus( status, "Could not retrieve outMesh" );
-		status = dupMeshNodeOutMeshPlug.setValue( fMeshData );
+		status = dupMeshNodeOutMeshPlug.setValue( fMeshSnapshot.getMeshData() );
 
 		// Temporarily connect the duplicate mesh node to our mesh node
 		//
@@ -1477,13 +1452,13 @@ MStatus polyModifierCmd::undoDirectModifier()
 	}
 	else
 	{
-		// Restore the original mesh by writing the old mesh data (fMeshData) back
+		// Restore the original mesh by writing the old mesh data back
 		// onto the outMesh of our meshNode
 		//
 		depNodeFn.setObject( meshNode );
 		MPlug meshNodeOutMeshPlug = depNodeFn.findPlug( "outMesh", &status );
 		MCheckStatus( status, "Could not retrieve outMesh" );
-		status = meshNodeOutMeshPlug.setValue( fMeshData );
+		status = meshNodeOutMeshPlug.setValue( fMeshSnapshot.getMeshData() );
 		MCheckStatus( status, "Could not set meshData" );
 	}
 
@@ -1495,15 +1470,13 @@ MStatus polyModifierCmd::undoDirectModifier()
 MStatus polyModifierCmd::getFloat3PlugValue( MPlug plug, MFloatVector & value )
 // --------------------------------------------------------------------------------------------
 {
-	// Retrieve the value as an MObject
-	//
-	MObject object;
-	plug.getValue( object );
-
-	// Convert the MObject to a float3
+	// Read the three children directly - going through an MObject and
+	// MFnNumericData creates a data object per tweak, which adds up on
+	// meshes with many tweaks
 	//
-	MFnNumericData numDataFn( object );
-	numDataFn.getData( value[0], value[1], value[2] );
+	plug.child(0).getValue( value[0] );
+	plug.child(1).getValue( value[1] );
+	plug.child(2).getValue( value[2] );
 	return MS::kSuccess;
 }
 
@@ -31,6 +31,8 @@
 #include <maya/MPxCommand.h>
 #include <MACROS.h>
 
+#include "meshSnapshot.h"
+
 // Proxies
 //
 
@@ -224,8 +226,9 @@ private:
 	MFloatVectorArray	fTweakVectorArray;
 
 	// Cached Mesh Data (for undo in the 'No History'/'History turned off' case)
+	// Always holds a full MFnMesh::copy of the mesh as it was before the directModifier ran
 	//
-	MObject				fMeshData;
+	BPT::meshSnapshot	fMeshSnapshot;
 
 	
 	MDGModifier			createSlideAnim;
@@ -0,0 +1,381 @@
+/*
+ * Copyright (C) 2002 Sebastian Thiel
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ */
+
+#include "resultArchive.h"
+
+#include <maya/MFnMesh.h>
+#include <maya/MFnMeshData.h>
+#include <maya/MFnIntArrayData.h>
+#include <maya/MFnDoubleArrayData.h>
+#include <maya/MFnNumericAttribute.h>
+#include <maya/MFnTypedAttribute.h>
+#include <maya/MDataHandle.h>
+
+
+using namespace BPT;
+
+
+//! erster Eintrag der ints - aendert sich das Format, werden alte Szenen einfach neu berechnet
+static const int	formatVersion = 1;
+
+
+//-----------------------------------------------------------------------------------------
+// PACKEN
+//-----------------------------------------------------------------------------------------
+// Jedes Array schreibt seine Laenge in ints, seine Werte je nach Typ in ints oder doubles
+
+static void		writeInts(const MIntArray& array, MIntArray& ints)
+{
+	const unsigned l = array.length();
+	ints.append(l);
+
+	for( unsigned i = 0; i < l; i++ )
+		ints.append(array[i]);
+}
+
+static void		writeDoubles(const MDoubleArray& array, MIntArray& ints, MDoubleArray& doubles)
+{
+	const unsigned l = array.length();
+	ints.append(l);
+
+	for( unsigned i = 0; i < l; i++ )
+		doubles.append(array[i]);
+}
+
+//! fuer MPointArray, MVectorArray und MFloatVectorArray - w der Punkte ist immer 1
+template <class Array>
+static void		writeVectors(const Array& array, MIntArray& ints, MDoubleArray& doubles)
+{
+	const unsigned l = array.length();
+	ints.append(l);
+
+	for( unsigned i = 0; i < l; i++ )
+	{
+		doubles.append(array[i].x);
+		doubles.append(array[i].y);
+		doubles.append(array[i].z);
+	}
+}
+
+
+//-----------------------------------------------------------------------------------------
+// ENTPACKEN
+//-----------------------------------------------------------------------------------------
+// Jeder Zugriff wird geprueft - ein beschaedigtes Attribut fuehrt nur dazu, dass neu berechnet wird
+
+static bool		readLength(const MIntArray& ints, unsigned& intPos, unsigned& length)
+{
+	if( intPos >= ints.length() || ints[intPos] < 0 )
+		return false;
+
+	length = ints[intPos++];
+
+	return true;
+}
+
+static bool		readInts(const MIntArray& ints, unsigned& intPos, MIntArray& array)
+{
+	unsigned l;
+	if( !readLength(ints, intPos, l) || intPos + l > ints.length() )
+		return false;
+
+	array.setLength(l);
+	for( unsigned i = 0; i < l; i++ )
+		array[i] = ints[intPos++];
+
+	return true;
+}
+
+static bool		readDoubles(	const MIntArray& ints, unsigned& intPos,
+								const MDoubleArray& doubles, unsigned& doublePos,
+								MDoubleArray& array )
+{
+	unsigned l;
+	if( !readLength(ints, intPos, l) || doublePos + l > doubles.length() )
+		return false;
+
+	array.setLength(l);
+	for( unsigned i = 0; i < l; i++ )
+		array[i] = doubles[doublePos++];
+
+	return true;
+}
+
+template <class Array>
+static bool		readVectors(	const MIntArray& ints, unsigned& intPos,
+								const MDoubleArray& doubles, unsigned& doublePos,
+								Array& array )
+{
+	unsigned l;
+	if( !readLength(ints, intPos, l) || doublePos + 3 * l > doubles.length() )
+		return false;
+
+	array.setLength(l);
+	for( unsigned i = 0; i < l; i++ )
+	{
+		array[i].x = doubles[doublePos++];
+		array[i].y = doubles[doublePos++];
+		array[i].z = doubles[doublePos++];
+	}
+
+	return true;
+}
+
+
+//-----------------------------------------------------------------------------------------
+static void		pack(const slideData& slides, MIntArray& ints, MDoubleArray& doubles)
+//-----------------------------------------------------------------------------------------
+{
+	ints.append(formatVersion);
+	ints.append(slides.hasUVs);
+
+	writeInts(slides.indices, ints);
+	writeInts(slides.maySlide, ints);
+	writeVectors(slides.startPoints, ints, doubles);
+	writeVectors(slides.endPoints, ints, doubles);
+	writeVectors(slides.directions, ints, doubles);
+	writeVectors(slides.normals, ints, doubles);
+	writeDoubles(slides.scale, ints, doubles);
+	writeDoubles(slides.normalScale, ints, doubles);
+
+	writeInts(slides.UVIndices, ints);
+	writeVectors(slides.UVStart, ints, doubles);
+	writeVectors(slides.UVEnd, ints, doubles);
+	writeVectors(slides.UVDirections, ints, doubles);
+}
+
+
+//-----------------------------------------------------------------------------------------
+static bool		unpack(const MIntArray& ints, const MDoubleArray& doubles, slideData& slides)
+//-----------------------------------------------------------------------------------------
+{
+	if( ints.length() < 2 || ints[0] != formatVersion )
+		return false;
+
+	slides.hasUVs = ints[1] != 0;
+
+	unsigned intPos = 2, doublePos = 0;
+
+	const bool valid =		readInts(ints, intPos, slides.indices)
+						&&	readInts(ints, intPos, slides.maySlide)
+						&&	readVectors(ints, intPos, doubles, doublePos, slides.startPoints)
+						&&	readVectors(ints, intPos, doubles, doublePos, slides.endPoints)
+						&&	readVectors(ints, intPos, doubles, doublePos, slides.directions)
+						&&	readVectors(ints, intPos, doubles, doublePos, slides.normals)
+						&&	readDoubles(ints, intPos, doubles, doublePos, slides.scale)
+						&&	readDoubles(ints, intPos, doubles, doublePos, slides.normalScale)
+						&&	readInts(ints, intPos, slides.UVIndices)
+						&&	readVectors(ints, intPos, doubles, doublePos, slides.UVStart)
+						&&	readVectors(ints, intPos, doubles, doublePos, slides.UVEnd)
+						&&	readVectors(ints, intPos, doubles, doublePos, slides.UVDirections);
+
+	// alles muss aufgebraucht sein - sonst passt das Format nicht
+	return valid && intPos == ints.length() && doublePos == doubles.length();
+}
+
+
+//-----------------------------------------------------------------------------------------
+MStatus		resultArchive::createAttributes(attributes& attrs)
+//-----------------------------------------------------------------------------------------
+{
+	MFnNumericAttribute	numFn;
+	MFnTypedAttribute	typedFn;
+	MStatus				status;
+
+	// aus per default - das Ergebnis vergroessert die Szene um etwa die Groesse eines weiteren Meshes
+	attrs.enabled = numFn.create("storeResult", "srs", MFnNumericData::kBoolean, 0, &status);
+	numFn.setStorable(true);
+	numFn.setKeyable(false);
+	numFn.setInternal(true);
+
+	attrs.key = typedFn.create("resultKey", "rsk", MFnData::kIntArray);
+	typedFn.setStorable(true);
+	typedFn.setHidden(true);
+	typedFn.setConnectable(false);
+
+	attrs.mesh = typedFn.create("resultMesh", "rsm", MFnData::kMesh);
+	typedFn.setStorable(true);
+	typedFn.setHidden(true);
+	typedFn.setConnectable(false);
+
+	attrs.ints = typedFn.create("resultInts", "rsi", MFnData::kIntArray);
+	typedFn.setStorable(true);
+	typedFn.setHidden(true);
+	typedFn.setConnectable(false);
+
+	attrs.doubles = typedFn.create("resultDoubles", "rsd", MFnData::kDoubleArray);
+	typedFn.setStorable(true);
+	typedFn.setHidden(true);
+	typedFn.setConnectable(false);
+
+	return status;
+}
+
+
+//-----------------------------------------------------------------------------------------
+contentHash		resultArchive::createKey(const contentHash& topologyKey, const MObject& inMesh)
+//-----------------------------------------------------------------------------------------
+{
+	contentHash key = topologyKey;
+
+	MPointArray points;
+	MFnMesh(inMesh).getPoints(points);
+
+	double xyz[3];
+
+	const unsigned l = points.length();
+	for( unsigned i = 0; i < l; i++ )
+	{
+		xyz[0] = points[i].x;
+		xyz[1] = points[i].y;
+		xyz[2] = points[i].z;
+
+		key.add(xyz, sizeof(xyz));
+	}
+
+	return key;
+}
+
+
+//-----------------------------------------------------------------------------------------
+bool		resultArchive::isEnabled(MDataBlock& data, const attributes& attrs)
+//-----------------------------------------------------------------------------------------
+{
+	return data.inputValue(attrs.enabled).asBool();
+}
+
+
+//-----------------------------------------------------------------------------------------
+MStatus		resultArchive::store(	MDataBlock&			data,
+									const attributes&	attrs,
+									const contentHash&	key,
+									const MObject&		result,
+									const slideData&	slides )
+//-----------------------------------------------------------------------------------------
+{
+	MStatus status;
+
+	// Kopie - das Ergebnis wird vom Slide gleich noch veraendert
+	MFnMeshData	meshDataFn;
+	MObject		meshData = meshDataFn.create(&status);
+	if( !status )
+		return status;
+
+	MFnMesh().copy(result, meshData, &status);
+	if( !status )
+		return status;
+
+
+	MIntArray		ints;
+	MDoubleArray	doubles;
+	pack(slides, ints, doubles);
+
+	unsigned parts[contentHash::kNumParts];
+	key.getParts(parts);
+
+	MIntArray keyParts(contentHash::kNumParts);
+	for( int i = 0; i < contentHash::kNumParts; i++ )
+		keyParts[i] = (int)parts[i];
+
+
+	MFnIntArrayData		intDataFn;
+	MFnDoubleArrayData	doubleDataFn;
+
+	data.outputValue(attrs.mesh).set(meshData);
+	data.outputValue(attrs.ints).set( intDataFn.create(ints) );
+	data.outputValue(attrs.doubles).set( doubleDataFn.create(doubles) );
+	data.outputValue(attrs.key).set( intDataFn.create(keyParts) );
+
+	return status;
+}
+
+
+//-----------------------------------------------------------------------------------------
+void		resultArchive::clear(MDataBlock& data, const attributes& attrs)
+//-----------------------------------------------------------------------------------------
+{
+	// ohne Schluessel ist nichts gespeichert - dann auch nichts anfassen
+	MObject keyData = data.inputValue(attrs.key).data();
+	if( keyData.isNull() || MFnIntArrayData(keyData).length() == 0 )
+		return;
+
+	MFnIntArrayData		intDataFn;
+	MFnDoubleArrayData	doubleDataFn;
+	MFnMeshData			meshDataFn;
+
+	data.outputValue(attrs.key).set( intDataFn.create() );
+	data.outputValue(attrs.ints).set( intDataFn.create() );
+	data.outputValue(attrs.doubles).set( doubleDataFn.create() );
+	data.outputValue(attrs.mesh).set( meshDataFn.create() );
+}
+
+
+//-----------------------------------------------------------------------------------------
+MStatus		resultArchive::restore(	MDataBlock&			data,
+									const attributes&	attrs,
+									const contentHash&	key,
+									MObject&			result,
+									slideData&			slides )
+//-----------------------------------------------------------------------------------------
+{
+	if( !isEnabled(data, attrs) )
+		return MS::kFailure;
+
+	MObject keyData = data.inputValue(attrs.key).data();
+	if( keyData.isNull() )
+		return MS::kFailure;
+
+	MIntArray keyParts = MFnIntArrayData(keyData).array();
+	if( keyParts.length() != contentHash::kNumParts )
+		return MS::kFailure;
+
+	unsigned parts[contentHash::kNumParts];
+	for( int i = 0; i < contentHash::kNumParts; i++ )
+		parts[i] = (unsigned)keyParts[i];
+
+	contentHash storedKey;
+	storedKey.setParts(parts);
+
+	if( storedKey != key )
+		return MS::kFailure;
+
+
+	MObject intData = data.inputValue(attrs.ints).data();
+	MObject doubleData = data.inputValue(attrs.doubles).data();
+	if( intData.isNull() || doubleData.isNull() )
+		return MS::kFailure;
+
+	if( !unpack( MFnIntArrayData(intData).array(), MFnDoubleArrayData(doubleData).array(), slides ) )
+		return MS::kFailure;
+
+
+	MStatus status;
+
+	MObject storedMesh = data.inputValue(attrs.mesh).asMesh();
+	if( storedMesh.isNull() )
+		return MS::kFailure;
+
+	MFnMeshData	meshDataFn;
+	result = meshDataFn.create(&status);
+	if( !status )
+		return status;
+
+	MFnMesh().copy(storedMesh, result, &status);
+
+	return status;
+}
@@ -0,0 +1,122 @@
+/*
+ * Copyright (C) 2002 Sebastian Thiel
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ */
+
+#ifndef RESULT_ARCHIVE_INCLUDE
+#define RESULT_ARCHIVE_INCLUDE
+
+#include "componentAlgorithms.h"
+
+#include <maya/MObject.h>
+#include <maya/MIntArray.h>
+#include <maya/MDoubleArray.h>
+#include <maya/MPointArray.h>
+#include <maya/MVectorArray.h>
+#include <maya/MFloatVectorArray.h>
+#include <maya/MDataBlock.h>
+#include <maya/MStatus.h>
+
+
+namespace BPT
+{
+
+//! Alles, was doSlide einer fty nach einer kompletten Berechnung braucht - von den UVs nur das erste UVSet
+struct slideData
+{
+	slideData() : hasUVs(false) {}
+
+	MIntArray			indices;
+	MIntArray			maySlide;
+	MPointArray			startPoints;
+	MPointArray			endPoints;
+	MVectorArray		directions;
+	MVectorArray		normals;
+	MDoubleArray		scale;
+	MDoubleArray		normalScale;
+
+	bool				hasUVs;
+	MIntArray			UVIndices;
+	MFloatVectorArray	UVStart;
+	MFloatVectorArray	UVEnd;
+	MFloatVectorArray	UVDirections;
+};
+
+
+/** Speichert das Ergebnis einer kompletten Berechnung in versteckten Attributen der Node, so dass es mit der Szene
+	gesichert wird. Beim Laden stellt die Node es wieder her, statt ihre Topologie Operation erneut auszufuehren - bei
+	langer History ist das der groesste Teil der Ladezeit.
+
+	Gespeichert werden das Ergebnis ohne Slide und Tweaks, die SlideArrays der fty in einem int und einem double Array
+	und ein Schluessel aus Topologie und Punkten des inMesh, der Auswahl und den Optionen. Passt der Schluessel beim
+	Laden nicht, weil sich zum Beispiel die History davor geaendert hat, wird wie bisher komplett neu berechnet.
+
+	Das Speichern muss pro Node mit storeResult eingeschaltet werden, denn es kostet Platz: resultMesh ist das
+	komplette Ergebnis mit allen Punkten, Faces, UVSets und Edges - nicht nur die neuen Faces - und damit etwa so gross
+	wie die Shape selbst. Dazu kommen pro verschiebbarem Vertex 14 doubles SlideDaten, mit UVs 9 weitere pro UV.
+	Jede Node mit storeResult vergroessert die Szene also ungefaehr um ein weiteres Mesh - lohnend ist es nur fuer
+	wenige, teure Nodes.
+
+	Nur die neuen Faces und Punkte zu speichern wuerde nicht reichen: der meshCreator baut das Ergebnis mit
+	MFnMesh::create komplett neu auf und setzt UVs und harte Edges danach neu - eine Differenz zum inMesh muesste all
+	das beim Laden nachbilden.
+*/
+
+class resultArchive
+{
+public:
+
+	//! Handles der Attribute - jede Nodeklasse haelt ihre eigenen
+	struct attributes
+	{
+		MObject		enabled;	//!< bool: Ergebnis mit der Szene speichern - kostet etwa ein Mesh pro Node, siehe oben
+		MObject		key;		//!< intArray mit den Teilen des contentHash
+		MObject		mesh;		//!< Ergebnis ohne Slide
+		MObject		ints;		//!< gepackte Indices und Laengen
+		MObject		doubles;	//!< gepackte Punkte, Vektoren und Skalierungen
+	};
+
+	//! erzeugt die Attribute - hinzufuegen muss sie die Node in ihrem initialize
+	static MStatus		createAttributes(attributes& attrs);
+
+	//! Schluessel aus dem Topologie Schluessel der Node und den Punkten des inMesh
+	static contentHash	createKey(const contentHash& topologyKey, const MObject& inMesh);
+
+	static bool			isEnabled(MDataBlock& data, const attributes& attrs);
+
+	//! schreibt eine Kopie des Ergebnisses und die SlideDaten in die Attribute
+	static MStatus		store(	MDataBlock&			data,
+								const attributes&	attrs,
+								const contentHash&	key,
+								const MObject&		result,
+								const slideData&	slides );
+
+	//! leert die Attribute, wenn etwas gespeichert ist
+	static void			clear(MDataBlock& data, const attributes& attrs);
+
+	/** Liest das gespeicherte Ergebnis in einen neuen MFnMeshData Block - schlaegt fehl, wenn das Speichern aus ist,
+		nichts gespeichert wurde oder der Schluessel nicht passt
+	*/
+	static MStatus		restore(	MDataBlock&			data,
+									const attributes&	attrs,
+									const contentHash&	key,
+									MObject&			result,
+									slideData&			slides );
+};
+
+}
+
+#endif
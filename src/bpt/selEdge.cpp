@@ -29,7 +29,7 @@
 //////////////////////////////////////////////////////////////////////
 
 //-------------------------------------
-selEdge::selEdge(int inID):edge(inID)
+selEdge::selEdge(edgeContext& inContext, int inID):edge(inContext, inID)
 //-------------------------------------
 {
 	//newVtx initialisieren
@@ -52,7 +52,7 @@ selEdge::selEdge(int inID):edge(inID)
 }
 
 //-------------------------------------------------------------------------------------------------------------------
-selEdge::selEdge(MIntArray inFaceIDs,int inID):edge(inFaceIDs,inID)
+selEdge::selEdge(edgeContext& inContext, MIntArray inFaceIDs,int inID):edge(inContext, inFaceIDs,inID)
 //-------------------------------------------------------------------------------------------------------------------
 {
 	//newVtx initialisieren
@@ -140,9 +140,9 @@ MDoubleArray selEdge::getGerade(bool displace, const edge* requester, bool useUI
 				//ortsvektor der gerade entlang der multiplizierten normale verschieben
 				if(displace)
 				{
-					result[0] = gerade[0] + maxLength*normal.x;
-					result[1] = gerade[1] + maxLength*normal.y;
-					result[2] = gerade[2] + maxLength*normal.z;
+					result[0] = gerade[0] + context.maxLength*normal.x;
+					result[1] = gerade[1] + context.maxLength*normal.y;
+					result[2] = gerade[2] + context.maxLength*normal.z;
 				}
 				else
 				{
@@ -227,7 +227,7 @@ MPoint		selEdge::intersect(bool isEdgeDisplaced,bool displacePlane,edge* nachbar
 	if(displacePlane)
 	{
 		//normal.x *= maxLength;normal.y *= maxLength; normal.z *= maxLength;
-		ort = ort + normal*maxLength;	
+		ort = ort + normal*context.maxLength;	
 	}
 
 
@@ -316,7 +316,7 @@ int		selEdge::intersect(bool isEdgeDisplaced,bool displacePlane,edge* nachbar, b
 	{
 	//	normal.x *= maxLength;normal.y *= maxLength; normal.z *= maxLength;
 
-		ort = ort + normal*maxLength;	
+		ort = ort + normal*context.maxLength;	
 	}
 
 
@@ -604,7 +604,7 @@ MPoint		selEdge::getDisplacePoint(int startID, edge* otherEdge)
 	MVector c = B - A;
 	c.normalize();
 
-	return A + c * maxLength;
+	return A + c * context.maxLength;
 
 }
 
@@ -831,12 +831,12 @@ void	selEdge::engageBevel(int connectEnds, int triangulateEnds, bool isSC)
 
 						if(isSC)
 						{		
-							tmpVec = MVector(plane[dir][3]*maxLength,plane[dir][4]*maxLength,plane[dir][5]*maxLength);
+							tmpVec = MVector(plane[dir][3]*context.maxLength,plane[dir][4]*context.maxLength,plane[dir][5]*context.maxLength);
 							newVtx[side*2+dir] = creator->addWingedDisplacedVtx(vtxIDs[side],tmpVec);				
 						}
 						else
 						{
-								tmpVec = MVector(plane[dir][3]*maxLength,plane[dir][4]*maxLength,plane[dir][5]*maxLength);
+								tmpVec = MVector(plane[dir][3]*context.maxLength,plane[dir][4]*context.maxLength,plane[dir][5]*context.maxLength);
 								tmpPos = creator->getWingedDisplacedPoint(vtxIDs[side],tmpVec);
 								insertNewVtx(tmpPos, hitsBorder);
 						}
@@ -1006,14 +1006,14 @@ finishIt:
 									{
 										if(isSC)
 										{		
-											tmpVec = MVector(plane[dir][3]*maxLength,plane[dir][4]*maxLength,plane[dir][5]*maxLength);
+											tmpVec = MVector(plane[dir][3]*context.maxLength,plane[dir][4]*context.maxLength,plane[dir][5]*context.maxLength);
 											newVtx[side*2+dir] = creator->addWingedDisplacedVtx(vtxIDs[side],tmpVec);	
 										}
 										else
 										{
 
-											tmpVec = MVector(plane[dir][3]*maxLength,plane[dir][4]*maxLength,plane[dir][5]*maxLength);
-											tmpPos = edge::creator->getWingedDisplacedPoint(vtxIDs[side],tmpVec);
+											tmpVec = MVector(plane[dir][3]*context.maxLength,plane[dir][4]*context.maxLength,plane[dir][5]*context.maxLength);
+											tmpPos = creator->getWingedDisplacedPoint(vtxIDs[side],tmpVec);
 											insertNewVtx(tmpPos,hitsBorder);
 										}
 									}
@@ -1024,12 +1024,12 @@ finishIt:
 								{
 									if(isSC)
 									{	
-										tmpVec = MVector(plane[dir][3]*maxLength,plane[dir][4]*maxLength,plane[dir][5]*maxLength);
+										tmpVec = MVector(plane[dir][3]*context.maxLength,plane[dir][4]*context.maxLength,plane[dir][5]*context.maxLength);
 										newVtx[side*2+dir] = creator->addWingedDisplacedVtx(vtxIDs[side],tmpVec);	
 									}
 									else
 									{
-										tmpVec = MVector(plane[dir][3]*maxLength,plane[dir][4]*maxLength,plane[dir][5]*maxLength); 
+										tmpVec = MVector(plane[dir][3]*context.maxLength,plane[dir][4]*context.maxLength,plane[dir][5]*context.maxLength); 
 										tmpPos = creator->getWingedDisplacedPoint(vtxIDs[side],tmpVec);
 										insertNewVtx(tmpPos,hitsBorder);
 									}
@@ -1371,7 +1371,7 @@ finishIt:
 
 					int ce[2] = {-2,-2};
 
-					edge::endFacePtrs.push_back(new endFaceData(vtxIDs[side],t, twoFacePtrs, ce, refDirs, id));
+					context.endFacePtrs.push_back(context.endFacePool.add( new (context.endFacePool.allocate()) endFaceData(vtxIDs[side],t, twoFacePtrs, ce, refDirs, id) ));
 
 				}
 				else
@@ -1408,7 +1408,7 @@ finishIt:
 					}
 
 					//jetzt das neue endFaceObjekt erzeugen
-					edge::endFacePtrs.push_back(new endFaceData(vtxIDs[side], newIDs, twoFacePtrs, ce, refDirs, id));
+					context.endFacePtrs.push_back(context.endFacePool.add( new (context.endFacePool.allocate()) endFaceData(vtxIDs[side], newIDs, twoFacePtrs, ce, refDirs, id) ));
 				}
 			}	
 		}
@@ -1727,7 +1727,7 @@ endIt:;
 
 						//jetzt muss auch noch der Slide hinzugefuegt werden - quasi nicht zur Seite sondern nach oben (richtung vtxIDs) und nach unten
 						//aber nur, wenn der vtx wirklich gerade ers erzeugt wurde
-						edge::creator->addSlideAndNormal(vtxIDs[i], edgeVtx[i], faceIDs);	
+						creator->addSlideAndNormal(vtxIDs[i], edgeVtx[i], faceIDs);	
 					}
 									
 					
@@ -1777,7 +1777,7 @@ endIt:;
 								//erstmal standrardVariante
 								/*
 								creator->getUVPositions(vtxUVs[i][a], newUVPos);
-								newUVs[a] = edge::creator->createUVs(vtxUVs[i][a], newUVPos);
+								newUVs[a] = creator->createUVs(vtxUVs[i][a], newUVPos);
 								*/
 								//die Luesung ist, dass man den nuechstgelegenen Punkt des edgeVtx auf der gegenwuertigen edge finden muss.
 								//Die Luenge dieses Vektors steht in dem Verhueltnis r zur gesamtluenge der edge.
@@ -1799,7 +1799,7 @@ endIt:;
 								}
 
 								//UVs erzeugen
-								newUVs[a] = edge::creator->createUVs(vtxUVs[i][a], newUVPos);
+								newUVs[a] = creator->createUVs(vtxUVs[i][a], newUVPos);
 								
 								//slide
 								creator->addUVSlide(newUVPos, UVPos[i], newUVs[a]);
@@ -1823,7 +1823,7 @@ endIt:;
 				}
 				
 				//man darf hier natuerlich nicht davon ausgehen, dass fuer diese Edge auch tatsuechlich Endstuecken existieren
-				if(edge::endFacePtrs.size() > 0)
+				if(context.endFacePtrs.size() > 0)
 				{			
 					std::list<endFaceData*>::iterator endIter; 
 					edgeFaceData* eTmp[2];
@@ -1848,9 +1848,9 @@ endIt:;
 							continue;
 							
 						changed = false;
-						endIter = edge::endFacePtrs.end();
+						endIter = context.endFacePtrs.end();
 						//jetzt von hinten angefangen die Liste durchsuchen nach der passenden FaceData
-						for(UINT x = static_cast<unsigned>(edge::endFacePtrs.size()); x > 0; x--)
+						for(UINT x = static_cast<unsigned>(context.endFacePtrs.size()); x > 0; x--)
 						{
 
 							endIter--;
@@ -1914,12 +1914,12 @@ endIt:;
 										if((*endIter)->newVtx[0] > creator->getInitialVtxCount() )
 											creator->getUVPositions(newUVsTmp[0],newUVPos[0]);
 										else
-											edge::creator->getUVSlideStartPoint(newUVsTmp[0], newUVPos[0]);
+											creator->getUVSlideStartPoint(newUVsTmp[0], newUVPos[0]);
 
 										if((*endIter)->newVtx[1] > creator->getInitialVtxCount() )
 											creator->getUVPositions(newUVsTmp[1],newUVPos[1]);
 										else
-											edge::creator->getUVSlideStartPoint(newUVsTmp[1], newUVPos[1]);
+											creator->getUVSlideStartPoint(newUVsTmp[1], newUVPos[1]);
 
 										//jetzt die Positionen mitteln
 										MFloatArray edgeUVPos(creator->numUVSets * 2);
@@ -1971,7 +1971,7 @@ endIt:;
 								if( (*endIter)->newVtx[a] > creator->getInitialVtxCount() )
 								{
 									//der Witz ist, dass das ganze nur funktionieren kann, wenn man das OriginalFace entsprechend veruendert
-									edge::creator->changeSideFace(vtxIDs[i], edgeVtx[i], eTmp[a]->id, newUVs[a]);
+									creator->changeSideFace(vtxIDs[i], edgeVtx[i], eTmp[a]->id, newUVs[a]);
 								}
 								else
 								{								
@@ -1979,7 +1979,7 @@ endIt:;
 									//der neue Vtx ist bereits vorhanden - die insertVtx methode des creators wird dann keinen neuen Vtx erstellen
 									//newVTx also nicht veruendern
 									//allerdings muss der edgeVtx korrekt ins originalFace eingefuegt werden mithilfe der insertVtx methode
-									edge::creator->insertVtx(eTmp[a], vtxIDs[i], edgeVtx[i], -(*endIter)->directions[a]);
+									creator->insertVtx(eTmp[a], vtxIDs[i], edgeVtx[i], -(*endIter)->directions[a]);
 									
 								}
 								
@@ -2008,11 +2008,11 @@ endIt:;
 							if(changed)
 								break;
 							
-						}//for(UINT x = edge::endFacePtrs.size(); x > 0; x--) ENDE
+						}//for(UINT x = context.endFacePtrs.size(); x > 0; x--) ENDE
 						
 					}//for(i = 0; i < 2; i++) ENDE
 
-				}//if(edge::endFacePtrs.size() > 0) ENDE
+				}//if(context.endFacePtrs.size() > 0) ENDE
 
 				//das mit den veruenderten endFaces geht jetzt automatisch seinen Gang - jetzt kann man einfach die Faces erstellen - 2 an der Zahl
 				newFaceIDs.setLength(4);
@@ -2115,10 +2115,10 @@ UVDoDiffer:
 						origUVs = faceData[myDir]->getEdgeVtxUVs(vtxIDs[i]);
 
 						MFloatArray origUVPos;	//huelt die Positionen der origUVs
-						edge::creator->getUVPositions(origUVs, origUVPos);
+						creator->getUVPositions(origUVs, origUVPos);
 
 						//jetzt neue UVs erzeugen fuer origUVs
-						MIntArray newUVs = edge::creator->createUVs(origUVs, origUVPos);
+						MIntArray newUVs = creator->createUVs(origUVs, origUVPos);
 
 						//vor dem assignment muss natuerlich der edgeVtx natuerlich auch noch eingefuegt werden!!!!
 						//tmpFace.insertEdgeVtx(vtxIDs[i], edgeVtx[i], (isFlipped[0]) ? ( (i == 0) ? false : true) : ((i == 0) ? true : false) );
@@ -2297,7 +2297,7 @@ void	selEdge::insertNewVtx(MPoint& inPoint, bool specialMode)
 		
 		
 			
-			if( origVtxDoneBA.isFlagSet(vtxIDs[side]) & !specialMode ) //nur wenn der Vtx noch nicht auf der Liste ist, wird seine neue Position ins positionsArray hinzugefuegt
+			if( context.origVtxDoneBA.isFlagSet(vtxIDs[side]) & !specialMode ) //nur wenn der Vtx noch nicht auf der Liste ist, wird seine neue Position ins positionsArray hinzugefuegt
 			{
 				
 				newVtx[side*2+dir] = vtxIDs[side];
@@ -2306,7 +2306,7 @@ void	selEdge::insertNewVtx(MPoint& inPoint, bool specialMode)
 
 				INVIS(cout<<"HABE Vtx "<<vtxIDs[side]<<" newVtx zugewiesen"<<endl;)
 					
-				origVtxDoneBA.setBitFalse(vtxIDs[side]);				
+				context.origVtxDoneBA.setBitFalse(vtxIDs[side]);				
 				
 			
 			}
@@ -2360,10 +2360,10 @@ void	selEdge::createSmallChamferFaces()
 	for(int i = 0; i < 2; i++)
 	{
 		//wenn nur ein nachbar, dann existieren keine smallFaces auf dieser Seite, oder on Boder
-		if( smallFaceClean[i] || origVtxDoneBA[vtxIDs[i]] || nachbarn[i][0] == nachbarn[i][1] || (nachbarn[i][0]->getFaces()).length() == 1 )
+		if( smallFaceClean[i] || context.origVtxDoneBA[vtxIDs[i]] || nachbarn[i][0] == nachbarn[i][1] || (nachbarn[i][0]->getFaces()).length() == 1 )
 			continue;
 		
-		origVtxDoneBA.setBitTrue(vtxIDs[i]);
+		context.origVtxDoneBA.setBitTrue(vtxIDs[i]);
 		
 
 		smallFaceClean[i] = true;
@@ -2423,7 +2423,7 @@ void	selEdge::createSmallChamferFaces()
 			
 			//tmpFace erzeugen
 			
-			edgeFaceData* tmpFace = new edgeFaceData(0);
+			edgeFaceData* tmpFace = new edgeFaceData(0, creator->numUVSets);
 			
 			int thisVtx;
 			if(edgeVtx[i] > -1)
@@ -2494,10 +2494,10 @@ void	selEdge::createSmallChamferFaces()
 				
 				MFloatArray UVPos;
 				MIntArray vtxUVs = faceData[a]->getEdgeVtxUVs(vtxIDs[i]);
-				edge::creator->getUVPositions(vtxUVs, UVPos);
+				creator->getUVPositions(vtxUVs, UVPos);
 				
 				//merke - die UVs muessen auch gemittelt werden - bzw. man uss sie der prozedur mitgeben
-				MIntArray tmpArray = edge::creator->createUVs(vtxUVs, UVPos);
+				MIntArray tmpArray = creator->createUVs(vtxUVs, UVPos);
 				tmpFace->assignUV(centerVtx, tmpArray);
 
 				
@@ -2654,7 +2654,7 @@ void		selEdge::C_initFaceData(edgeFaceData* thisFace, int thisVtx, edgeFaceData*
 	if(isNew)
 	{
 		UINT lid;
-		if(edge::creator->helper.getLocIndex(thisVtx,refFace->vtxChange, lid))
+		if(creator->helper.getLocIndex(thisVtx,refFace->vtxChange, lid))
 		{//der dazugehuerige vtx kann jetzt im normalindices array gesucht werden
 			if(creator->helper.isOnArray(refFace->vtxChange[lid-1], refFace->normalIndices))
 			{
@@ -2739,7 +2739,7 @@ UINT		selEdge::C_addVtx(int requesterID,const selEdge* requester, edgeFaceData*
 	{
 		//wir haben keinen edgeVtx, braeuchten aber einen - also einfach ein eigenes Face erstellen und das alte unverndert zurueckgeben
 		
-		edgeFaceData* tmpFace = new edgeFaceData(0);
+		edgeFaceData* tmpFace = new edgeFaceData(0, creator->numUVSets);
 		
 		
 		C_initFaceData(tmpFace, newVtx[s*2+r], faceData[r],true);
@@ -2755,10 +2755,10 @@ UINT		selEdge::C_addVtx(int requesterID,const selEdge* requester, edgeFaceData*
 		
 		MFloatArray UVPos;
 		MIntArray vtxUVs = faceData[1-r]->getEdgeVtxUVs(vtxIDs[s]);
-		edge::creator->getUVPositions(vtxUVs, UVPos);
+		creator->getUVPositions(vtxUVs, UVPos);
 
 
-		MIntArray tmpArray = edge::creator->createUVs(vtxUVs, UVPos);
+		MIntArray tmpArray = creator->createUVs(vtxUVs, UVPos);
 		tmpFace->assignUV(centerVtx, tmpArray);
 
 		if( (s == 1) ? isFlipped[r] : isFlipped[1-r])
@@ -2782,7 +2782,7 @@ UINT		selEdge::C_addVtx(int requesterID,const selEdge* requester, edgeFaceData*
 	MIntArray lastVtxUVs = fData->getEdgeVtxUVs(fData->faceVertices[fData->faceVertices.length() -1]);
 //	INVIS(creator->helper.printArray(lastVtxUVs, " = LASTVTX UVS!!!!!!!!!!!!!!!"));
 //	INVIS(creator->helper.printArray(faceData[r]->getNewVtxUVs(newVtx[s*2+r]), " = NEWVTX OTHERFACE UVS!!!!!!!!!!!!!!!!!"));
-	UVsDiffer = edge::creator->helper.UVSetDiffers(lastVtxUVs, faceData[r]->getNewVtxUVs(newVtx[s*2+r]));
+	UVsDiffer = creator->helper.UVSetDiffers(lastVtxUVs, faceData[r]->getNewVtxUVs(newVtx[s*2+r]));
 
 
 
@@ -2841,7 +2841,7 @@ createOtherFace:
 		//FACE ERSTELLEN ____________________________________________________ ->Dies manuell machen, da die CAddVtx methode mindesten einen Vtx braucht als referenz
 
 		//Okay, jetzt erstmal ein eigenes Face erzeugen, den EdgeVtx und den newVtx hinzufuegen
-		edgeFaceData* tmpFace = new edgeFaceData(0);
+		edgeFaceData* tmpFace = new edgeFaceData(0, creator->numUVSets);
 		
 
 
@@ -2864,10 +2864,10 @@ createOtherFace:
 				
 				MFloatArray UVPos;
 				MIntArray vtxUVs = faceData[1-r]->getEdgeVtxUVs(vtxIDs[s]);
-				edge::creator->getUVPositions(vtxUVs, UVPos);
+				creator->getUVPositions(vtxUVs, UVPos);
 							
 
-				tmpArray = edge::creator->createUVs(vtxUVs, UVPos);
+				tmpArray = creator->createUVs(vtxUVs, UVPos);
 				tmpFace->assignUV(centerVtx, tmpArray);
 
 				
@@ -2877,7 +2877,7 @@ createOtherFace:
 					tmpFace->invert();
 				
 				//dreieck erstellen, nachde der centerVtx daraufgepackt wurde
-				edge::creator->createPoly(tmpFace);
+				creator->createPoly(tmpFace);
 				
 				//jetzt einfach den UVsDiffer Flag auschalten und die Sach nochmal ablaufen lassen von marker aus
 				UVsDiffer = false;
@@ -2929,10 +2929,10 @@ createOtherFace:
 		
 		MFloatArray UVPos;
 		MIntArray vtxUVs = faceData[1-r]->getEdgeVtxUVs(vtxIDs[s]);
-		edge::creator->getUVPositions(vtxUVs, UVPos);
+		creator->getUVPositions(vtxUVs, UVPos);
 
 
-		MIntArray tmpArray = edge::creator->createUVs(vtxUVs, UVPos);
+		MIntArray tmpArray = creator->createUVs(vtxUVs, UVPos);
 		tmpFace->assignUV(centerVtx, tmpArray);
 
 		
@@ -3012,7 +3012,7 @@ bool		selEdge::C_queryCenterVtx(int requesterID,edge* lastEdge, MIntArray& newVt
 	//darum kuemmert sich die addVtx prozedur
 	if( (edgeVtx[s] > -1) & (centerVtxID == -1) )
 	{//position ist egal erstmal
-		centerVtxID = edge::creator->newVtx(MPoint());
+		centerVtxID = creator->newVtx(MPoint());
 	}
 
 	if(opposite == 0)
@@ -47,8 +47,8 @@ class selEdge : public edge
 {
 
 public:
-	selEdge(int inID);
-	selEdge(MIntArray inFaceIDs,int inID);
+	selEdge(edgeContext& inContext, int inID);
+	selEdge(edgeContext& inContext, MIntArray inFaceIDs,int inID);
 	virtual ~selEdge();
 
 
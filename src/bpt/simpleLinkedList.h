@@ -27,127 +27,40 @@
 #pragma once
 #endif // _MSC_VER > 1000
 
-#include "linkedNode.h"
+#include <vector>
 
 
+/** Liste von Zeigern, die ihre Objekte nicht besitzt - sie werden beim Loeschen der Liste nicht mit geloescht.
+
+	Trotz des Namens liegen die Zeiger zusammenhaengend in einem Array: operator[] ist O(1), und die Indizes bleiben
+	stabil, da nur angehaengt wird. Frueher wurden die Knoten einer verketteten Liste rekursiv abgelaufen, was bei
+	grossen Netzwerken aus faces und edges quadratisch wurde.
+*/
+
 template <class T>
 class simpleLinkedList  
 {
 public:
-	simpleLinkedList<T>()
-		: currentPositionPtr(0)
-		, startPosition(0) 
-		, tail(new linkedNode<T>)
-		, currentPosition(0)
-		, size(0)
-		
-	{ }
-	simpleLinkedList<T>(const simpleLinkedList<T>& other){ }
-	~simpleLinkedList<T>(){/*cout<<"RUFE SIMPLELINKEDLIST DESTRUKTOR"<<endl;*/ tail->next = 0; delete tail; if(size != 0){ delete startPosition;}  }
+	simpleLinkedList<T>() { }
+
+	unsigned length() const { return (unsigned)objects.size(); }
 
-	unsigned length() { return size; }
+	//! Reserviert Platz fuer count Zeiger, damit beim Aufbau nicht umkopiert werden muss
+	void	reserve(unsigned count) { objects.reserve(count); }
 
-	void append(T* object);
+	void	append(T* object) { objects.push_back(object); }
 
-	void	clear(){ tail->next = 0;delete tail; if(size != 0){ delete startPosition;} }
+	void	clear() { objects.clear(); }
 
 
-	T*& operator[]( unsigned index ); //Dieser operator erlaubt auch zuweisung, der untere nicht
+	T*& operator[]( unsigned index ) { return objects[index]; } //Dieser operator erlaubt auch zuweisung, der untere nicht
 	
-	T* operator[]( unsigned index ) const;
+	T* operator[]( unsigned index ) const { return objects[index]; }
 
 
 private:
 
-	linkedNode<T>* currentPositionPtr;
-
-	linkedNode<T>* startPosition;
-
-	linkedNode<T>* tail;
-
-	
-	unsigned currentPosition;
-	unsigned size ;
+	std::vector<T*>	objects;
 };
 
-
-
-template <class T>
-void simpleLinkedList<T>::append(T* object)
-{
-	if(size == 0)
-	{
-		linkedNode<T>* node = new linkedNode<T>(object);
-		tail->next = node;	//im nextSlot von tial ist immer die letzte gueltige node gespeichert (next ist sozusagen last)
-		startPosition = currentPositionPtr = node;
-	}
-	else
-	{
-		linkedNode<T>* node = new linkedNode<T>(object);
-		tail->next->next = node;
-		tail->next = node;
-		//node wird nie mit tail verbunden, damit die destruction noch funzt
-	}
-	++size;
-}
-
-
-template <class T>
-T*& simpleLinkedList<T>::operator[]( unsigned index )
-{
-	linkedNode<T>* tmpNode = 0;
-
-//	if(index >= size || index < 0)
-//	{
-//		cout<<"WARNUNG, Index zu gross, habe ihn korrigiert"<<endl;
-//		index = size - 1;
-//	}
-//	cout<<"SL: Index vs Size: "<<index<<" vs "<<size<<endl;
-	//kein Check, ob index ueber die vorhandenen slots hinaus geht
-	if(index >= currentPosition)
-	{
-		currentPositionPtr->getIndex(currentPosition,index,tmpNode);
-		currentPosition = index; currentPositionPtr = tmpNode; 
-		return tmpNode->getValue();
-	}
-	else
-	{//ansonsten wieder von 0 anfangen zu zhlen
-		currentPosition = index;
-		startPosition->getIndex(0,index,tmpNode);
-		currentPositionPtr = tmpNode;
-		return tmpNode->getValue();
-	}
-	
-	
-}
-
-template <class T>
-T* simpleLinkedList<T>::operator[]( unsigned index ) const
-{
-//	if(index >= size)
-//{
-	//	cout<<"WARNUNG, Index zu gross, habe ihn korrigiert"<<endl;
-	//	index = size - 1;
-	//}
-
-//	cout<<"SL: Index vs Size: "<<index<<" vs "<<size<<endl;
-
-	linkedNode<T>* tmpNode = 0;
-	//kein Check, ob index ueber die vorhandenen slots hinaus geht
-	if(index >= currentPosition)
-	{
-		currentPositionPtr->getIndex(currentPosition,index,tmpNode);
-		currentPosition = index; currentPositionPtr = tmpNode; 
-		return tmpNode->getValue();
-	}
-	else
-	{//ansonsten wieder von 0 anfangen zu zhlen
-		currentPosition = index;
-		startPosition->getIndex(0,index,tmpNode);
-		currentPositionPtr = tmpNode;
-		return tmpNode->getValue();
-	}
-	
-}
-
 #endif // !defined(AFX_SIMPLELINKEDLIST_H__A9303B1E_487E_4EDA_920F_2CD39FED5918__INCLUDED_)
@@ -0,0 +1,103 @@
+/*
+ * Copyright (C) 2002 Sebastian Thiel
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ */
+
+#include "slideKernel.h"
+
+#include <maya/MFnMesh.h>
+
+#include <stddef.h>
+
+
+//-----------------------------------------------------------------------------------------
+void	slideKernel::resize(uint numEntries, uint inNumTerms)
+//-----------------------------------------------------------------------------------------
+{
+	numTerms = ( inNumTerms > (uint)kNumTerms ) ? (uint)kNumTerms : inNumTerms;
+
+	vtx.resize(numEntries);
+	bx.resize(numEntries);
+	by.resize(numEntries);
+	bz.resize(numEntries);
+
+	for( uint t = 0; t < numTerms; t++ )
+	{
+		term& tm = terms[t];
+
+		tm.x.resize(numEntries);
+		tm.y.resize(numEntries);
+		tm.z.resize(numEntries);
+
+		// Nicht gesetzte Vektoren zeigen auf kZero und tragen damit nichts bei
+		tm.w.assign(numEntries, 0.0);
+		tm.f.assign(numEntries, (unsigned char)kZero);
+	}
+}
+
+
+//-----------------------------------------------------------------------------------------
+void	slideKernel::apply(MFnMesh& meshFn, const double* factors)
+//-----------------------------------------------------------------------------------------
+{
+	const int l = (int)vtx.size();
+
+	if( l == 0 )
+		return;
+
+
+	meshFn.getPoints(meshPoints);
+
+	results.resize( (size_t)l * 3 );
+
+
+	double*			out = &results[0];
+	const uint		nt = numTerms;
+
+#ifdef _OPENMP
+	#pragma omp parallel for schedule(static)
+#endif
+	for( int i = 0; i < l; i++ )
+	{
+		double px = bx[i], py = by[i], pz = bz[i];
+
+		for( uint t = 0; t < nt; t++ )
+		{
+			const term&		tm = terms[t];
+			const double	c = factors[ tm.f[i] ] * tm.w[i];
+
+			px += c * tm.x[i];
+			py += c * tm.y[i];
+			pz += c * tm.z[i];
+		}
+
+		double* p = out + (size_t)i * 3;
+		p[0] = px;	p[1] = py;	p[2] = pz;
+	}
+
+
+	// Eintragen seriell - ob MPointArray parallele Schreibzugriffe vertraegt, ist nicht dokumentiert
+	for( int i = 0; i < l; i++ )
+	{
+		const double* p = out + (size_t)i * 3;
+		MPoint& point = meshPoints[ vtx[i] ];
+
+		point.x = p[0];	point.y = p[1];	point.z = p[2];
+	}
+
+
+	meshFn.setPoints(meshPoints);
+}
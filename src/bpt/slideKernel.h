@@ -0,0 +1,120 @@
+/*
+ * Copyright (C) 2002 Sebastian Thiel
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ */
+
+#ifndef SLIDE_KERNEL_INCLUDE
+#define SLIDE_KERNEL_INCLUDE
+
+#include <maya/MPoint.h>
+#include <maya/MPointArray.h>
+#include <maya/MVector.h>
+
+#include <MACROS.h>
+
+#include <vector>
+
+
+class MFnMesh;
+
+namespace BPT
+{
+
+/** Wertet einen Slide fuer alle betroffenen Vertizen in einem Durchgang aus.
+
+	Jeder Eintrag ist ein Basispunkt plus bis zu kNumTerms Vektoren:
+
+		p = base + factors[ f0 ] * w0 * v0 + ... + factors[ f3 ] * w3 * v3
+
+	Alles, was vom Modus abhaengt (Seite, relativ/absolut, die Skalierungen der Richtungen und Normalen), steckt in
+	base, den Gewichten w und der Wahl des Faktors f - es wird von den ftys einmal pro Aufruf aufgeloest.
+	Die Faktoren selbst (slide, normal, die geclampten Werte der SMC) sind fuer alle Vertizen gleich und werden erst bei
+	apply uebergeben. Die Schleife ueber die Vertizen hat so keine Verzweigungen mehr und laeuft parallel.
+
+	Die Daten liegen als SoA vor - pro Komponente ein Array.
+*/
+
+class slideKernel
+{
+public:
+
+	//! Index in das factors Array von apply
+	enum factor
+	{
+		kZero = 0,
+		kOne,
+		kSlide,
+		kNormal,
+		kClampX,
+		kClampY,
+		kNormalClampX,		//!< normal * clampNormalX(slide)
+		kNormalClampY,		//!< normal * clampNormalY(slide)
+		kNumFactors
+	};
+
+	enum	{	kNumTerms = 4	};
+
+
+	slideKernel() : numTerms(0) {}
+
+	//! Bereitet numEntries Eintraege mit numTerms Vektoren vor - nicht gesetzte Vektoren tragen nichts bei
+	void	resize(uint numEntries, uint numTerms);
+
+	uint	length() const { return (uint)vtx.size(); }
+
+	//! Eintrag i verschiebt den Vertex vtxID, ausgehend von base
+	void	setBase(uint i, int vtxID, const MPoint& base)
+	{
+		vtx[i] = vtxID;
+		bx[i] = base.x;	by[i] = base.y;	bz[i] = base.z;
+	}
+
+	//! Setzt den Vektor t des Eintrags i, er wird mit factors[f] * weight skaliert
+	void	setTerm(uint t, uint i, const MVector& v, factor f, double weight)
+	{
+		term& tm = terms[t];
+
+		tm.x[i] = v.x;	tm.y[i] = v.y;	tm.z[i] = v.z;
+		tm.f[i] = (unsigned char)f;
+		tm.w[i] = weight;
+	}
+
+	//! Berechnet alle Eintraege mit den gegebenen Faktoren (kNumFactors Stueck, factors[kZero] muss 0 sein),
+	//! traegt sie in die Punkte des Meshes ein und schreibt diese mit einem einzigen setPoints zurueck
+	void	apply(MFnMesh& meshFn, const double* factors);
+
+private:
+
+	struct term
+	{
+		std::vector<double>			x, y, z;
+		std::vector<double>			w;
+		std::vector<unsigned char>	f;
+	};
+
+	std::vector<int>	vtx;
+	std::vector<double>	bx, by, bz;
+
+	term	terms[kNumTerms];
+	uint	numTerms;
+
+	std::vector<double>	results;	//!< xyz pro Eintrag, parallel berechnet
+	MPointArray			meshPoints;	//!< Punkte des Meshes - beide bleiben erhalten, damit beim scrubben nicht alloziert wird
+};
+
+}
+
+#endif
@@ -21,10 +21,60 @@
 //////////////////////////////////////////////////////////////////////
 
 #include "softTransformationEngine.h"
+#include "pointGrid.h"
+#include <algorithm>
 #include <maya/MFnDagNode.h>
+#include <maya/MFloatArray.h>
 
 #include "mayabaselib/ogl_headers.h"
 
+
+//////////////////////////////////////////////////////////////////////
+// Falloff Funktionen
+//////////////////////////////////////////////////////////////////////
+
+static const int	falloffLUTSize = 256;			// Zahl der Samples der falloffRamp
+
+static const double	shallowSlope = 0.0936210973;	// tan(0.093349) - Steigung der nicht flachen Tangente von spike und dome
+
+
+// Hermite Kurve von (0,0) nach (1,1) mit den Steigungen m0 und m1 - entspricht einer AnimCurve mit 2 Keys und 
+// konstanter Extrapolation
+static inline double	hermiteFalloff(double t, double m0, double m1)
+{
+	t = ( t < 0.0 ) ? 0.0 : ( ( t > 1.0 ) ? 1.0 : t );
+
+	const double t2 = t * t;
+	const double t3 = t2 * t;
+
+	return ( 3.0 * t2 - 2.0 * t3 ) + m0 * ( t3 - 2.0 * t2 + t ) + m1 * ( t3 - t2 );
+}
+
+
+// Linear interpolierter Zugriff auf die abgetastete Ramp
+static inline double	lookupFalloff(double t, const float* lut)
+{
+	t = ( t < 0.0 ) ? 0.0 : ( ( t > 1.0 ) ? 1.0 : t );
+
+	const double	pos = t * (falloffLUTSize - 1);
+	const int		i = std::min( (int)pos, falloffLUTSize - 2 );
+	const double	f = pos - i;
+
+	return lut[i] * (1.0 - f) + lut[i+1] * f;
+}
+
+
+
+// Vergleicht Indizes anhand der zugehoerigen Distanz - fuer die Sortierung des distanceCaches
+struct	nearestLess
+{
+	const std::vector<double>&	dist;
+
+	nearestLess(const std::vector<double>& inDist) : dist(inDist) {}
+
+	bool	operator () (unsigned a, unsigned b) const { return dist[a] < dist[b]; }
+};
+
 //////////////////////////////////////////////////////////////////////
 // Statische Objekte
 //////////////////////////////////////////////////////////////////////
@@ -54,19 +104,34 @@ MObject softTransformationEngine::customSl;
 
 softTransformationEngine::softTransformationEngine()
 : mayCreateIdleEvent(true)
-, animFnInitialized(false)
 , lastDistance(-1.0)
 , lastFType(50000U)
 , lastMaxWeights(-1)
 , lastSmoothen(-1)
 , lastEdgeDistance(0)
+, lastGeodesic(false)
 {
 
 }
 
 softTransformationEngine::~softTransformationEngine()
 {
+	// Wie bei der visualizeMeshNode: die VBOs koennen nur mit aktivem Kontext freigegeben werden
+	if( !dd.buffers.hasBuffers() )
+		return;
+
+	MHardwareRenderer* renderer = MHardwareRenderer::theRenderer();
+	if( !renderer || !renderer->glFunctionTable() )
+		return;
+
+	MStatus status;
+	M3dView view = M3dView::active3dView(&status);
+	if( !status )
+		return;
 
+	view.beginGL();
+	dd.buffers.release( renderer->glFunctionTable() );
+	view.endGL();
 }
 
 
@@ -138,6 +203,8 @@ void	softTransformationEngine::gatherAttributeObjects(const MObject& inThisNode)
 
 		edgeDistanceObj = depFn.attribute("edgeDistance");
 
+		geodesicObj = depFn.attribute("geodesicDistance");
+
 		useMatrixRotationObj = depFn.attribute("useMatrixRotation");
 
 		pushObj = depFn.attribute("push");
@@ -152,6 +219,8 @@ void	softTransformationEngine::gatherAttributeObjects(const MObject& inThisNode)
 
 		pointSizeObj = depFn.attribute("pointSize");
 
+		falloffRampObj = depFn.attribute("falloffRamp");
+
 
 	//	customSlO = depFn.attribute("customSlFalloff");
 	}
@@ -208,6 +277,10 @@ MStatus		softTransformationEngine::extractNonstaticData(const MPlug& plug,
 	// falloffType holen
 	nd.fType = data.inputValue(ftObj).asShort();
 
+	// Die ramp wird nur abgetastet, wenn sie auch verwendet wird
+	if( nd.fType == 4 )
+		updateFalloffLUT();
+
 
 	nd.fVis = data.inputValue(vfObj).asBool();
 
@@ -224,6 +297,9 @@ MStatus		softTransformationEngine::extractNonstaticData(const MPlug& plug,
 	// edgeDistance holen
 	nd.edgeDistance = data.inputValue(edgeDistanceObj).asLong();
 
+	// geodesic holen
+	nd.useGeodesic = data.inputValue(geodesicObj).asBool();
+
 
 	// Bool useMatrixRotation holen
 	nd.useMatrixRotation = data.inputValue(useMatrixRotationObj).asBool();
@@ -297,6 +373,11 @@ MStatus		softTransformationEngine::extractStaticData(const MPlug& plug, MDataBlo
 
 	// und zuguterletzt das inMesh, welches nur zum lesen der origPos der TweakParents benutzt werden darf
 	nd.inMesh = data.inputValue(inMesh).asMesh();
+
+
+	// vtxSet und vtxOrigPos koennen sich bei gleicher Laenge geaendert haben - die Kandidaten des distanceCaches
+	// beruhen aber auf genau diesen parents und Positionen, also muss er neu gesammelt werden
+	dc.clear();
  
 
 	
@@ -355,6 +436,8 @@ bool	softTransformationEngine::rebuildTweakArrays()
 		l = inVertIter.count();		//da das inMesh verwendet wird, sind die neuen Vtx im Falle einer meshModifizierenden Node automatisch ausgeschlossen
 
 
+		dc.clear();			// die Kandidaten gehoeren zu den alten potVtx
+
 		vd.potVtx.setLength(l);	//potentielle TweakVtx, 
 		
 		// array fuellen:
@@ -389,6 +472,8 @@ bool	softTransformationEngine::rebuildTweakArrays()
 		//einfach die gegenwuertigen Positionen der origVtx holen
 		l = vd.vtxSet.length();
 
+		dc.clear();			// die Kandidaten beziehen sich auf die alten origPos
+
 		vd.vtxOrigPos.setLength(l);
 
 		for(i = 0; i < l; i++)
@@ -428,28 +513,7 @@ bool	softTransformationEngine::rebuildTweakArrays()
 
 
 //-----------------------------------------------------------------------------------------
-void	softTransformationEngine::copyArrayPartial(MIntArray& copyTo, 
-												   const MIntArray& copyFrom, 
-												   uint inclMinID, 
-												   uint exclMaxID)
-//-----------------------------------------------------------------------------------------
-{
-
-	uint i, l = exclMaxID - inclMinID;
-
-	copyTo.setLength(l);
-
-
-	for( i = 0; i < l; i++, inclMinID++)
-	{
-		copyTo[i] = copyFrom[inclMinID];
-	}
-
-}
-
-
-//-----------------------------------------------------------------------------------------
-void	softTransformationEngine::resampleWeights()
+void	softTransformationEngine::resampleWeights(const MPointArray& inPoints)
 //-----------------------------------------------------------------------------------------
 {
 
@@ -480,38 +544,27 @@ void	softTransformationEngine::resampleWeights()
 		myMultiplier = ( (double)lastEdgeDistance / (double)( lastEdgeDistance - i - 1) ) * ( (double) (nd.edgeDistance - i - 1)  / (double)nd.edgeDistance );
 
 
-		for( ; min < max; min++ )
+		// Die weights des ganzen rings liegen hintereinander
+		l = td.offsets[max];
+		for( x = td.offsets[min]; x < l; x++ )
 		{
 			
-			MDoubleArray&	weights = td.bWeights[min];
-			
-			
-			l = weights.length();
-			for(x = 0; x < l; x++)
-			{
-				
-				weights[x] *= myMultiplier ;
-				
-			}
+			td.bWeights[x] *= myMultiplier ;
 			
 		}
+
+		min = max;
 		
 	}
 	
 
 	// i hat jetzt den richtigen wert und zeigt auf den letzten (0) ring
-	// min zeigt auf den ersten ringVtx, und max wird entsprechend gesetzt, spueter
-	// Jetzt wie gewohnt die weights ausrechnen
+	// min zeigt auf den ersten ringVtx dieses rings
+	// Jetzt wie gewohnt die weights ausrechnen - die Eintraege existieren bereits
 
 	if( add == 1)
 	{
-		// vtxID array erzeugen:
-		MIntArray outerRing;
-		
-		copyArrayPartial(outerRing, td.vtx, min, max + ec.ringCounts[i]);
-		
-		MItMeshVertex inVertIter(nd.inMesh);
-		generateEdgeWeights(outerRing, i, inVertIter, min);
+		generateEdgeWeights(min, min + ec.ringCounts[i], i, inPoints);
 	}
 
 }
@@ -640,159 +693,117 @@ void	softTransformationEngine::generateNormalVectors()
 
 
 //-----------------------------------------------------------------------------------------
-void	softTransformationEngine::generateEdgeWeights(	const MIntArray& vtxSet, 
+void	softTransformationEngine::generateEdgeWeights(	uint firstTweak, 
+														uint endTweak, 
 														uint i, 
-														MItMeshVertex& inVertIter, 
-														int minID)
+														const MPointArray& inPoints)
 //-----------------------------------------------------------------------------------------
 {
+	// Die Eintraege der TweakVtx existieren bereits - hier werden nur pVtxPosIDs und bWeights gefuellt
+	// Jeder TweakVtx schreibt nur seinen eigenen Bereich, also kann parallel gerechnet werden
 
-	MPoint startPoint;
-	
-	uint	x, 
-			l2, 
-			y, 
-			l, 
-			maxWeights;
+	const int	l = (int)vd.vtxSet.length();
+	const uint	numInPoints = inPoints.length();
 
-	int		tmp;
-	
-	double	sumWeights, 
-			newSumWeights, 
-			dTmp, 
-			inverse;
-	
+	// Die Weights werden entsprechend ihrer edgeDistance abgeschwaecht
+	const double	ringScale = (double)(nd.edgeDistance - i - 1) / (double) nd.edgeDistance;
 
-	l = vd.vtxSet.length();
-	l2 = vtxSet.length();
-	for( x = 0; x < l2; x++)
+#ifdef _OPENMP
+	#pragma omp parallel
+#endif
 	{
-		
-		inVertIter.setIndex( vtxSet[x] ,tmp);
-		startPoint = inVertIter.position();
-		
-		map<double, int>	weights;			// Speichert die weights (als key) zusammen mit den dazugehuerigen localPosIDs
-		
-		
-		// Jetzt die Distanzen zu allen vtxSetMitgliedern ausrechnen und auf jeden Fall aufs weightArray hauen
-		for(y = 0; y < l; y++)
-		{
-			weights.insert( wp( ( vd.vtxOrigPos[y] - startPoint).length(), y ) );
-		}
-		
-		
-		// Nun die Weigths entsprechend des maxWeigthsParams
-		maxWeights = static_cast<unsigned>((weights.size() < (uint)nd.maxWeights) ? weights.size() : (uint)nd.maxWeights) ; 
-		
-		
-		
-		
-		
-		// jetzt die weights extrahieren die pVtxPosIDs
-		MDoubleArray* dWeights;
-		MIntArray*	pVtxPosIDs;
+		vector<wp>	weights(l);			// Speichert die distanzen zusammen mit den dazugehuerigen localPosIDs - pro thread
 
-		if( minID == -1)
+#ifdef _OPENMP
+		#pragma omp for schedule(dynamic, 64)
+#endif
+		for( int t = (int)firstTweak; t < (int)endTweak; t++ )
 		{
-			// Aha, also sollen die arrays angehuengt werden - wir erzeugen neue Arrays im heap
-			dWeights = new MDoubleArray(maxWeights);
-
-			pVtxPosIDs = new MIntArray(maxWeights);
+			const int	tweakVtx = td.vtx[t];
 
+			// Neue Vtx einer topologieveraendernden Node haben keine InputPosition
+			const MPoint	startPoint = ( (uint)tweakVtx < numInPoints ) ? inPoints[tweakVtx] : MPoint::origin;
 			
-			// Man muss hier nicht checken, ob es weights gibt - einVtxSet mitglied gibts mindestens
-			// TweakArrays updatan, aber nur, wenn man auch wirklich im AppendMode ist
-			td.vtx.append(vtxSet[x]);
-	
-		}
-		else
-		{
-			// Existierende arrays modifiezieren - also die Ptr mit referenzen bestuecken
+			
+			// Jetzt die Distanzen zu allen vtxSetMitgliedern ausrechnen 
+			for( int y = 0; y < l; y++)
+			{
+				weights[y] = wp( ( vd.vtxOrigPos[y] - startPoint).length(), y );
+			}
+			
+			
+			// Nun die Weigths entsprechend des maxWeigthsParams - nur die kleinsten Distanzen muessen sortiert sein
+			const uint	maxWeights = td.numWeights(t);
 
-			// minID ist in diesem Fall der Offset
-			dWeights = &(td.bWeights[minID + x]);
+			if( maxWeights == 0 )
+				continue;
 
-			pVtxPosIDs = &(td.pVtxPosID[minID + x]);
+			std::partial_sort(weights.begin(), weights.begin() + maxWeights, weights.end());
+			
 
-		}
+			double*	dWeights = &td.bWeights[ td.offsets[t] ];
+			int*	pVtxPosIDs = &td.pVtxPosID[ td.offsets[t] ];
 
-		
-		std::map<double, int>::iterator	iter = weights.begin();
-		
-		sumWeights = newSumWeights = 0.0;
-		
-		
-		
-		
-		// Pass 1: Daten uebertragen in arbeitsArray
-		for( y = 0; y < maxWeights; y++, iter++)
-		{
-			(*pVtxPosIDs)[y] = iter->second;
+			double	sumWeights = 0.0, 
+					newSumWeights = 0.0, 
+					dTmp, 
+					inverse;
 			
+			uint	y;
 			
-			(*dWeights)[y] = iter->first;
-			
-			
-			sumWeights += (*dWeights)[y];
-			
-		}
-		
-		
-		
-		
-		// Pass 2: Vtx entsprechend ihrer relativen Distanzen zueinander: Vtx nueher am Parent sollen stuerker transformieren
-		//	und alles anhand des gegenwuertigen edgeCounts skalieren
-		if( maxWeights > 1 )
-		{
 			
+			// Pass 1: Daten uebertragen in arbeitsArray
 			for( y = 0; y < maxWeights; y++)
 			{
-				dTmp = (*dWeights)[y];
-				
-				inverse = sumWeights - dTmp;
+				pVtxPosIDs[y] = weights[y].second;
 				
-				dTmp = sumWeights / (dTmp / (pow( (float) inverse, nd.smoothen) ) );
+				dWeights[y] = weights[y].first;
 				
-				newSumWeights += dTmp;
+				sumWeights += dWeights[y];
 				
-				(*dWeights)[y] = dTmp;
 			}
 			
 			
 			
 			
-			
-			// Pass 3:Die weights wieder runterskalieren mit newSum und sie entsprechend ihrer edgeDistance abschwuechen
-			// hier kommt auch noch der scaleParameter zum tragen - er skaliert die dustanz - je weiter weg, desto stuerker ist sein effekt
-			for( y = 0; y < maxWeights; y++)
+			// Pass 2: Vtx entsprechend ihrer relativen Distanzen zueinander: Vtx nueher am Parent sollen stuerker transformieren
+			//	und alles anhand des gegenwuertigen edgeCounts skalieren
+			if( maxWeights > 1 )
 			{
-				dTmp = (*dWeights)[y];
 				
-				(*dWeights)[y] = dTmp = ( dTmp / newSumWeights ) * ( (double)(nd.edgeDistance - i - 1) / (double) nd.edgeDistance ) ;
+				for( y = 0; y < maxWeights; y++)
+				{
+					dTmp = dWeights[y];
+					
+					inverse = sumWeights - dTmp;
+					
+					dTmp = sumWeights / (dTmp / (pow( (float) inverse, nd.smoothen) ) );
+					
+					newSumWeights += dTmp;
+					
+					dWeights[y] = dTmp;
+				}
+				
+				
+				
+				
+				
+				// Pass 3:Die weights wieder runterskalieren mit newSum und sie entsprechend ihrer edgeDistance abschwuechen
+				// hier kommt auch noch der scaleParameter zum tragen - er skaliert die dustanz - je weiter weg, desto stuerker ist sein effekt
+				for( y = 0; y < maxWeights; y++)
+				{
+					dWeights[y] = ( dWeights[y] / newSumWeights ) * ringScale ;
+				}
+				
+			}
+			else
+			{
+				
+				dWeights[0] = 1.0  * ringScale ;
+				
 			}
 			
-		}
-		else
-		{
-			
-			(*dWeights)[0] = 1.0  * ( (double)(nd.edgeDistance - i - 1) / (double) nd.edgeDistance ) ;
-			
-		}
-		
-		
-		
-		// zuguterletzt die heapArrays  lueschen, wenn nicht auf referenzen gearbeitet wurd
-		if(minID == -1)
-		{
-			// zuguterletzt alles hinzufuegen
-			td.bWeights.push_back(*dWeights);
-			
-			td.pVtxPosID.push_back(*pVtxPosIDs);
-
-			delete dWeights;
-
-			delete pVtxPosIDs;
-		}
+		}// for each tweakVtx
 	}
 
 }
@@ -803,28 +814,15 @@ void	softTransformationEngine::createWeightsBasedOnEdgeDistance()
 //-----------------------------------------------------------------------------------------
 {
 	// VARIABLEN
-	uint l , i;	// Fuer Iterationen
-	
-
-	
-	MPoint startPoint;	// cache fuer position des potVtx
-
-
-	MIntArray	vtxSet[2];	// 2 IntArrays, welche abwechselnd die originalVtx halten und die mit ihnen verbundenen
-	uint		cvs = 0;	// currentVtxSet - entweder 0 oder 1; 	
-	uint		ocvs = 1;	// Other VtxSet - ist immer 1 - cvs, cache
-
-	
+	uint i;	// Fuer Iterationen
 	
-	MItMeshVertex	inVertIter(nd.inMesh);	
-	MItMeshVertex	vertIter(nd.outMesh);
 
-	componentConverter	converter(nd.outMesh);				// convertiert die vtxSelection zu faces, und danach zu den ensprechenden Vtx, ohne doppelte Eintruege
+	// Die Nachbarschaft wird nur bei Topologieaenderungen neu aufgebaut - die rings wachsen mit einer 
+	// Breitensuche darueber, so dass grow und shrink nur die betroffenen rings anfassen
+	const bool	topologyChanged = adjacency.update( MFnMesh(nd.outMesh) );
 
-	BPT_BA		forbiddenVtx(vertIter.count(), true);		// Huelt die Vtx, welche bereits bearbeitet wurden und folglich nicht nochmal konvertiert werden sollen
-
-
-	// Wenn ec bereits initialisiert, dann arbeiten wir mit cache und die forbidden Vtx muessen alle TwerakVtx sein
+	MPointArray	inPoints;
+	MFnMesh(nd.inMesh).getPoints(inPoints);
 
 
 
@@ -835,8 +833,10 @@ void	softTransformationEngine::createWeightsBasedOnEdgeDistance()
 	int difference =  (int)nd.edgeDistance - (int)lastEdgeDistance;
 
 
-	if( difference == 0 )
-//	if(true)		
+	if(		difference == 0 
+		||	topologyChanged 
+		||	ec.ringCounts.length() == 0 
+		||	ec.visited.size() != adjacency.numVertices() )
 	{
 		// Da in diesem Falle die Zahl der Weights geuendert wurde oder die distance, muss 
 		// alles neu aufgerollt werden -> jetzt den Weg dafuer ebnen
@@ -846,21 +846,24 @@ void	softTransformationEngine::createWeightsBasedOnEdgeDistance()
 
 		td.clearAll();
 
-		difference = 1;
+		difference = (int)nd.edgeDistance;
 
-	}
 
+		// Die originalVtx muessen in jedem fall verboten werden
+		ec.visited.assign(adjacency.numVertices(), 0);
+
+		const uint l = vd.vtxSet.length();
+		for( i = 0; i < l; i++ )
+		{
+			if( (uint)vd.vtxSet[i] < ec.visited.size() )
+				ec.visited[ vd.vtxSet[i] ] = 1;
+		}
 
-	// Die originalVtx muessen in jedem fall verboten werden
-	forbiddenVtx.setBits(vd.vtxSet, false);
-	
-	
-	if( ec.ringCounts.length() > 0 )
-	{
-		// Wenn wir nen cache haben, dann muessen auch noch alle tweakVtx auf die forbiddenList
-		forbiddenVtx.setBits(td.vtx, false);
 	}
-	
+
+
+	// Die Zahl der weights pro TweakVtx ist fuer alle gleich
+	const uint	numParentWeights = std::min( (uint)nd.maxWeights, vd.vtxSet.length() );
 
 
 
@@ -868,52 +871,61 @@ void	softTransformationEngine::createWeightsBasedOnEdgeDistance()
 	{// Es wird gegrowed
 		
 		
-		// Der erste Durchlauf erfolgt mit den konvertierten vtx des VtxSets
-		if( ec.ringCounts.length() > 0 )
-			copyArrayPartial(vtxSet[0], td.vtx, td.vtx.length() - ec.ringCounts[ec.ringCounts.length() - 1], td.vtx.length());
-		else
-			vtxSet[0] = vd.vtxSet;
-
-	
+		// Der erste Durchlauf erfolgt mit dem vtxSet, danach ist der letzte ring die Front
+		const MIntArray*	front = &vd.vtxSet;
+		uint				frontStart = 0;
+		uint				frontEnd = vd.vtxSet.length();
 
-
-		l = vd.vtxSet.length();
-		
+		if( ec.ringCounts.length() > 0 )
+		{
+			front = &td.vtx;
+			frontStart = td.vtx.length() - ec.ringCounts[ec.ringCounts.length() - 1];
+			frontEnd = td.vtx.length();
+		}
 
 		
 		// jetzt edgeLength mal iterieren
 		for( i = lastEdgeDistance; i < static_cast<unsigned>(nd.edgeDistance); i++)
 		{
-			converter.vtxToConnectedFaceVtx(vtxSet[cvs], vtxSet[ocvs]);
-			
-			// jetzt die forbiddenVtx ausschlieueen
-			vtxSet[ocvs] = forbiddenVtx & vtxSet[ocvs];
-			
-			// jetzt die uebriggebliebenen aufs vorbiddenArray packen
-			forbiddenVtx.setBits(vtxSet[ocvs], false);
+			const uint ringStart = td.vtx.length();
+
+			// Alle noch nicht besuchten Nachbarn der Front bilden den naechsten ring
+			for( uint f = frontStart; f < frontEnd; f++ )
+			{
+				const int vtx = (*front)[f];
+
+				if( (uint)vtx >= adjacency.numVertices() )
+					continue;
+
+				for( const int* n = adjacency.begin(vtx); n != adjacency.end(vtx); ++n )
+				{
+					if( ec.visited[*n] )
+						continue;
+
+					ec.visited[*n] = 1;
+
+					td.appendTweak(*n, numParentWeights);
+				}
+			}
 			
 			// Nun die Distanzen ermitteln und die Weights, pro gefundenem Vtx 
-			
-			generateEdgeWeights(vtxSet[ocvs], i, inVertIter);
+			generateEdgeWeights(ringStart, td.vtx.length(), i, inPoints);
 
 
 			// Auueerdem noch den Cache updaten mit der Zahl an Eintruegen fuer diesen Ring
-			ec.ringCounts.append(vtxSet[ocvs].length());
-
-			
-			
-			// zuguterletzt die Arrays switchen, so dass der neue Startpunkt das letzte Ergebnis ist, 
-			// sozusagen der letzte Ring, welcher aus der Selection gegrowed wurde
-			cvs = 1 - cvs;
-			ocvs = 1 - cvs;
+			ec.ringCounts.append(td.vtx.length() - ringStart);
 
 			
+			// zuguterletzt wird der neue ring zur Front
+			front = &td.vtx;
+			frontStart = ringStart;
+			frontEnd = td.vtx.length();
 
 		}
 
 		// Weights anpassen
 		if(lastEdgeDistance != 0)
-			resampleWeights();
+			resampleWeights(inPoints);
 
 	}
 	else if(difference < 0)
@@ -929,14 +941,17 @@ void	softTransformationEngine::createWeightsBasedOnEdgeDistance()
 
 		}
 
-		
-		// jetzt die letzten eintruege lueschen aus baseWeigths und potVtxIDs
-		td.bWeights.resize(td.bWeights.size() - delIDRange);
+		const uint	newLength = td.vtx.length() - delIDRange;
 
-		td.pVtxPosID.resize(td.pVtxPosID.size() - delIDRange);
+		// Die geloeschten Vtx duerfen beim naechsten grow wieder gefunden werden
+		for( i = newLength; i < td.vtx.length(); i++ )
+		{
+			ec.visited[ td.vtx[i] ] = 0;
+		}
 
-		// Die tweakVtx selbst muessen natuerlich auch noch geluescht werden 
-		td.vtx.setLength(td.vtx.length() - delIDRange);
+		
+		// jetzt die letzten eintruege lueschen aus baseWeigths und potVtxIDs - und die tweakVtx selbst natuerlich auch
+		td.truncate(newLength);
 		
 		// Luenge anpassen
 		ec.ringCounts.setLength(ec.ringCounts.length() - (lastEdgeDistance - nd.edgeDistance) );
@@ -945,7 +960,7 @@ void	softTransformationEngine::createWeightsBasedOnEdgeDistance()
 		
 		// Noch die weights anpassen - diese methode geht korrekt damit um
 		if(nd.edgeDistance != 0)
-			resampleWeights();
+			resampleWeights(inPoints);
 
 	}
 
@@ -955,321 +970,427 @@ void	softTransformationEngine::createWeightsBasedOnEdgeDistance()
 
 
 //-----------------------------------------------------------------------------------------
-void	softTransformationEngine::createWeightsBasedOnDistance()
+void	softTransformationEngine::gatherDistanceCandidates(double radius)
 //-----------------------------------------------------------------------------------------
 {
 	
-	uint x, l, l2, i;
-	int tmp;
+	const uint l = vd.potVtx.length();
+	const uint maxWeights = (uint)nd.maxWeights;		// hoechstens so viele parents pro tweakVtx
 
-	// VARIABLEN
-	double  dTmp; 
-	MPoint startPoint;
-	
-	MItMeshVertex inVertIter(nd.inMesh);
-	
-	unsigned maxWeights;		// Speichert die tatsuechlich zahl an maxWeights zwischen . mindestens td.maxWeights, oder weniger
-	double	sumWeights;		// Tmpvar fuer Summe der Weights;
-	double	newSum;
-	MDoubleArray distScales;		// DistanceScale - je weiter weg, desto schwuecher ist das weight - pro weight
-	
+	dc.clear();
 
+	dc.radius = radius;
+	dc.maxWeights = nd.maxWeights;
+	dc.numParents = vd.vtxSet.length();
+	dc.numPotVtx = l;
 
-	//#########################################################################################################################################
-	// WEIGHTS AUSRECHNEN - MERKE: Weights hat immer numVtx eintruege - fuer die VisNode - und eventuell zum painten spueter
-	//#########################################################################################################################################
-	
-	
-	l = vd.potVtx.length();	  l2 = vd.vtxSet.length();
-	
+
+	// Alle Positionen einmalig holen - der MItMeshVertex ist zu langsam und nicht threadsafe
+	// Hier ist wichtig, dass alle Berechnungen auf dem originalMesh bzw. mit gecachten Positionen erfolgen
+	MPointArray	inPoints;
+	MFnMesh(nd.inMesh).getPoints(inPoints);
 	
+
+	// Gitter ueber die ParentVtx - mit Zellengroesse == radius muessen nur die 27 Nachbarzellen durchsucht werden
+	pointGrid	grid;
+	grid.build(vd.vtxOrigPos, radius);
 	
-	INVIS(cout<<"REBUILT TWEAK ARRAYS: MUSS "<<l * l2<<" RECHNUNGEN AUSFueueHREN"<<endl);
+	INVIS(cout<<"SAMMLE KANDIDATEN: "<<l<<" GITTER-ABFRAGEN UEBER "<<vd.vtxSet.length()<<" PARENTS"<<endl);
 	
+
+	// Die Abfragen laufen blockweise parallel, die Ergebnisse werden danach eingesammelt - 
+	// so bleibt der Speicher fuer die Zwischenergebnisse begrenzt
+	const uint	blockSize = 16384;
+	vector<pointGrid::result>	nearest( (size_t)std::min(l, blockSize) * maxWeights );
+	vector<uint>				numNearest( std::min(l, blockSize) );
+
+	vector<uint>				order;		// Index in dc.vtx, wird nach der Distanz zum naechsten parent sortiert
+	vector<uint>				offsets(1, 0);
+	vector<wp>					candidates;
+
+	const MIntArray&	potVtx = vd.potVtx;
 	
 	
-	for( i = 0; i < l; i++)
+	for( uint blockStart = 0; blockStart < l; blockStart += blockSize )
 	{
-	
-		// Hier ist wichtig, dass alle Berechnungen auf dem originalMesh bzw. mit gecachten Positionen erfolgen
-		
-		//vertIter.setIndex(vd.potVtx[i],tmp);
-		inVertIter.setIndex(vd.potVtx[i],tmp);
-		startPoint = inVertIter.position();
-		
-		map<double, int>	weights;			// Speichert die weights (als key) zusammen mit den dazugehuerigen localPosIDs
-		
-		sumWeights = 0.0;
-		
-		//distancen ausrechnen: hier eventuell noch ne adaptivitueuet einbauen: z.B nur jeden 2. vtx ind SlideIndices einbeziehen
-		for(x = 0; x < l2; x++)
-		{//nun ist die Frage, ob es schneller ist, den vertIter zu strapazieren, oder sich die Position einfach zu berechnen ... 
-			//vertIter.setIndex(vd.vtxSet[x],tmp);
-			
-			
-			
-			dTmp = (vd.vtxOrigPos[x] - startPoint).length();
-			
-			
-			// Bereits hier wird aussortiert: Wenn die Distance immernoch innerhalb der toleranz, dann in die Map packen
-			if( dTmp <= nd.distance )
-			{
-				weights.insert( wp( dTmp , x) );	// Den wert hier nicht veruendern - die kleinsten Werte sollen zuerst kommen
-			}
-			
+		const int numInBlock = (int)std::min(blockSize, l - blockStart);
+
+#ifdef _OPENMP
+		#pragma omp parallel for schedule(dynamic, 256)
+#endif
+		for( int b = 0; b < numInBlock; b++ )
+		{
+			numNearest[b] = grid.findNearest( inPoints[ potVtx[blockStart + b] ], radius, maxWeights, &nearest[(size_t)b * maxWeights] );
 		}
-		
-		
-		
-		// Es soll die grueuetMuegliche zahl an weights genommen werden
-		maxWeights = ((size_t)nd.maxWeights < weights.size() ) ? (uint)nd.maxWeights : (uint)weights.size();
-		
-		
-		if(maxWeights > 0 )
+
+
+		for( int b = 0; b < numInBlock; b++ )
 		{
-			// erstmal diesen TweakVtx hinzufuegen
-			td.vtx.append(vd.potVtx[i]);
-			
-			
-			
-			
-			
-			// jetzt die weights extrahieren die pVtxPosIDs
-			MDoubleArray dWeights(maxWeights);
-			MIntArray	pVtxPosIDs(maxWeights);
-			
-			std::map<double, int>::iterator	iter = weights.begin();
-			
-			
-			
-			sumWeights = newSum = 0.0;
-			distScales.setLength(maxWeights);
-			
-			// Zuerstmal die benuetigten MaxScaleDaten holen
-			for( x = 0; x < maxWeights; x++, iter++)
-			{
-				dWeights[x] =  nd.distance - iter->first;
-				//	dWeights[x] /= nd.distance ;//* maxWeights;	// Umkehren
-				distScales[x] = dWeights[x] / nd.distance;
-				
-				
-				// newSum += iter->first;
-				
-				//distScale += dWeights[x] / nd.distance;
-				
-				sumWeights += dWeights[x];
-				
-				pVtxPosIDs[x] = iter->second;
-				
-			}
-			
-			
-			// jetzt die weights entsprechend ihrer Nuehe zum parent modifizieren: Parents nah am TweakVtx werden so viel stuerker
-			for( x = 0; x < maxWeights; x++)
-			{
-				
-				// dWeights[x] = dWeights[x] / (sumWeights / distScales[x] );
-				dTmp = dWeights[x];
-			//	dWeights[x] =  ( sumWeights  / ( (nd.distance - dTmp ) / ( dTmp * dTmp) ) )  *  ( ( 1 / dTmp ) * nd.distance);
-				dWeights[x] =  ( sumWeights  / ( ((nd.distance - dTmp ) / (pow((float)dTmp, nd.smoothen))) / ( pow((float)dTmp, nd.smoothen) ) ) )  ;
-				newSum += dWeights[x];
-				
-			}
-			
-			// Normalisieren und mit distScale versehen
-			for( x = 0; x < maxWeights; x++)
-			{
-				dWeights[x] = (dWeights[x] / newSum) * distScales[x];
-			}
-			
-			
-			// Die erzeugten Arrays jetzt aud die Vectoren hauen
-			td.bWeights.push_back(dWeights);
-			
-			td.pVtxPosID.push_back(pVtxPosIDs);
-			
-		} // if( maxWeights > 1 ) ENDE
-		
-		
+			if( numNearest[b] == 0 )
+				continue;
+
+			const pointGrid::result* first = &nearest[(size_t)b * maxWeights];
+
+			order.push_back( (uint)dc.vtx.size() );
+			dc.vtx.push_back( potVtx[blockStart + b] );
+			dc.nearest.push_back( first->first );
+
+			candidates.insert( candidates.end(), first, first + numNearest[b] );
+			offsets.push_back( (uint)candidates.size() );
+		}
 		
 	}
-	//for(element in ptVtx) ENDE
 
 
+	// Nach der Distanz zum naechsten parent sortieren - dann sind die TweakVtx fuer jede distance <= radius der Anfang der Liste
+	const vector<double>&	nearestDist = dc.nearest;
+	std::stable_sort(order.begin(), order.end(), nearestLess(nearestDist));
+
+	const uint numEntries = (uint)order.size();
+
+	vector<int>		sortedVtx(numEntries);
+	vector<double>	sortedNearest(numEntries);
+
+	dc.candidates.reserve(candidates.size());
+	dc.offsets.reserve(numEntries + 1);
+
+	for( uint i = 0; i < numEntries; i++ )
+	{
+		const uint e = order[i];
+
+		sortedVtx[i] = dc.vtx[e];
+		sortedNearest[i] = dc.nearest[e];
+
+		dc.candidates.insert( dc.candidates.end(), candidates.begin() + offsets[e], candidates.begin() + offsets[e+1] );
+		dc.offsets.push_back( (uint)dc.candidates.size() );
+	}
+
+	dc.vtx.swap(sortedVtx);
+	dc.nearest.swap(sortedNearest);
+
 }
 
 
 //-----------------------------------------------------------------------------------------
-void	softTransformationEngine::initAnimFn()
+void	softTransformationEngine::gatherGeodesicCandidates(double radius)
 //-----------------------------------------------------------------------------------------
 {
-
-	MObjectArray objects;
-	
-	
-	MFnDependencyNode depNodeFn(thisNode);
 	
-	
-	if(MAnimUtil::findAnimation(depNodeFn.findPlug("csl"),objects))
+	dc.clear();
+
+	dc.radius = radius;
+	dc.maxWeights = nd.maxWeights;
+	dc.numParents = vd.vtxSet.length();
+	dc.numPotVtx = vd.potVtx.length();
+	dc.geodesic = true;
+
+
+	// Gesucht wird ueber die Nachbarschaft des outMeshes - dieselbe, die auch der edgeDistance Modus verwendet
+	adjacency.update( MFnMesh(nd.outMesh) );
+
+	const uint	numVtx = adjacency.numVertices();
+	if( numVtx == 0 )
+		return;
+
+
+	// Positionen: das inMesh fuer alle Vertizen, die es dort gibt, die parents an ihrer gecachten Position.
+	// Nur neu hinzugekommene Vertizen werden vom outMesh gelesen
+	MPointArray	points;
+	MFnMesh(nd.inMesh).getPoints(points);
+
+	const uint	numInPoints = points.length();
+
+	if( numInPoints < numVtx )
+	{
+		MPointArray	outPoints;
+		MFnMesh(nd.outMesh).getPoints(outPoints);
+
+		points.setLength(numVtx);
+		for( uint i = numInPoints; i < numVtx; i++ )
+			points[i] = outPoints[i];
+	}
+
+	vector<double>	positions( (size_t)numVtx * 3 );
+
+	int v;
+#ifdef _OPENMP
+	#pragma omp parallel for schedule(static)
+#endif
+	for( v = 0; v < (int)numVtx; v++ )
 	{
-		animFn.setObject(objects[0]);
+		const MPoint& p = points[v];
+		
+		positions[v*3] = p.x;	positions[v*3+1] = p.y;	positions[v*3+2] = p.z;
 	}
 
+	const uint	numParents = vd.vtxSet.length();
+	vector<int>	sources(numParents);
+
+	uint i;
+	for( i = 0; i < numParents; i++ )
+	{
+		sources[i] = vd.vtxSet[i];
+
+		if( (uint)sources[i] < numVtx && i < vd.vtxOrigPos.length() )
+		{
+			const MPoint& p = vd.vtxOrigPos[i];
+
+			positions[sources[i]*3] = p.x;	positions[sources[i]*3+1] = p.y;	positions[sources[i]*3+2] = p.z;
+		}
+	}
+
+	INVIS(cout<<"GEODESIC: "<<numVtx<<" VERTIZEN, "<<numParents<<" PARENTS"<<endl);
+
+
+	geodesic.solve(	numVtx, 
+					adjacency.offsetData(), 
+					adjacency.neighbourData(), 
+					&positions[0], 
+					&sources[0], 
+					numParents, 
+					radius, 
+					(uint)nd.maxWeights );
+
+
+	// Nur potVtx werden zu tweakVtx - die erreichten Vertizen sind bereits nach der Distanz zum naechsten parent sortiert,
+	// die Labels entsprechen den Kandidaten, der Index der Quelle dem vtxOrigPos Index
+	vector<char>	isPotVtx(numVtx, 0);
+
+	const uint l = vd.potVtx.length();
+	for( i = 0; i < l; i++ )
+	{
+		if( (uint)vd.potVtx[i] < numVtx )
+			isPotVtx[ vd.potVtx[i] ] = 1;
+	}
+
+	const uint	numReached = geodesic.numReached();
+
+	dc.vtx.reserve(numReached);
+	dc.nearest.reserve(numReached);
+	dc.offsets.reserve(numReached + 1);
+
+	for( i = 0; i < numReached; i++ )
+	{
+		const int vtx = geodesic.vertex(i);
+
+		if( !isPotVtx[vtx] )
+			continue;
+
+		dc.vtx.push_back(vtx);
+		dc.nearest.push_back( geodesic.labelsBegin(i)->first );
+
+		dc.candidates.insert( dc.candidates.end(), geodesic.labelsBegin(i), geodesic.labelsEnd(i) );
+		dc.offsets.push_back( (uint)dc.candidates.size() );
+	}
+	
 }
 
 
 //-----------------------------------------------------------------------------------------
-void	softTransformationEngine::recalculateTweakScaleFactors( )
+void	softTransformationEngine::createWeightsBasedOnDistance()
 //-----------------------------------------------------------------------------------------
 {
-	uint l = td.vtx.length(), numWeights;
-	uint i,x;
+	
+	//#########################################################################################################################################
+	// WEIGHTS AUSRECHNEN - MERKE: Weights hat immer numVtx eintruege - fuer die VisNode - und eventuell zum painten spueter
+	//#########################################################################################################################################
+	
+	
+	if( vd.potVtx.length() == 0 || nd.distance <= 0.0 || nd.maxWeights < 1 )
+		return;
 
-	if(! animFnInitialized )
+
+	// Die Kandidaten werden nur neu gesammelt, wenn die distance ueber den gecachten Radius hinauswaechst oder
+	// sich die Eingangsdaten geaendert haben. Der Radius bekommt etwas Luft, damit weiteres Vergroessern billig bleibt
+	if(		nd.distance > dc.radius
+		||	dc.maxWeights != nd.maxWeights
+		||	dc.numParents != vd.vtxSet.length()
+		||	dc.numPotVtx != vd.potVtx.length()
+		||	dc.geodesic != nd.useGeodesic )
 	{
-		// Erstmal die animFn einrichten
-		initAnimFn();
-		animFnInitialized = true;
+		if( nd.useGeodesic )
+			gatherGeodesicCandidates( nd.distance * 1.25 );
+		else
+			gatherDistanceCandidates( nd.distance * 1.25 );
 	}
-
 	
+
+	// Die TweakVtx sind der Anfang der sortierten Liste - erst die Eintraege anlegen, dann parallel fuellen
+	const int numTweaks = (int)dc.numWithin(nd.distance);
+	int t;
+
+	for( t = 0; t < numTweaks; t++ )
+	{
+		uint numWeights = 0;
+		for( uint c = dc.offsets[t]; c < dc.offsets[t+1] && dc.candidates[c].first <= nd.distance; c++ )
+			numWeights++;
+
+		td.appendTweak(dc.vtx[t], numWeights);
+	}
 	
-	INVIS(cout<<"Berechne Falloff neu, fType ist "<<nd.fType<<endl;)
-		//Scale neu ausrechnen
-		switch(nd.fType)
+	INVIS(cout<<"TWEAKVTX AUS DEM CACHE: "<<numTweaks<<" VON "<<dc.vtx.size()<<endl);
+
+
+#ifdef _OPENMP
+	#pragma omp parallel for schedule(static)
+#endif
+	for( t = 0; t < numTweaks; t++ )
+	{
+		const uint	numWeights = td.numWeights(t);
+		const wp*	iter = &dc.candidates[ dc.offsets[t] ];
+			
+		double*	dWeights = &td.bWeights[ td.offsets[t] ];
+		int*	pVtxPosIDs = &td.pVtxPosID[ td.offsets[t] ];
+		
+		double	sumWeights = 0.0, newSum = 0.0, dTmp;
+		uint	x;
+			
+		// Puffer fuer die distScales - meistens reicht der Stack
+		double	distScales[64];
+		double*	scales = ( numWeights <= 64 ) ? distScales : new double[numWeights];
+
+			
+		// Zuerstmal die benuetigten MaxScaleDaten holen - die kleinsten Distanzen kommen zuerst
+		for( x = 0; x < numWeights; x++, iter++)
 		{
-		case 0:
-			{//linear
-				td.weights = td.bWeights;
-				break;
-			}
-		case 1:
-			{
-				//smooth		
-				clearAnimCurve();
-				
-				animFn.addKey(0.0,0.0,MFnAnimCurve::kTangentSmooth,MFnAnimCurve::kTangentSmooth,NULL);
-				animFn.addKey(1.0,1.0,MFnAnimCurve::kTangentSmooth,MFnAnimCurve::kTangentSmooth,NULL);
-				
-				animFn.setAngle(0,MAngle(0.0),false);
-				animFn.setAngle(1,MAngle(0.0),true);
-				
-				
-				break;
-			}
-		case 2:
-			{
-				//Spike
-				
-				
-				clearAnimCurve();
-				
-				animFn.addKey(0.0,0.0,MFnAnimCurve::kTangentSmooth,MFnAnimCurve::kTangentSmooth,NULL);
-				animFn.addKey(1.0,1.0,MFnAnimCurve::kTangentSmooth,MFnAnimCurve::kTangentSmooth,NULL);
-				
-				animFn.setAngle(0,MAngle(0.0),false);
-				animFn.setAngle(1,MAngle(0.093349),true);
-				
-				
-				
-				break;
-			}
-		case 3:
-			{
-				//Dome
-				
-				
-				clearAnimCurve();
-				
-				animFn.addKey(0.0,0.0,MFnAnimCurve::kTangentSmooth,MFnAnimCurve::kTangentSmooth,NULL);
-				animFn.addKey(1.0,1.0,MFnAnimCurve::kTangentSmooth,MFnAnimCurve::kTangentSmooth,NULL);
-				
-				animFn.setAngle(0,MAngle(0.093349),false);
-				animFn.setAngle(1,MAngle(0.0),true);
-				
-				
-				break;
-			}
+			dWeights[x] =  nd.distance - iter->first;
+			scales[x] = dWeights[x] / nd.distance;
 			
+			sumWeights += dWeights[x];
+			
+			pVtxPosIDs[x] = iter->second;
+			
+		}
+		
+		
+		// jetzt die weights entsprechend ihrer Nuehe zum parent modifizieren: Parents nah am TweakVtx werden so viel stuerker
+		for( x = 0; x < numWeights; x++)
+		{
 			
+			dTmp = dWeights[x];
+			dWeights[x] =  ( sumWeights  / ( ((nd.distance - dTmp ) / (pow((float)dTmp, nd.smoothen))) / ( pow((float)dTmp, nd.smoothen) ) ) )  ;
+			newSum += dWeights[x];
 			
+		}
+		
+		// Normalisieren und mit distScale versehen
+		for( x = 0; x < numWeights; x++)
+		{
+			dWeights[x] = (dWeights[x] / newSum) * scales[x];
+		}
+
+		if( scales != distScales )
+			delete [] scales;
+		
 	}
+	//for(element in tweakVtx) ENDE
 
 
-	// Hier wird nur weitergemacht, wenn auch wirklich resampled werden muss
-	if(nd.fType != 0)
-	{
+}
 
-		// Wir unterscheiden der effizienz wegen 2 Modi: Bei dem einen muss das WeightsArray vuellig neu aufgebaut werden, beim anderen
-		// Kann die vorhanden eintruege extrahieren
 
-		if(		lastDistance == nd.distance
-			&&	
-				lastMaxWeights == nd.maxWeights
-			&&	
-				lastEdgeDistance == nd.edgeDistance
-			&&
-				lastSmoothen == nd.smoothen)
-		{	// Die zahl der Eintruege hat sich nicht veruendert, also auf vorhandenen Daten arbeiten
-			// Wenn er hier hinkommt, dann hat sich nur der FType veruendert
+//-----------------------------------------------------------------------------------------
+void	softTransformationEngine::updateFalloffLUT()
+//-----------------------------------------------------------------------------------------
+{
+	MRampAttribute	ramp(thisNode, falloffRampObj);
 
-			for( i = 0; i < l; i++)
-			{
-				MDoubleArray& bWeights = td.bWeights[i];
-				MDoubleArray& weights = td.weights[i];
-				
-				
-				numWeights = bWeights.length();
+	MIntArray	indices, interps;
+	MFloatArray	positions, values;
 
-				// Die beiden Arrays sollten auch noch gleich groue sein
-				
-				for( x = 0; x < numWeights; x++)
-				{
-					animFn.evaluate(bWeights[x],weights[x]);
-				}
-				
-				// Da wir auf einer Referenz gearbeiten haben, ist hier nichts mehr zu tun;
-			}
-		}
+	ramp.getEntries(indices, positions, values, interps);
+
+
+	vector<float>	lut(falloffLUTSize);
+
+	for( int i = 0; i < falloffLUTSize; i++ )
+	{
+		const float pos = (float)i / (float)(falloffLUTSize - 1);
+
+		// Eine leere ramp verhaelt sich wie linear - sonst wuerde sich gar nichts mehr bewegen
+		if( indices.length() == 0 )
+			lut[i] = pos;
 		else
-		{
-			// Weight erstmal leer machen
-			td.weights.clear();
-			
-			for( i = 0; i < l; i++)
-			{
-				MDoubleArray& bWeights = td.bWeights[i];
-				
-				
-				
-				numWeights = bWeights.length();
-				
-				MDoubleArray weights(numWeights);		// Wird dann auf weightsVector gepushed
-				
-				for( x = 0; x < numWeights; x++)
-				{
-					animFn.evaluate(bWeights[x],weights[x]);
-				}
-				
-				td.weights.push_back(weights);
-			}
-		}
+			ramp.getValueAtPosition(pos, lut[i]);
 	}
-	
 
+
+	// Nur wenn sich die ramp veraendert hat, muessen die weights neu berechnet werden
+	if( lut != falloffLUT )
+	{
+		falloffLUT.swap(lut);
+
+		lastFType = -1;
+	}
 }
 
 
-//---------------------------------------------------------
-void		softTransformationEngine::clearAnimCurve()
-//---------------------------------------------------------
+//-----------------------------------------------------------------------------------------
+void	softTransformationEngine::recalculateTweakScaleFactors( )
+//-----------------------------------------------------------------------------------------
 {
-	unsigned int count = animFn.numKeys();
+	// Die weights haben immer dasselbe Layout wie die bWeights - da alles flach liegt, muss nicht mehr 
+	// zwischen neu aufbauen und vorhandene Eintraege ueberschreiben unterschieden werden
+	const int numWeights = (int)td.bWeights.size();
+
+	td.weights.resize(numWeights);
+
+	if( numWeights == 0 )
+		return;
+
+	const double*	bWeights = &td.bWeights[0];
+	double*			weights = &td.weights[0];
+	
+	
+	INVIS(cout<<"Berechne Falloff neu, fType ist "<<nd.fType<<endl;)
 
-	for(unsigned int i = 0; i < count; i++)
+	//Scale neu ausrechnen
+	switch(nd.fType)
 	{
-		animFn.remove(0);
+	case 1:
+		{
+			//smooth - beide Tangenten flach
+			for( int x = 0; x < numWeights; x++ )
+				weights[x] = hermiteFalloff(bWeights[x], 0.0, 0.0);
+			
+			break;
+		}
+	case 2:
+		{
+			//Spike - flach am Anfang, leicht ansteigend am Ende
+			for( int x = 0; x < numWeights; x++ )
+				weights[x] = hermiteFalloff(bWeights[x], 0.0, shallowSlope);
+			
+			break;
+		}
+	case 3:
+		{
+			//Dome - leicht ansteigend am Anfang, flach am Ende
+			for( int x = 0; x < numWeights; x++ )
+				weights[x] = hermiteFalloff(bWeights[x], shallowSlope, 0.0);
+			
+			break;
+		}
+	case 4:
+		{
+			//Ramp - aus der LUT interpolieren
+			if( (int)falloffLUT.size() != falloffLUTSize )
+				updateFalloffLUT();
+
+			const float*	lut = &falloffLUT[0];
+			
+			for( int x = 0; x < numWeights; x++ )
+				weights[x] = lookupFalloff(bWeights[x], lut);
+			
+			break;
+		}
+	default:
+		{//linear
+			td.weights = td.bWeights;
+			break;
+		}
 	}
+
 }
 
 
@@ -1319,6 +1440,8 @@ void	softTransformationEngine::doTweak(MDataBlock& data)
 
 	// Wenn sich die weights veruendern, werden diese sogleich in den Datablock geschrieben
 
+	// Alle Positionen werden einmal als Array geholt, bearbeitet und am Ende in einem Rutsch zurueckgeschrieben
+
 
 	// Wenn aus irgendeinem Grund keine BaseVtx vorhanden, einfach raushier
 	if( vd.vtxSet.length() == 0)
@@ -1327,33 +1450,45 @@ void	softTransformationEngine::doTweak(MDataBlock& data)
 
 	// VARIABLEN
 	MFnMesh	fnMesh(nd.outMesh);
-	
-	MItMeshVertex vertIter(nd.outMesh);
-	MItMeshPolygon polyIter(nd.outMesh);
 
-	MItMeshVertex inVertIter(nd.inMesh);
-	MItMeshPolygon inPolyIter(nd.inMesh);
+	// Die Punkte des outMeshes aendern sich in jedem Fall - die Positionen muessen beim naechsten Zeichnen neu hochgeladen werden
+	dd.buffers.invalidatePositions();
 
-	uint  l,i,x;
-	int tmp;
+	MPointArray	inPoints;			// Positionen des inMeshes - werden nur gelesen
+	MPointArray	outPoints;			// Positionen des outMeshes - werden am Ende mit setPoints geschrieben
+
+	MFnMesh(nd.inMesh).getPoints(inPoints);
+
+	uint  l,i;
 
 
 	// Wenn die neue Distance kleiner ist als die alte wird es weniger tweakVtx geben, 
 	// so dass man erstmal alle TweakVtx zuruecksetzen muss	
-	// Oder wenn die edges hinzugeschaltet werden
+	// Oder wenn die edges hinzugeschaltet werden, oder die Art der Distanzmessung sich aendert
+	const bool	geodesicChanged = ( nd.useGeodesic != lastGeodesic ) && ( nd.edgeDistance == 0 );
+
 	if(		nd.distance < lastDistance 
 		|| 
-			( (nd.distance > 0) & (lastEdgeDistance == 0) & (nd.edgeDistance > 0)  ))
+			( (nd.distance > 0) & (lastEdgeDistance == 0) & (nd.edgeDistance > 0)  )
+		||
+			geodesicChanged )
 	{
+		fnMesh.getPoints(outPoints);
+
+		// Im distance Modus sind die TweakVtx nach der Distanz zu ihrem naechsten parent sortiert - es muessen also nur 
+		// die zurueckgesetzt werden, die aus dem neuen Radius herausfallen
+		i = 0;
+		if( nd.edgeDistance == 0 && lastEdgeDistance == 0 && !geodesicChanged )
+			i = std::min( dc.numWithin(nd.distance), td.vtx.length() );
+
 		l = td.vtx.length();
-		for( i = 0; i < l; i++)
+		for( ; i < l; i++)
 		{
-			vertIter.setIndex(td.vtx[i], tmp);
-			inVertIter.setIndex(td.vtx[i], tmp);
-			
-			vertIter.setPosition(inVertIter.position());
+			outPoints[ td.vtx[i] ] = inPoints[ td.vtx[i] ];
 		}
 		
+		// Die TweakArrays werden gleich anhand des outMeshes neu aufgebaut - also schon jetzt zurueckschreiben
+		fnMesh.setPoints(outPoints);
 	}
 
 
@@ -1376,6 +1511,8 @@ void	softTransformationEngine::doTweak(MDataBlock& data)
 			lastSmoothen != nd.smoothen
 		||
 			lastEdgeDistance != nd.edgeDistance
+		||
+			geodesicChanged
 		||
 			vd.vtxSet.length() != vd.vtxOrigPos.length() )
 	{//Die TweakArrays mueuessen neu aufgebaut werden
@@ -1395,6 +1532,7 @@ void	softTransformationEngine::doTweak(MDataBlock& data)
 			// ZUERST alle Vtx wieder auf ursprungort setzen
 
 			td.clearAll();
+			dc.clear();
 			vd.potVtx.setLength(0);
 
 			lastDistance = nd.distance;
@@ -1402,6 +1540,7 @@ void	softTransformationEngine::doTweak(MDataBlock& data)
 			lastMaxWeights = nd.maxWeights;
 			lastSmoothen = nd.smoothen;
 			lastEdgeDistance = nd.edgeDistance;
+			lastGeodesic = nd.useGeodesic;
 
 			// Damit beim nuechsten mal die neuen VtxPositionen geholt werden
 			vd.vtxOrigPos.clear();
@@ -1435,21 +1574,20 @@ void	softTransformationEngine::doTweak(MDataBlock& data)
 		
 		// Alles 0 setzen
 		//
-		wa = MDoubleArray(vertIter.count(), 0.0 );
-		uint numWeights;
+		wa = MDoubleArray(fnMesh.numVertices(), 0.0 );
+		dd.buffers.invalidateColors();
+		uint x, end;
 		double aw;	// == averageWeight
 
 		l = td.vtx.length();
 		for( i = 0; i < l; i++)
 		{
-			MDoubleArray& weights = td.weights[i];
-
-			numWeights = weights.length();
 			aw = 0.0;
 
-			for(x = 0; x < numWeights; x++)
+			end = td.offsets[i+1];
+			for(x = td.offsets[i]; x < end; x++)
 			{
-				aw += weights[x];
+				aw += td.weights[x];
 			}
 
 			wa[ td.vtx[i] ] = aw ;/// numWeights;
@@ -1465,6 +1603,7 @@ void	softTransformationEngine::doTweak(MDataBlock& data)
 		lastMaxWeights = nd.maxWeights;
 		lastSmoothen = nd.smoothen;
 		lastEdgeDistance = nd.edgeDistance;
+		lastGeodesic = nd.useGeodesic;
 
 	}
 		
@@ -1477,6 +1616,10 @@ void	softTransformationEngine::doTweak(MDataBlock& data)
 
 
 	}
+
+
+	// Ab hier wird nur noch auf den Arrays gearbeitet
+	fnMesh.getPoints(outPoints);
 	
 
 	// -------------------------
@@ -1490,26 +1633,28 @@ void	softTransformationEngine::doTweak(MDataBlock& data)
 		// Einfach mal die parentVtx anhand der Matrix transformieren
 		for( i = 0; i < l; i++)
 		{
-			vertIter.setIndex(vd.vtxSet[i], tmp);
-
-			vertIter.setPosition( ( nd.matrix * vd.vtxOrigPos[i] )  ); 
+			outPoints[ vd.vtxSet[i] ] = nd.matrix * vd.vtxOrigPos[i]; 
 		}
 
 
 		if( nd.useMatrixRotation )
 		{
 		
-			
-			
-			l = td.vtx.length();
-			for(i = 0; i < l; i++)
+			const int numTweaks = (int)td.vtx.length();
+
+#ifdef _OPENMP
+			#pragma omp parallel for schedule(static)
+#endif
+			for(int t = 0; t < numTweaks; t++)
 			{
-				vertIter.setIndex(td.vtx[i], tmp);
-				inVertIter.setIndex(td.vtx[i], tmp);
+				const int		tweakVtx = td.vtx[t];
+				const MPoint&	inPos = inPoints[tweakVtx];
 				
-				vertIter.setPosition( inVertIter.position() + ((nd.matrix * inVertIter.position()) - inVertIter.position()) * wa[td.vtx[i]] );
+				outPoints[tweakVtx] = inPos + ((nd.matrix * inPos) - inPos) * wa[tweakVtx];
 			}
 
+			fnMesh.setPoints(outPoints);
+
 			return;
 		}
 
@@ -1527,9 +1672,7 @@ void	softTransformationEngine::doTweak(MDataBlock& data)
 
 	for( i = 0; i < l; i++)
 	{
-		vertIter.setIndex(vd.vtxSet[i], tmp);
-
-		directions[i] = vertIter.position() - vd.vtxOrigPos[i];
+		directions[i] = outPoints[ vd.vtxSet[i] ] - vd.vtxOrigPos[i];
 	}
 
 
@@ -1537,8 +1680,6 @@ void	softTransformationEngine::doTweak(MDataBlock& data)
 
 
 	MVector direction;
-	int tweakVtx;
-	uint numWeights;
 
 
 
@@ -1571,12 +1712,9 @@ void	softTransformationEngine::doTweak(MDataBlock& data)
 			// jetzt die origVtx transformieren
 			for(i = 0; i < l; i++)
 			{
-				vertIter.setIndex(vd.vtxSet[i], tmp);
-				
-
 				direction = MVector::zero;
 				pDoSizeRelativePush(direction, i);
-				vertIter.setPosition(vertIter.position() + direction);
+				outPoints[ vd.vtxSet[i] ] += direction;
 			}
 		}
 		else
@@ -1586,12 +1724,9 @@ void	softTransformationEngine::doTweak(MDataBlock& data)
 			// jetzt die origVtx transformieren
 			for(i = 0; i < l; i++)
 			{
-				vertIter.setIndex(vd.vtxSet[i], tmp);
-				
-
 				direction = MVector::zero;
 				pDoStandardPush(direction, i);
-				vertIter.setPosition(vertIter.position() + direction);
+				outPoints[ vd.vtxSet[i] ] += direction;
 			}
 		}
 
@@ -1602,48 +1737,53 @@ void	softTransformationEngine::doTweak(MDataBlock& data)
 
 
 
-	l = td.vtx.length();
-
 	// -----------------------------
 	// VERSCHIEBEN
 	// -----------------------------
 
-	for( i = 0; i < l; i++)
+	// Jeder TweakVtx wird unabhaengig von den anderen berechnet und schreibt nur seinen eigenen Punkt - 
+	// das laesst sich also ohne weiteres parallelisieren
+	const int		numTweaks = (int)td.vtx.length();
+	const uint*		offsets = td.offsets.empty() ? NULL : &td.offsets[0];
+	const int*		pVtxPosIDs = td.pVtxPosID.empty() ? NULL : &td.pVtxPosID[0];
+	const double*	weights = td.weights.empty() ? NULL : &td.weights[0];
+	const MVectorArray&	cDirections = directions;
+
+#ifdef _OPENMP
+	#pragma omp parallel for schedule(static)
+#endif
+	for( int t = 0; t < numTweaks; t++ )
 	{
 		
-		tweakVtx = td.vtx[i];
-
-		inVertIter.setIndex(tweakVtx , tmp);
-		vertIter.setIndex(tweakVtx , tmp);
-
-		MDoubleArray&	weights = td.weights[i];
-		MIntArray&		pVtxPosIDs = td.pVtxPosID[i];
-		
-		
-		
-		numWeights = weights.length();
-
-		// Direction zuruecksetzen
-		direction = MVector::zero;
+		const int tweakVtx = td.vtx[t];
 
 		// MERKE: Die weights sind bereits so skaliert, dass man hier nicht mehr dividieren muss
 		// Dieser abschnitt ist wirklich NUR fuer die erzeugung und die translation der direction anhand der weights zustuendig und fuer sonst nix
 		// Jetzt fuer jedes weight die direction addieren ... 
-		for( x = 0; x < numWeights; x++)
-		{
+		double dx = 0.0, dy = 0.0, dz = 0.0;
 
-			direction += weights[x]  * directions[ pVtxPosIDs[x] ];
+		const uint end = offsets[t+1];
+		for( uint x = offsets[t]; x < end; x++ )
+		{
+			const MVector&	pDir = cDirections[ pVtxPosIDs[x] ];
+			const double	w = weights[x];
 
+			dx += w * pDir.x;
+			dy += w * pDir.y;
+			dz += w * pDir.z;
 		}
 
+		MVector tweakDirection(dx, dy, dz);
 		
-		(this->*careAboutPush)(direction , i);
+		(this->*careAboutPush)(tweakDirection , (uint)t);
 
-		// Nun die Direction dividieren, um den entgueltigen wert zu erhalten
-		vertIter.setPosition(inVertIter.position() + direction );
+		outPoints[tweakVtx] = inPoints[tweakVtx] + tweakDirection;
 		
 	}
-	
+
+
+	// Alles auf einmal zurueckschreiben
+	fnMesh.setPoints(outPoints);
 
 
 }
@@ -1777,9 +1917,6 @@ softTransformationEngine::draw(M3dView& view)
 
 
 
-	bool listNeedsUpdate = false;
-
-
 	softTransformationEngine::meshStatus mStat = getMeshStatus();
 
 	// Das mesh muss gewuehlt sein, damit man was zeuchnen darf
@@ -1787,18 +1924,11 @@ softTransformationEngine::draw(M3dView& view)
 	if( mStat == kNone )
 		return;
 
-	// Wenn sich der Anezigstatus des Meshes uendert, dann muss die DisplayList neu erstellt werden
-	// Nur um den PolygonOffset zu aktualisieren
-	// Diese procedur muss im endeffekt nur herausfinden, ob das mesh gehilited ist oder selected, weil der
-	// PolyOffset dann entsprechend angepasst werden muss
+	// Der PolygonOffset haengt davon ab, ob das mesh gehilited ist oder selected - er wird bei jedem Zeichnen gesetzt
 	//
 	if(mStat != dd.mstat)
-	{
 		lastStat = mStat;
 
-		listNeedsUpdate = true;
-	}
-
 
 	dd.mstat = mStat;
 
@@ -1839,13 +1969,8 @@ softTransformationEngine::draw(M3dView& view)
 		MFnNumericData	numDataFn(colorObj);
 		numDataFn.getData(tmpColor.x, tmpColor.y, tmpColor.z);
 
-		//wenn sich die Farben veruendert haben, dann die liste updaten - und alles neuzeichnen
-		if(tmpColor != dd.vtxColor1 )
-		{
-			dd.vtxColor1 = tmpColor;
-
-			listNeedsUpdate = true;
-		}
+		//wenn sich die Farben veruendert haben, bemerken das die buffers selbst und laden die Farben neu hoch
+		dd.vtxColor1 = tmpColor;
 
 		plug.setAttribute(vtxColorObj2);
 		plug.getValue(colorObj);
@@ -1853,13 +1978,8 @@ softTransformationEngine::draw(M3dView& view)
 
 		numDataFn.getData(tmpColor.x, tmpColor.y, tmpColor.z);
 
-		if(tmpColor != dd.vtxColor2)
-		{
-			dd.vtxColor2 = tmpColor;
-			//dd.vtxColor2 = view.colorAtIndex(9);
-			
-			listNeedsUpdate = true;
-		}
+		dd.vtxColor2 = tmpColor;
+		//dd.vtxColor2 = view.colorAtIndex(9);
 
 	}
 
@@ -1874,6 +1994,12 @@ softTransformationEngine::draw(M3dView& view)
 	}
 	
 	
+	// Nur hochladen, was sich seit dem letzten Zeichnen geaendert hat
+	//
+	if( ! dd.buffers.update(nd.outMesh, wa, dd.vtxColor1, dd.vtxColor2, glf) )
+		return;
+
+
 	// Erstmal die meshMatrix holen, damit die Points auch an der richtigen Stelle erscheinen
 	//
 
@@ -1922,72 +2048,11 @@ softTransformationEngine::draw(M3dView& view)
 	//Im PointMode werden PointsGezeigt, und wenn das Objekt selected ist (dann funzt shaded nicht mehr)
 	if( style == M3dView::kPoints || (mStat == kSelected ) || !allowBeautyMode)
 	{
-
-		//VertiIter initialisieren
-		MItMeshVertex vertIter(nd.outMesh);
-		
-		drawPoints(vertIter, fPointSize, glf);
-		
-
+		drawPoints(fPointSize, glf);
 	}
 	else
 	{//in diesem Modus werden Faces gezeichnet, mit entsprechenden alphawerten als zeichen ihrer Farbe
-		
-		MItMeshPolygon polyIter(nd.outMesh);
-		MItMeshVertex	vertIter(nd.outMesh);
-		
-
-
-		//Die displayList pruefen
-		if( listNeedsUpdate )//|| lastDMode != style )
-		{	//neue Liste erzeugen - wird eigentlich nur gemacht, wenn sich was veruendert hat
-			//
-			
-		//	lastDMode = style;
-
-			if( dd.list != 450000 ) 
-				//alte liste lueschen
-				glf->glDeleteLists(dd.list, 1);
-			
-			dd.list = glf->glGenLists(1);
-
-			//if(glIsList(dd.list))
-			if( dd.list != 0 )
-			{
-				listNeedsUpdate = false;
-
-
-				//#######################
-				//NEUE LISTE AUFZEICHNEN
-				//#######################
-				glf->glNewList(dd.list, GL_COMPILE_AND_EXECUTE);
-
-		
-				//drawShaded(polyIter, vertIter, style, mStat);
-				drawShadedTriangles(polyIter, vertIter, style, mStat, glf);
-
-
-				//#######################
-				//ENDE LISTE AUFZEICHNEN
-				//#######################
-
-				glf->glEndList();
-
-			}
-			else
-			{
-				//fehler, also alles ohne displayList zeichnen
-				//drawShaded(polyIter, vertIter, style, mStat);
-				drawShadedTriangles(polyIter, vertIter, style, mStat, glf);
-			}
-
-		}
-		else 
-		{
-			glf->glCallList(dd.list);
-
-		}
-
+		drawShadedTriangles(style, mStat, glf);
 	}
 
 	glf->glPopMatrix();
@@ -2001,7 +2066,7 @@ softTransformationEngine::draw(M3dView& view)
 
 //-----------------------------------------------------------------------------------
 void	
-softTransformationEngine::drawPoints( MItMeshVertex& vertIter, float fPointSize, MGLFunctionTable* glf)
+softTransformationEngine::drawPoints( float fPointSize, MGLFunctionTable* glf)
 //-----------------------------------------------------------------------------------
 {
 
@@ -2016,36 +2081,8 @@ softTransformationEngine::drawPoints( MItMeshVertex& vertIter, float fPointSize,
 			glf->glHint(GL_POINT_SMOOTH_HINT, GL_NICEST);
 			
 
-
-			Float3 tmpColor;
-			double dTmp;		// huelt das weight, cache
-
-			//weights verwenden um Farbe zu skalieren
-			uint numCVs = vertIter.count();
-			for (uint i = 0; i < numCVs; i++, vertIter.next()) 
-			{
-
-				dTmp = wa[i];
-
-				glf->glPointSize( static_cast<MGLfloat>((fPointSize * dTmp) + 3.0) );
-
-				glf->glBegin( GL_POINTS );	
-
-			//	glPointSize( fPointSize );
-				MPoint		point( vertIter.position() );
-				
-				
-			
-				
-	
-
-				tmpColor = getCalColor(dd.vtxColor1, dd.vtxColor2, dTmp );
-				glf->glColor4f(tmpColor.x,tmpColor.y,tmpColor.z, static_cast<MGLfloat>(dTmp) );
-				glf->glVertex3f( (float)point.x, (float)point.y, (float)point.z);
-
-				glf->glEnd();
-			} 
-			
+			//weights bestimmen Farbe, Alpha und Groesse - das steckt bereits in den buffers
+			dd.buffers.drawPoints(fPointSize, glf);
 			
 			
 			glf->glPopAttrib();
@@ -2056,9 +2093,7 @@ softTransformationEngine::drawPoints( MItMeshVertex& vertIter, float fPointSize,
 
 //-------------------------------------------------------------------
 void	
-softTransformationEngine::drawShadedTriangles(	MItMeshPolygon& polyIter, 
-												MItMeshVertex& vertIter, 
-												M3dView::DisplayStyle style, 
+softTransformationEngine::drawShadedTriangles(	M3dView::DisplayStyle style, 
 												meshStatus meshStat,
 												MGLFunctionTable* glf)
 //-------------------------------------------------------------------
@@ -2079,7 +2114,7 @@ softTransformationEngine::drawShadedTriangles(	MItMeshPolygon& polyIter,
 				
 				
 				
-				//Dass muss ausueerhalb der displayList bleiben, weil dieser Wert nicht precompiliert werden darf
+				//Der Offset haengt vom MeshStatus ab und wird deshalb bei jedem Zeichnen gesetzt
 				float param1 = 0.45f, param2 = 0.55f;
 
 				// im DebugMode werden die Params anhand der NodeParameter gesetzt
@@ -2114,51 +2149,8 @@ softTransformationEngine::drawShadedTriangles(	MItMeshPolygon& polyIter,
 
 				glf->glPolygonOffset( param1, param2 );
 				
-				//jedes Poly zeichnen
-				
-				uint numPolys = polyIter.count();
-				uint i, x , l;
-				MPoint	point;
-				Float3 tmpCol;
-				MPointArray triPoints;
-				MIntArray	triVtx;
-				//glColor4f(0.0f, 0.0f, 1.0f, 0.2);
-				
-				for(i = 0; i < numPolys; i++, polyIter.next())
-				{
-					
-
-					polyIter.getTriangles(triPoints, triVtx);
-					
-					
-					l = triVtx.length();
-					
-					
-					glf->glBegin(GL_TRIANGLES);
-					
-					for(x = 0; x < l ; x+=3)
-					{
-						//view.setDrawColor( vtxColor *  vtxWeightArray[ polyVtx[x] ]);
-						//glColor4f(0.0f, 0.0f, 1.0f, vtxWeightArray[ polyVtx[x] ]);
-						
-						tmpCol = getCalColor(dd.vtxColor1, dd.vtxColor2 ,  wa[ triVtx[x] ]);
-						glf->glColor4f(tmpCol.x, tmpCol.y,tmpCol.z, static_cast<MGLfloat>(wa[ triVtx[x] ]));
-						glf->glVertex3d(triPoints[x].x, triPoints[x].y, triPoints[x].z);
-						
-			
-						tmpCol = getCalColor(dd.vtxColor1, dd.vtxColor2 ,  wa[ triVtx[x+1] ]);
-						glf->glColor4f(tmpCol.x, tmpCol.y,tmpCol.z, static_cast<MGLfloat>(wa[ triVtx[x+1] ]));
-						glf->glVertex3d(triPoints[x+1].x, triPoints[x+1].y, triPoints[x+1].z);
-
-						tmpCol = getCalColor(dd.vtxColor1, dd.vtxColor2 ,  wa[ triVtx[x+2] ]);
-						glf->glColor4f(tmpCol.x, tmpCol.y,tmpCol.z, static_cast<MGLfloat>(wa[ triVtx[x+2] ]));
-						glf->glVertex3d(triPoints[x+2].x, triPoints[x+2].y, triPoints[x+2].z);
-
-					}
-					
-					glf->glEnd();
-					
-				}
+				//alle Dreiecke in einem Rutsch zeichnen
+				dd.buffers.drawTriangles(nd.outMesh, glf);
 				
 				
 			//	glDisable(GL_POLYGON_OFFSET_FILL);
@@ -54,6 +54,7 @@
 // OTHER FUNCTIONSETS
 #include <maya/MFnSingleIndexedComponent.h>
 #include <maya/MFnAnimCurve.h>
+#include <maya/MRampAttribute.h>
 #include <maya/MAnimUtil.h>
 
 
@@ -86,12 +87,16 @@
 #include <polyModifierNode.h>
 #include <math.h>
 #include <componentConverter.h>
+#include <vertexAdjacency.h>
+#include <geodesicSolver.h>
+#include <weightDisplayBuffers.h>
 #include <GLDrawNode.h>
 #include "baselib/math_util.h"
 
 // STL
 
 #include <map>
+#include <algorithm>
 #include <vector>
 
 
@@ -208,14 +213,11 @@ namespace BPT
 
 		bool		nodeStatusAllowsDrawing();		//!< Analysiert den status der BPTNode und entscheidet, ob gezeichnet werden darf
 
-		void		drawShadedTriangles(		MItMeshPolygon& polyIter, 
-												MItMeshVertex& vertIter, 
-												M3dView::DisplayStyle style, 
+		void		drawShadedTriangles(		M3dView::DisplayStyle style, 
 												meshStatus meshStat, 
 												MGLFunctionTable* glf);
 
-		void		drawPoints( MItMeshVertex& vertIter, 
-								float fPointSize,
+		void		drawPoints( float fPointSize,
 								MGLFunctionTable* glf);
 
 
@@ -234,28 +236,25 @@ namespace BPT
 		
 		void	recalculateTweakScaleFactors( );		//!< Resampled die linearen Weights
 
-		void	clearAnimCurve();
-
-		void	initAnimFn();							//!< richtet das animFn functionSet ein
+		void	updateFalloffLUT();						//!< Tastet die falloffRamp ab - forciert ein resampling, wenn sie sich geaendert hat
 
 		void	createWeightsBasedOnDistance();			//!< Erzeugt die Weights unter Verwendung der Distance
 
+		void	gatherDistanceCandidates(double radius);	//!< Sammelt die naechsten parents aller potVtx innerhalb von radius im distanceCache
+
+		void	gatherGeodesicCandidates(double radius);	//!< Wie oben, nur wird die distance entlang der Oberflaeche gemessen
+
 		void	createWeightsBasedOnEdgeDistance();		//!< Weights auf Basis der edgeLength;
 
 		void	generateNormalVectors();				//!< holt die normalVektoren der TweakVtx
 
-		void	generateEdgeWeights(const MIntArray& vtxSet, 
+		void	generateEdgeWeights(uint firstTweak, 
+									uint endTweak, 
 									uint ringNumber, 
-									MItMeshVertex& inVertIter,
-									int minID = -1);	//!< berechnet und setzt die weights fuer einen growRing
+									const MPointArray& inPoints);	//!< berechnet und setzt die weights der tweakVtx [firstTweak, endTweak) eines growRings
 
 		// EdgeLength
-		void	copyArrayPartial(	MIntArray& copyTo, 
-									const MIntArray& copyFrom, 
-									uint inclMinID, 
-									uint exclMaxID);
-
-		void	resampleWeights();						//!< passt die bereits vorhandenen Weights an die neue edgeLength an	
+		void	resampleWeights(const MPointArray& inPoints);					//!< passt die bereits vorhandenen Weights an die neue edgeLength an	
 
 
 		// TWEAK VTX PUSH FUNKTIONEN
@@ -312,19 +311,45 @@ namespace BPT
 		//* Hlt die TweakDaten
 		struct	tweakData
 		{
+			// Die Weights und ParentIDs aller TweakVtx liegen hintereinander in flachen Arrays - die Eintraege von tweakVtx i
+			// befinden sich im Bereich [ offsets[i], offsets[i+1] ). So gibt es keine Allokation pro TweakVtx
+
 			MIntArray vtx;					//!< TweakVtx - Alle VertexIDs, die durch die softSelection transformiert werden sollen
 
-			vector<MIntArray> pVtxPosID;	//!< Index in das vtxOrigPos Array, um die originalPosition zu erhalten
+			vector<uint> offsets;			//!< Startindex der Eintraege pro TweakVtx, hat immer vtx.length() + 1 Eintraege
+
+			vector<int> pVtxPosID;			//!< Index in das vtxOrigPos Array, um die originalPosition zu erhalten
 		
-			vector<MDoubleArray> weights;	//!< Array mit den Weights, per Vtx, die die Strke der Transformation bestimmen - sie sind bereits resampled
+			vector<double> weights;			//!< Weights, die die Staerke der Transformation bestimmen - sie sind bereits resampled
 
-			vector<MDoubleArray> bWeights;	//!< BasicWeigths - lineare Wichtungen anhand der distanz zum ParentVtx
+			vector<double> bWeights;		//!< BasicWeigths - lineare Wichtungen anhand der distanz zum ParentVtx
 
 			MVectorArray normals;				
 
 			MVectorArray pNormals;			//!< ParentNormals, aufbau/kodierung wie die normals
 
+			tweakData() : offsets(1, 0) {}
+
+			//! Zahl der Weights des TweakVtx i
+			uint	numWeights(uint i) const { return offsets[i+1] - offsets[i]; }
+
+			//! Haengt einen TweakVtx mit numWeights Eintraegen an - gibt den Offset der (uninitialisierten) Eintraege zurueck
+			uint	appendTweak(int vtxID, uint numWeights) {	uint ofs = offsets.back();
+																vtx.append(vtxID);
+																offsets.push_back(ofs + numWeights);
+																pVtxPosID.resize(ofs + numWeights);
+																bWeights.resize(ofs + numWeights);
+																return ofs; }
+
+			//! Entfernt alle TweakVtx ab numTweaks
+			void	truncate(uint numTweaks) {	offsets.resize(numTweaks + 1);
+												pVtxPosID.resize(offsets.back());
+												bWeights.resize(offsets.back());
+												weights.resize(offsets.back());
+												vtx.setLength(numTweaks); }
+
 			void	clearAll() {	vtx.setLength(0); 
+									offsets.assign(1, 0);
 									pVtxPosID.clear(); 
 									weights.clear();
 									bWeights.clear();
@@ -354,6 +379,8 @@ namespace BPT
 
 			bool	useEdgeDist;	//!< edgeDistance oder radius verwenden ?
 
+			bool	useGeodesic;	//!< distance entlang der Oberflaeche statt im Raum messen ?
+
 			bool	useMatrixRotation;	//!< Wenn an, dann wird die matrix verwendet, um die tweakVtx zu transformieren
 
 			MObject	outMesh;		//!< das gegenwrtige Mesh - outMesh
@@ -376,7 +403,7 @@ namespace BPT
 
 			meshStatus	mstat;		//!< Status des Meshes
 
-			GLuint	list;			//!< Speicher fuer die display List
+			weightDisplayBuffers	buffers;	//!< Positionen, Farben und Dreiecke auf der Grafikkarte - ersetzt die displayList
 
 		} dd;
 
@@ -388,15 +415,49 @@ namespace BPT
 			// VARIABLEN		
 			MIntArray	ringCounts;							//!< Hlt die Zahl an Vertizen pro ring - um einen Zugriff zu ermglichen
 
+			vector<char>	visited;						//!< Pro Vertex des outMeshes: true, wenn er bereits in einem ring oder im vtxSet ist
+
 
 		} ec;
 
 
+		//!< Cache fuer den distance Modus: die parentKandidaten aller potVtx innerhalb eines Radius, der groesser als die gegenwaertige
+		//!< distance ist. Solange die distance nicht ueber diesen Radius waechst, muessen keine Nachbarn mehr gesucht werden
+		struct	distanceCache
+		{
+			double			radius;		//!< Radius, mit dem gesammelt wurde, < 0 wenn ungueltig
+
+			long			maxWeights;	//!< Gueltigkeitsschluessel - bei Aenderung muss neu gesammelt werden
+			uint			numParents;
+			uint			numPotVtx;
+			bool			geodesic;
+
+			vector<int>		vtx;		//!< potVtx mit mindestens einem Kandidaten, aufsteigend sortiert nach der Distanz zum naechsten parent
+			vector<double>	nearest;	//!< Distanz zum naechsten parent, pro Eintrag in vtx
+			vector<uint>	offsets;	//!< Startindex der Kandidaten pro Eintrag, wie bei tweakData
+			vector<wp>		candidates;	//!< Distanz und vtxOrigPos Index, pro Eintrag aufsteigend sortiert
+
+			distanceCache() { clear(); }
+
+			//! Zahl der Eintraege, deren naechster parent innerhalb von distance liegt - sie bilden immer den Anfang von vtx
+			uint	numWithin(double distance) const { return (uint)(std::upper_bound(nearest.begin(), nearest.end(), distance) - nearest.begin()); }
+
+			void	clear() {	radius = -1.0;
+								geodesic = false;
+								vtx.clear();
+								nearest.clear();
+								offsets.assign(1, 0);
+								candidates.clear(); }
+
+		} dc;
+
+
 		//Weitere Variablen:
 		//
 		BPT_Helpers		helper;
-		MFnAnimCurve	animFn;
-		bool			animFnInitialized;
+		vertexAdjacency	adjacency;			//!< Nachbarschaft des outMeshes fuer den edgeDistance und geodesic Modus - nur bei Topologieaenderung neu aufgebaut
+		geodesicSolver	geodesic;			//!< Haelt seinen Arbeitsspeicher zwischen den computes
+		vector<float>	falloffLUT;			//!< Abgetastete falloffRamp, wird nur bei falloffType ramp verwendet
 	
 
 		bool			isMatrixMode;		//!< Ist true, wenn eine TransformationMatrix vorhanden ist, und diese zur transformation verwendet werden soll
@@ -408,6 +469,7 @@ namespace BPT
 		long	lastMaxWeights;
 		float	lastSmoothen;
 		int		lastEdgeDistance;
+		bool	lastGeodesic;
 
 
 		double	maxScale;
@@ -443,6 +505,8 @@ namespace BPT
 
 		MObject	edgeDistanceObj;
 
+		MObject	geodesicObj;
+
 		MObject useMatrixRotationObj;
 
 		MObject	pushObj;
@@ -457,6 +521,8 @@ namespace BPT
 
 		MObject	vtxColorObj2;
 
+		MObject	falloffRampObj;
+
 		// HANDLE ZU THISMOBJECT
 		MObject	thisNode;
 
@@ -0,0 +1,349 @@
+/*
+ * Copyright (C) 2002 Sebastian Thiel
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ */
+
+#include "topologyCache.h"
+
+#include <maya/MFnMesh.h>
+#include <maya/MFnMeshData.h>
+#include <maya/MItMeshVertex.h>
+#include <maya/MFloatArray.h>
+#include <maya/MStringArray.h>
+
+
+using namespace BPT;
+
+
+//! wie weit die Suche nach urspruenglichen Vertizen um einen neuen Vertex geht
+static const int	maxRings = 3;
+
+
+//! haengt Laenge und Inhalt des Arrays an den Hash an
+static void		addArray(contentHash& hash, const MIntArray& array)
+{
+	const unsigned l = array.length();
+	hash.add(l);
+
+	for( unsigned i = 0; i < l; i++ )
+		hash.add(array[i]);
+}
+
+
+//! haengt Laenge und Werte der floats an - bitweise, denn jede Aenderung der UVs soll den Schluessel aendern
+static void		addArray(contentHash& hash, const MFloatArray& array)
+{
+	const unsigned l = array.length();
+	hash.add(l);
+
+	float value;
+	for( unsigned i = 0; i < l; i++ )
+	{
+		value = array[i];
+		hash.add(&value, sizeof(value));
+	}
+}
+
+
+//! haengt alle UVSets an - die fty uebernimmt sie ins Ergebnis, eine Aenderung davor muss also neu berechnet werden
+static void		addUVSets(contentHash& hash, const MFnMesh& meshFn)
+{
+	MStringArray	setNames;
+	meshFn.getUVSetNames(setNames);
+
+	hash.add(setNames.length());
+
+	MIntArray	uvCounts, uvIds;
+	MFloatArray	us, vs;
+
+	for( unsigned s = 0; s < setNames.length(); s++ )
+	{
+		hash.add( setNames[s].asChar(), setNames[s].length() );
+
+		meshFn.getAssignedUVs(uvCounts, uvIds, &setNames[s]);
+		addArray(hash, uvCounts);
+		addArray(hash, uvIds);
+
+		meshFn.getUVs(us, vs, &setNames[s]);
+		addArray(hash, us);
+		addArray(hash, vs);
+	}
+}
+
+
+//! haengt die harten Edges an - auch sie werden ins Ergebnis uebernommen
+static void		addHardEdges(contentHash& hash, const MFnMesh& meshFn)
+{
+	const int numEdges = meshFn.numEdges();
+	hash.add(numEdges);
+
+	for( int i = 0; i < numEdges; i++ )
+	{
+		if( !meshFn.isEdgeSmooth(i) )
+			hash.add(i);
+	}
+}
+
+
+//-----------------------------------------------------------------------------------------
+contentHash		topologyCache::createKey(	const MObject&		inMesh,
+											const MIntArray&	vertIDs,
+											const MIntArray&	edgeIDs,
+											const MIntArray&	faceIDs,
+											const MIntArray&	options,
+											int					mode )
+//-----------------------------------------------------------------------------------------
+{
+	contentHash key;
+
+	MFnMesh	meshFn(inMesh);
+
+	MIntArray counts, faceVertices;
+	meshFn.getVertices(counts, faceVertices);
+
+	key.add(meshFn.numVertices());
+	addArray(key, counts);
+	addArray(key, faceVertices);
+
+	addUVSets(key, meshFn);
+	addHardEdges(key, meshFn);
+
+	addArray(key, vertIDs);
+	addArray(key, edgeIDs);
+	addArray(key, faceIDs);
+	addArray(key, options);
+
+	key.add(mode);
+
+	return key;
+}
+
+
+//-----------------------------------------------------------------------------------------
+MStatus		topologyCache::store(const contentHash& key, const MObject& inMesh, const MObject& outMesh)
+//-----------------------------------------------------------------------------------------
+{
+	clear();
+
+	MStatus status;
+
+	MFnMesh	inFn(inMesh);
+	inFn.getPoints(inputPoints);
+	numInputVertices = inputPoints.length();
+
+	MFnMesh	outFn(outMesh);
+	if( (unsigned)outFn.numVertices() < numInputVertices )
+		return MS::kFailure;
+
+
+	//Kopie, da der Slide das Ergebnis spaeter direkt veraendert
+	MFnMeshData	dataFn;
+	resultData = dataFn.create(&status);
+	if( !status )
+		return status;
+
+	outFn.copy(outMesh, resultData, &status);
+	if( !status )
+	{
+		resultData = MObject::kNullObj;
+		return status;
+	}
+
+
+	MPointArray	outPoints;
+	outFn.getPoints(outPoints);
+
+	buildWeights(outMesh, outPoints);
+
+	//bei store ist die Verschiebung ueberall 0
+	appliedOffsets.setLength(outPoints.length());
+	for( unsigned i = 0; i < outPoints.length(); i++ )
+		appliedOffsets[i] = MVector::zero;
+
+	cachedKey = key;
+	isValid = true;
+
+	return status;
+}
+
+
+//-----------------------------------------------------------------------------------------
+void		topologyCache::buildWeights(const MObject& outMesh, const MPointArray& outPoints)
+//-----------------------------------------------------------------------------------------
+{
+	const unsigned numOutVertices = outPoints.length();
+
+	weightOffsets.setLength(numOutVertices - numInputVertices + 1);
+
+	MItMeshVertex	vertIter(outMesh);
+	MIntArray		ring, nextRing, connected, seen, anchors;
+	int				tmp;
+
+	unsigned v, i, x;
+	int r;
+
+	for( v = numInputVertices; v < numOutVertices; v++ )
+	{
+		weightOffsets[v - numInputVertices] = weightVertices.length();
+
+		ring.setLength(1);
+		ring[0] = v;
+
+		seen.setLength(1);
+		seen[0] = v;
+
+		anchors.clear();
+
+		//ringweise nach aussen, bis mindestens ein urspruenglicher Vertex gefunden ist
+		for( r = 0; r < maxRings && anchors.length() == 0 && ring.length() > 0; r++ )
+		{
+			nextRing.clear();
+
+			for( i = 0; i < ring.length(); i++ )
+			{
+				vertIter.setIndex(ring[i], tmp);
+				vertIter.getConnectedVertices(connected);
+
+				for( x = 0; x < connected.length(); x++ )
+				{
+					const int c = connected[x];
+
+					//die Ringe sind klein - linear suchen ist hier schneller als jede Hash Tabelle
+					unsigned s;
+					for( s = 0; s < seen.length() && seen[s] != c; s++ );
+
+					if( s < seen.length() )
+						continue;
+
+					seen.append(c);
+
+					if( (unsigned)c < numInputVertices )
+						anchors.append(c);
+					else
+						nextRing.append(c);
+				}
+			}
+
+			ring = nextRing;
+		}
+
+
+		//inverse Abstaende im Ergebnis - liegt der Vertex auf einer Edge, ergibt das genau seinen Parameter darauf
+		const unsigned first = weights.length();
+		double sum = 0.0;
+
+		for( i = 0; i < anchors.length(); i++ )
+		{
+			double distance = outPoints[v].distanceTo( outPoints[ anchors[i] ] );
+			if( distance < 1e-10 )
+				distance = 1e-10;
+
+			weightVertices.append(anchors[i]);
+			weights.append(1.0 / distance);
+
+			sum += 1.0 / distance;
+		}
+
+		for( i = first; i < weights.length(); i++ )
+			weights[i] /= sum;
+	}
+
+	weightOffsets[numOutVertices - numInputVertices] = weightVertices.length();
+}
+
+
+//-----------------------------------------------------------------------------------------
+MStatus		topologyCache::apply(const MObject& inMesh, MObject& outMesh, MVectorArray& changes)
+//-----------------------------------------------------------------------------------------
+{
+	if( !isValid )
+		return MS::kFailure;
+
+	MStatus status;
+
+	MPointArray	inPoints;
+	MFnMesh(inMesh).getPoints(inPoints);
+
+	if( inPoints.length() != numInputVertices )
+		return MS::kFailure;
+
+
+	MFnMeshData	dataFn;
+	outMesh = dataFn.create(&status);
+	if( !status )
+		return status;
+
+	MFnMesh	outFn;
+	outFn.copy(resultData, outMesh, &status);
+	if( !status )
+		return status;
+
+	outFn.setObject(outMesh);
+
+
+	MPointArray	points;
+	outFn.getPoints(points);
+
+	const unsigned numOutVertices = points.length();
+
+	MVectorArray offsets(numOutVertices);
+
+	unsigned i;
+	for( i = 0; i < numInputVertices; i++ )
+		offsets[i] = inPoints[i] - inputPoints[i];
+
+	for( i = numInputVertices; i < numOutVertices; i++ )
+	{
+		const int start = weightOffsets[i - numInputVertices];
+		const int end = weightOffsets[i - numInputVertices + 1];
+
+		MVector offset = MVector::zero;
+		for( int w = start; w < end; w++ )
+			offset += offsets[ weightVertices[w] ] * weights[w];
+
+		offsets[i] = offset;
+	}
+
+
+	changes.setLength(numOutVertices);
+
+	for( i = 0; i < numOutVertices; i++ )
+	{
+		points[i] += offsets[i];
+		changes[i] = offsets[i] - appliedOffsets[i];
+	}
+
+	appliedOffsets = offsets;
+
+	return outFn.setPoints(points);
+}
+
+
+//-----------------------------------------------------------------------------------------
+void		topologyCache::clear()
+//-----------------------------------------------------------------------------------------
+{
+	resultData = MObject::kNullObj;
+
+	inputPoints.clear();
+	weightOffsets.clear();
+	weightVertices.clear();
+	weights.clear();
+	appliedOffsets.clear();
+
+	numInputVertices = 0;
+	isValid = false;
+}
@@ -0,0 +1,102 @@
+/*
+ * Copyright (C) 2002 Sebastian Thiel
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ */
+
+#ifndef TOPOLOGY_CACHE_INCLUDE
+#define TOPOLOGY_CACHE_INCLUDE
+
+#include "componentAlgorithms.h"
+
+#include <maya/MObject.h>
+#include <maya/MIntArray.h>
+#include <maya/MDoubleArray.h>
+#include <maya/MPointArray.h>
+#include <maya/MVectorArray.h>
+#include <maya/MStatus.h>
+
+
+namespace BPT
+{
+
+/** Haelt das topologische Ergebnis einer kompletten Berechnung, damit eine Node es wiederverwenden kann, solange sich
+	am inMesh nur die Punkte aendern - zum Beispiel unter einem Deformer oder einer Animation.
+
+	Gespeichert werden eine Kopie des Ergebnisses (vor dem Slide), die Punkte des inMesh und pro neuem Vertex die
+	Gewichte der Eingangsvertizen, aus denen seine Verschiebung interpoliert wird. Das sind die naechsten
+	urspruenglichen Vertizen im Ergebnis, gewichtet nach ihrem inversen Abstand - fuer einen Vertex auf einer Edge ist
+	das genau die lineare Interpolation zwischen ihren Enden, fuer einen Face Mittelpunkt der Durchschnitt der Ecken.
+	Urspruengliche Vertizen behalten ihre ID und werden einfach um ihre eigene Verschiebung bewegt.
+
+	Das setzt voraus, dass die Operation die Vertizen des inMesh mit unveraenderter ID ins Ergebnis uebernimmt und neue
+	Vertizen nur anhaengt - entfernt sie welche, schlaegt store fehl. Alles andere, was die fty aus dem inMesh ins
+	Ergebnis kopiert (UVSets, harte Edges), steckt im Schluessel, so dass eine Aenderung daran neu berechnet wird.
+*/
+
+class topologyCache
+{
+public:
+
+	topologyCache() : numInputVertices(0), isValid(false) {}
+
+	//! Schluessel aus der Topologie, den UVSets und harten Edges des inMesh, der Auswahl, den Optionen und dem Modus -
+	//! aber nicht den Punkten
+	static contentHash	createKey(	const MObject&		inMesh,
+									const MIntArray&	vertIDs,
+									const MIntArray&	edgeIDs,
+									const MIntArray&	faceIDs,
+									const MIntArray&	options,
+									int					mode );
+
+	bool		matches(const contentHash& key) const { return isValid && key == cachedKey; }
+
+	/** Merkt sich das Ergebnis einer kompletten Berechnung von inMesh.
+		Schlaegt fehl, wenn die Operation Vertizen entfernt hat - dann passen die IDs nicht mehr zum inMesh
+	*/
+	MStatus		store(const contentHash& key, const MObject& inMesh, const MObject& outMesh);
+
+	/** Erzeugt das Ergebnis fuer ein inMesh mit derselben Topologie, aber anderen Punkten, in einem neuen
+		MFnMeshData Block. changes erhaelt pro Ausgangsvertex die Verschiebung seit dem letzten apply - damit muessen die
+		SlideArrays der fty nachgezogen werden
+	*/
+	MStatus		apply(const MObject& inMesh, MObject& outMesh, MVectorArray& changes);
+
+	void		clear();
+
+private:
+
+	void		buildWeights(const MObject& outMesh, const MPointArray& outPoints);
+
+private:
+
+	contentHash		cachedKey;
+
+	MObject			resultData;			//!< Kopie des Ergebnisses ohne Slide
+	MPointArray		inputPoints;		//!< Punkte des inMesh bei store
+
+	MIntArray		weightOffsets;		//!< pro neuem Vertex der Beginn seiner Gewichte, plus ein Eintrag fuer das Ende
+	MIntArray		weightVertices;		//!< die Eingangsvertizen
+	MDoubleArray	weights;			//!< und ihre Gewichte, pro neuem Vertex normalisiert
+
+	MVectorArray	appliedOffsets;		//!< Verschiebung pro Ausgangsvertex beim letzten apply
+
+	unsigned		numInputVertices;
+	bool			isValid;
+};
+
+}
+
+#endif
@@ -0,0 +1,134 @@
+/*
+ * Copyright (C) 2002 Sebastian Thiel
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ */
+
+#include "vertexAdjacency.h"
+
+#include <maya/MIntArray.h>
+
+
+//-----------------------------------------------------------------------------------------
+vertexAdjacency::vertexAdjacency()
+: offsets(1, 0)
+, valid(false)
+//-----------------------------------------------------------------------------------------
+{
+}
+
+
+//-----------------------------------------------------------------------------------------
+void	vertexAdjacency::clear()
+//-----------------------------------------------------------------------------------------
+{
+	offsets.assign(1, 0);
+	neighbours.clear();
+
+	topologyKey = contentHash();
+	valid = false;
+}
+
+
+//-----------------------------------------------------------------------------------------
+bool	vertexAdjacency::update(const MFnMesh& meshFn)
+//-----------------------------------------------------------------------------------------
+{
+	const int	numVtx = meshFn.numVertices();
+	const int	numPolys = meshFn.numPolygons();
+	const int	numFaceVtx = meshFn.numFaceVertices();
+
+	MIntArray	counts, ids;
+	meshFn.getVertices(counts, ids);
+
+	// Die Arrays muessen ohnehin geholt werden - der Hash darueber kostet nur einen Durchlauf, der Neuaufbau deutlich mehr
+	contentHash	key;
+	key.add(numVtx);
+	key.add(numPolys);
+
+	int v, f, i;
+
+	for( f = 0; f < numPolys; f++ )
+		key.add(counts[f]);
+
+	for( i = 0; i < numFaceVtx; i++ )
+		key.add(ids[i]);
+
+	if( valid && key == topologyKey )
+		return false;
+
+
+	// Startindex jedes Faces in ids
+	std::vector<uint>	faceStart(numPolys + 1, 0);
+	for( f = 0; f < numPolys; f++ )
+		faceStart[f+1] = faceStart[f] + counts[f];
+
+
+	// Vtx -> Faces, ebenfalls kompakt: erst zaehlen, dann fuellen
+	std::vector<uint>	vtxFaceOfs(numVtx + 1, 0);
+	for( i = 0; i < numFaceVtx; i++ )
+		vtxFaceOfs[ ids[i] + 1 ]++;
+
+	for( v = 0; v < numVtx; v++ )
+		vtxFaceOfs[v+1] += vtxFaceOfs[v];
+
+	std::vector<int>	vtxFaces(numFaceVtx);
+	std::vector<uint>	cursor(vtxFaceOfs.begin(), vtxFaceOfs.end() - 1);
+
+	for( f = 0; f < numPolys; f++ )
+	{
+		for( uint c = faceStart[f]; c < faceStart[f+1]; c++ )
+			vtxFaces[ cursor[ids[c]]++ ] = f;
+	}
+
+
+	// Jetzt die Vertizen aller angrenzenden Faces einsammeln - stamp verhindert doppelte Eintraege
+	std::vector<int>	stamp(numVtx, -1);
+
+	offsets.resize(numVtx + 1);
+	offsets[0] = 0;
+
+	neighbours.clear();
+	neighbours.reserve(numFaceVtx * 2);
+
+	for( v = 0; v < numVtx; v++ )
+	{
+		stamp[v] = v;		// sich selbst nicht hinzufuegen
+
+		for( uint vf = vtxFaceOfs[v]; vf < vtxFaceOfs[v+1]; vf++ )
+		{
+			f = vtxFaces[vf];
+
+			for( uint c = faceStart[f]; c < faceStart[f+1]; c++ )
+			{
+				const int n = ids[c];
+
+				if( stamp[n] != v )
+				{
+					stamp[n] = v;
+					neighbours.push_back(n);
+				}
+			}
+		}// for each connected face
+
+		offsets[v+1] = (uint)neighbours.size();
+	}
+
+
+	topologyKey = key;
+	valid = true;
+
+	return true;
+}
@@ -0,0 +1,72 @@
+/*
+ * Copyright (C) 2002 Sebastian Thiel
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ */
+
+#ifndef VERTEX_ADJACENCY_INCLUDE
+#define VERTEX_ADJACENCY_INCLUDE
+
+#include <maya/MFnMesh.h>
+
+#include <MACROS.h>
+#include <componentAlgorithms.h>
+
+#include <vector>
+
+
+namespace BPT
+{
+
+/** Kompakte Nachbarschaftsliste: zu jedem Vertex alle Vertizen der angrenzenden Faces - also dieselbe Nachbarschaft,
+	die componentConverter::vtxToConnectedFaceVtx liefert, nur ohne Iteratoren.
+
+	Die Nachbarn von Vertex v liegen in neighbours[ offsets[v] ] bis neighbours[ offsets[v+1] - 1 ].
+	Die Struktur wird nur neu aufgebaut, wenn sich die Topologie aendert - verglichen wird ein Hash ueber counts und
+	connects, da eine Operation wie ein EdgeFlip die Zahl der Vertizen, Faces und FaceVertizen nicht aendert.
+*/
+
+class vertexAdjacency
+{
+public:
+
+	vertexAdjacency();
+
+	//! Baut die Nachbarschaft auf, wenn sich die Topologie geaendert hat - gibt true zurueck, wenn neu aufgebaut wurde
+	bool	update(const MFnMesh& meshFn);
+
+	void	clear();
+
+	uint	numVertices() const { return (uint)offsets.size() - 1; }
+
+	const int*	begin(int vtx) const { return neighbours.empty() ? NULL : &neighbours[0] + offsets[vtx]; }
+	const int*	end(int vtx) const { return neighbours.empty() ? NULL : &neighbours[0] + offsets[vtx+1]; }
+
+	//! Rohdaten, zum Beispiel fuer den geodesicSolver
+	const uint*	offsetData() const { return &offsets[0]; }
+	const int*	neighbourData() const { return neighbours.empty() ? NULL : &neighbours[0]; }
+
+private:
+
+	std::vector<uint>	offsets;		//!< vtx + 1 Eintraege
+	std::vector<int>	neighbours;		//!< Nachbarn aller Vertizen, hintereinander
+
+	contentHash	topologyKey;			//!< counts und connects beim letzten Aufbau
+	bool		valid;
+};
+
+}
+
+#endif
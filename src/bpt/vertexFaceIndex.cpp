@@ -0,0 +1,100 @@
+/*
+ * Copyright (C) 2002 Sebastian Thiel
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ */
+
+#include "vertexFaceIndex.h"
+
+#include <algorithm>
+
+
+using namespace BPT;
+
+
+//--------------------------------------------------------------------------------
+void	vertexFaceIndex::build(	unsigned numVertices,
+								const std::vector<int>& counts,
+								const std::vector<int>& starts,
+								const std::vector<int>& faceVertices )
+//--------------------------------------------------------------------------------
+{
+	vtxFaces.clear();
+	vtxFaces.resize(numVertices);
+
+	const unsigned numFaces = (unsigned)counts.size();
+
+	for( unsigned i = 0; i < numFaces; i++ )
+	{
+		const unsigned maxLength = starts[i] + counts[i];
+
+		for( unsigned x = starts[i]; x < maxLength; x++ )
+		{
+			const unsigned vtx = faceVertices[x];
+
+			if( vtx >= vtxFaces.size() )
+				vtxFaces.resize(vtx + 1);
+
+			//die Faces kommen aufsteigend, also reicht der Vergleich mit dem letzten Eintrag
+			std::vector<int>& faces = vtxFaces[vtx];
+			if( faces.empty() || faces.back() != (int)i )
+				faces.push_back(i);
+		}
+	}
+
+	isValid = true;
+}
+
+
+//--------------------------------------------------------------------------------
+void	vertexFaceIndex::link(int vtxID, int faceID)
+//--------------------------------------------------------------------------------
+{
+	if( !isValid || vtxID < 0 )
+		return;
+
+	if( (unsigned)vtxID >= vtxFaces.size() )
+		vtxFaces.resize(vtxID + 1);
+
+	std::vector<int>& faces = vtxFaces[vtxID];
+	std::vector<int>::iterator pos = std::lower_bound(faces.begin(), faces.end(), faceID);
+
+	if( pos == faces.end() || *pos != faceID )
+		faces.insert(pos, faceID);
+}
+
+
+//--------------------------------------------------------------------------------
+void	vertexFaceIndex::unlink(int vtxID, int faceID)
+//--------------------------------------------------------------------------------
+{
+	if( !isValid || vtxID < 0 || (unsigned)vtxID >= vtxFaces.size() )
+		return;
+
+	std::vector<int>& faces = vtxFaces[vtxID];
+	std::vector<int>::iterator pos = std::lower_bound(faces.begin(), faces.end(), faceID);
+
+	if( pos != faces.end() && *pos == faceID )
+		faces.erase(pos);
+}
+
+
+//--------------------------------------------------------------------------------
+void	vertexFaceIndex::clear()
+//--------------------------------------------------------------------------------
+{
+	std::vector< std::vector<int> >().swap(vtxFaces);
+	isValid = false;
+}
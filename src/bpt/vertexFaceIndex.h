@@ -0,0 +1,74 @@
+/*
+ * Copyright (C) 2002 Sebastian Thiel
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ */
+
+#ifndef VERTEX_FACE_INDEX_INCLUDE
+#define VERTEX_FACE_INDEX_INCLUDE
+
+// Absichtlich ohne Maya Includes - wird von meshTopology verwendet
+
+#include <vector>
+
+
+namespace BPT
+{
+
+/** Haelt pro Vertex die Faces, in denen er vorkommt - aufsteigend sortiert.
+
+	Wird erst bei der ersten Abfrage mit build() aufgebaut, da viele Aktionen ihn nie brauchen. Danach muessen alle
+	Methoden, die FaceVertizen veraendern, link/unlink rufen - solange der Index nicht gueltig ist, tun die nichts.
+*/
+
+class vertexFaceIndex
+{
+public:
+
+	vertexFaceIndex() : isValid(false) {}
+
+	bool	valid() const { return isValid; }
+
+	//! Baut den Index auf - die Vertizen von Face i liegen in faceVertices ab starts[i], counts[i] Stueck
+	void	build(	unsigned numVertices,
+					const std::vector<int>& counts,
+					const std::vector<int>& starts,
+					const std::vector<int>& faceVertices );
+
+	//! Die Faces von vtxID - leer, wenn der Vertex in keinem Face vorkommt
+	const std::vector<int>&	faces(int vtxID) const
+	{
+		return ( vtxID >= 0 && (unsigned)vtxID < vtxFaces.size() ) ? vtxFaces[vtxID] : noFaces;
+	}
+
+	//! muessen gerufen werden, wenn ein Vtx in ein Face kommt oder es verlaesst
+	void	link(int vtxID, int faceID);
+	void	unlink(int vtxID, int faceID);
+
+	//! Macht den Index ungueltig und gibt den Speicher frei
+	void	clear();
+
+private:
+
+	std::vector< std::vector<int> >	vtxFaces;
+	std::vector<int>				noFaces;	//!< bleibt immer leer
+
+	bool	isValid;
+};
+
+
+}
+
+#endif
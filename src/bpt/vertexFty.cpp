@@ -64,7 +64,6 @@ void	vertexFty::doIt()
 {
 	meshCreator& creator = *ftyCreator;
 	MIntArray& vtxList = *selVtxIDs;
-	BPT_Helpers helper;
 
 	//MERKE:Diese prozedur arbeitet nur mit dem MeshCreator, benutzt also kein MFnMesh etc.
 
@@ -76,16 +75,13 @@ void	vertexFty::doIt()
 	//verbundenen Faces geholt werden müssen - momentan ist die Sache ziemlich billig (CPU ZEIT)
 	//man müsste zuerst die verbundenen Faces zu allen Vertizen holen, und dese Dann abarbeiten
 
-	MIntArray allConnectedFaces;
-	UINT r = null;
-	
+	//die verbundenen Faces landen direkt in einem BA - doppelte fallen so von selbst weg und es muss kein IntArray gepruned werden
+	BPT_BA allConnectedFaces(creator.getLastFaceID() + 1);
 
 	UINT l,i,x;				//für iterationen
 //	UINT cv;				// == currentVtx
 
-	MIntArray	faceVtx;	//vertizen des jeweiligen faces
 	MIntArray	connectedFaces;	//hält die mit dem Vtx verbundenen Faces
-	MIntArray	match;			//Array fr übereinstimmende Vtx
 	//jetzt durch die SelVtx parsen und eine Facezurodnung herstellen
 	l = vtxList.length();
 
@@ -94,32 +90,15 @@ void	vertexFty::doIt()
 	{
 
 		creator.getConnectedFaces(vtxList[i],connectedFaces);
-		
-		allConnectedFaces.setLength(allConnectedFaces.length() + connectedFaces.length());
-
 
 		for(x = null; x < connectedFaces.length(); x++)
-		{
-			allConnectedFaces[r++] = connectedFaces[x];
-		}
+			allConnectedFaces.setBitTrue(connectedFaces[x]);
 
 	}
 
-	helper.memoryPrune(allConnectedFaces);
-
-	l = allConnectedFaces.length();
-	for(i = null; i < l; i++)
-	{
-
-		creator.getFaceVtxIDs(allConnectedFaces[i],faceVtx);
-
-		selCheckList.findMatching(faceVtx, match);
-
-		if(match.length() > 1)
-			splitFace(faceVtx,match,allConnectedFaces[i]);
-
-
-	}
+	//und jedes Face genau einmal in aufsteigender Reihenfolge splitten
+	faceSplitter splitter(*this, selCheckList);
+	allConnectedFaces.forEachSetBit(splitter);
 	
 	/*
 	for(i = 0; i < l; i++)
@@ -165,6 +144,18 @@ void	vertexFty::doIt()
 */
 }
 
+//-----------------------------------------------------------------------------------
+void	vertexFty::faceSplitter::operator()(ULONG faceID)
+//-----------------------------------------------------------------------------------
+{
+	fty.ftyCreator->getFaceVtxIDs(faceID,faceVtx);
+
+	selList.findMatching(faceVtx, match);
+
+	if(match.length() > 1)
+		fty.splitFace(faceVtx,match,faceID);
+}
+
 //-----------------------------------------------------------------------------------
 inline void vertexFty::splitFace( MIntArray& faceVtx, MIntArray& matchVtx, int faceID)
 //-----------------------------------------------------------------------------------
@@ -95,6 +95,22 @@ private:
 										MIntArray& matchVtx	,
 										int faceID				);
 
+	//* wird von doIt per BPT_BA::forEachSetBit fuer jedes verbundene Face gerufen
+	struct faceSplitter
+	{
+		faceSplitter(vertexFty& inFty, BPT_BA& inSelList) : fty(inFty), selList(inSelList) {}
+
+		void	operator()(ULONG faceID);
+
+		vertexFty&	fty;
+		BPT_BA&		selList;		//!< die gewaehlten Vertizen
+
+		MIntArray	faceVtx;		//!< vertizen des jeweiligen faces
+		MIntArray	match;			//!< Array fuer uebereinstimmende Vtx
+	};
+
+	friend struct faceSplitter;
+
 
 //------------------
 //PRIVATE ELEMENTE
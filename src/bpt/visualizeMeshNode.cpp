@@ -56,11 +56,29 @@ MObject	visualizeMeshNode::vtxWeights;
 
 
 visualizeMeshNode::visualizeMeshNode()
-	: list(450000)
-	, listNeedsUpdate(true)
-	, wasInCompute(false)
 	{}
-visualizeMeshNode::~visualizeMeshNode() {}
+
+//-----------------------------------------------------------------------
+visualizeMeshNode::~visualizeMeshNode()
+//-----------------------------------------------------------------------
+{
+	// Die VBOs gehoeren zum GL Kontext der Views - zum Freigeben muss er aktiv sein
+	if( !buffers.hasBuffers() )
+		return;
+
+	MHardwareRenderer* renderer = MHardwareRenderer::theRenderer();
+	if( !renderer || !renderer->glFunctionTable() )
+		return;
+
+	MStatus status;
+	M3dView view = M3dView::active3dView(&status);
+	if( !status )
+		return;
+
+	view.beginGL();
+	buffers.release( renderer->glFunctionTable() );
+	view.endGL();
+}
 
 //-----------------------------------------------------------------------
 MStatus visualizeMeshNode::compute( const MPlug& plug, MDataBlock& data )
@@ -79,8 +97,7 @@ MStatus visualizeMeshNode::compute( const MPlug& plug, MDataBlock& data )
 		
 		vtxWeightArray = weightData.array();
 		
-		//die displayList muss jetzt auf jeden Fall neu erstellt werden
-		listNeedsUpdate = wasInCompute = true;
+		// Was neu hochgeladen werden muss, wurde bereits in setDependentsDirty vermerkt
 
 		stat = data.setClean ( plug );
 		if (!stat) {
@@ -94,6 +111,20 @@ MStatus visualizeMeshNode::compute( const MPlug& plug, MDataBlock& data )
 	return MS::kSuccess;
 }
 
+//-----------------------------------------------------------------------
+MStatus visualizeMeshNode::setDependentsDirty( const MPlug& plugBeingDirtied, MPlugArray& affectedPlugs )
+//-----------------------------------------------------------------------
+{
+	// Nur die Puffer als veraltet markieren, die vom geaenderten Input abhaengen - 
+	// Deformationen laden also nur die Positionen neu hoch, geaenderte Weights nur die Farben
+	if( plugBeingDirtied == inputMesh )
+		buffers.invalidatePositions();
+	else if( plugBeingDirtied == vtxWeights )
+		buffers.invalidateColors();
+
+	return MPxLocatorNode::setDependentsDirty( plugBeingDirtied, affectedPlugs );
+}
+
 //-----------------------------------------------------------------------
 void visualizeMeshNode::draw( M3dView & view, const MDagPath & path, 
 							 M3dView::DisplayStyle style,
@@ -171,13 +202,8 @@ void visualizeMeshNode::draw( M3dView & view, const MDagPath & path,
 		MFnNumericData	numDataFn(colorObj);
 		numDataFn.getData(tmpColor.x, tmpColor.y, tmpColor.z);
 
-		//wenn sich die Farben verndert haben, dann die liste updaten - und alles neuzeichnen
-		if(tmpColor != vtxColor)
-		{
-			vtxColor = tmpColor;
-
-			listNeedsUpdate = true;
-		}
+		//wenn sich die Farben verndert haben, bemerken das die buffers selbst und laden die Farben neu hoch
+		vtxColor = tmpColor;
 
 		plug.setAttribute(vtxColorObj2);
 		plug.getValue(colorObj);
@@ -185,12 +211,7 @@ void visualizeMeshNode::draw( M3dView & view, const MDagPath & path,
 
 		numDataFn.getData(tmpColor.x, tmpColor.y, tmpColor.z);
 
-		if(tmpColor != vtxColor2)
-		{
-			vtxColor2 = tmpColor;
-			
-			listNeedsUpdate = true;
-		}
+		vtxColor2 = tmpColor;
 
 	}
 
@@ -216,8 +237,7 @@ void visualizeMeshNode::draw( M3dView & view, const MDagPath & path,
 
 	visualizeMeshNode::meshStatus mStat = getMeshStatus();
 
-	// Wenn sich der Anezigstatus des Meshes ndert, dann muss die DisplayList neu erstellt werden
-	// Nur um den PolygonOffset zu aktualisieren
+	// Der PolygonOffset haengt vom Anzeigestatus des Meshes ab - er wird bei jedem Zeichnen gesetzt
 	if(mStat != lastStat)
 	{
 		lastStat = mStat;
@@ -240,77 +260,25 @@ void visualizeMeshNode::draw( M3dView & view, const MDagPath & path,
 
 	view.beginGL(); 
 //	view.beginOverlayDrawing(); 
+
+
+	// Nur hochladen, was sich seit dem letzten Zeichnen geaendert hat - erst hier ist der Kontext der View aktiv
+	if( ! buffers.update(meshData, vtxWeightArray, vtxColor, vtxColor2, glf) )
+	{
+		view.endGL();
+		return;
+	}
 	
 	
 	//Im PointMode werden PointsGezeigt, und wenn das Objekt selected ist (dann funzt shaded nicht mehr)
-	if( style == M3dView::kPoints || (mStat == kSelected ) || wasInCompute || !allowBeautyMode)
+	// Solange die Daten auf der Grafikkarte liegen, ist der shaded Modus auch waehrend des Verschiebens schnell genug
+	if( style == M3dView::kPoints || (mStat == kSelected ) || !allowBeautyMode)
 	{
-
-		//VertiIter initialisieren
-		MItMeshVertex vertIter(meshData);
-		
-		drawPoints(vertIter, fPointSize, glf);
-		
-		// Das updaten der DisplayLists ist zu langsam, weshalb automatisch vtxMode genommen wird
-		wasInCompute = false;
-
+		drawPoints(fPointSize, glf);
 	}
 	else
 	{//in diesem Modus werden Faces gezeichnet, mit entsprechenden alphawerten als zeichen ihrer Farbe
-		
-		MItMeshPolygon polyIter(meshData);
-		MItMeshVertex	vertIter(meshData);
-		
-
-
-		//Die displayList pruefen
-		if( (listNeedsUpdate & !wasInCompute) || lastDMode != style )
-		{//neue Liste erzeugen - wird eigentlich nur einmal pro drawAktion gemacht
-			
-			lastDMode = style;
-
-			if( list != 450000 ) 
-				//alte liste lschen
-				glf->glDeleteLists(list, 1);
-			
-			list = glf->glGenLists(1);
-
-			if(glf->glIsList(list))
-			{
-				listNeedsUpdate = wasInCompute = false;
-
-
-				//#######################
-				//NEUE LISTE AUFZEICHNEN
-				//#######################
-				glf->glNewList(list, GL_COMPILE_AND_EXECUTE);
-
-		
-				//drawShaded(polyIter, vertIter, style, mStat);
-				drawShadedTriangles(polyIter, vertIter, style, mStat, glf);
-
-
-				//#######################
-				//ENDE LISTE AUFZEICHNEN
-				//#######################
-
-				glf->glEndList();
-
-			}
-			else
-			{
-				//fehler, also alles ohne displayList zeichnen
-				//drawShaded(polyIter, vertIter, style, mStat);
-				drawShadedTriangles(polyIter, vertIter, style, mStat, glf);
-			}
-
-		}
-		else 
-		{
-			glf->glCallList(list);
-			wasInCompute = false;
-		}
-
+		drawShadedTriangles(meshData, style, mStat, glf);
 	}
 
 
@@ -321,7 +289,7 @@ void visualizeMeshNode::draw( M3dView & view, const MDagPath & path,
 
 
 //-----------------------------------------------------------------------------------
-void	visualizeMeshNode::drawPoints( MItMeshVertex& vertIter, float fPointSize, MGLFunctionTable* glf)
+void	visualizeMeshNode::drawPoints( float fPointSize, MGLFunctionTable* glf)
 //-----------------------------------------------------------------------------------
 {
 
@@ -335,51 +303,8 @@ void	visualizeMeshNode::drawPoints( MItMeshVertex& vertIter, float fPointSize, M
 			glf->glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
 
 
-			/*
-			GLint	renderMode;
-			glGetIntegerv( GL_RENDER_MODE, &renderMode );
-			
-			// cout<<renderMode<<endl ;
-			
-			//	cout<<view.selectMode()<<endl;
-			
-			
-			
-			if(renderMode == GL_SELECT)
-				cout<<"Bin in SelectMode"<<endl;
-			else if(renderMode == GL_RENDER)
-				cout<<"StandardRenderMode"<<endl;
-			*/
-
-			Float3 tmpColor;
-			double dTmp;		// hlt das weight, cache
-
-			//weights verwenden um Farbe zu skalieren
-			uint numCVs = vertIter.count();
-			for (uint i = 0; i < numCVs; i++, vertIter.next()) 
-			{
-
-				dTmp = vtxWeightArray[i];
-
-				glf->glPointSize( static_cast<MGLfloat>((fPointSize * dTmp) + 3.0));
-
-				glf->glBegin( GL_POINTS );	
-
-			//	glPointSize( fPointSize );
-				MPoint		point( vertIter.position() );
-				
-				
-			
-				
-	
-
-				tmpColor = getCalColor(vtxColor, vtxColor2, dTmp );
-				glf->glColor4f(tmpColor.x,tmpColor.y,tmpColor.z, static_cast<MGLfloat>(dTmp));
-				glf->glVertex3f( (float)point.x, (float)point.y, (float)point.z);
-
-				glf->glEnd();
-			} 
-			
+			//weights bestimmen Farbe, Alpha und Groesse - das steckt bereits in den buffers
+			buffers.drawPoints(fPointSize, glf);
 			
 			
 			glf->glPopAttrib();
@@ -389,7 +314,7 @@ void	visualizeMeshNode::drawPoints( MItMeshVertex& vertIter, float fPointSize, M
 
 
 //-------------------------------------------------------------------------------------------------------------------------------------------
-void	visualizeMeshNode::drawShadedTriangles(MItMeshPolygon& polyIter, MItMeshVertex& vertIter, M3dView::DisplayStyle style, meshStatus meshStat, MGLFunctionTable* glf)
+void	visualizeMeshNode::drawShadedTriangles(const MObject& meshData, M3dView::DisplayStyle style, meshStatus meshStat, MGLFunctionTable* glf)
 //-------------------------------------------------------------------------------------------------------------------------------------------
 {
 
@@ -409,7 +334,7 @@ void	visualizeMeshNode::drawShadedTriangles(MItMeshPolygon& polyIter, MItMeshVer
 				
 				
 				
-				//Dass muss aussserhalb der displayList bleiben, weil dieser Wert nicht precompiliert werden darf
+				//Der Offset haengt vom MeshStatus ab und wird deshalb bei jedem Zeichnen gesetzt
 				float param1 = 0.45f, param2 = 0.55f;
 
 				// im DebugMode werden die Params anhand der NodeParameter gesetzt
@@ -451,48 +376,8 @@ void	visualizeMeshNode::drawShadedTriangles(MItMeshPolygon& polyIter, MItMeshVer
 
 				glf->glPolygonOffset( param1, param2 );
 				
-				//jedes Poly zeichnen
-				
-				uint numPolys = polyIter.count();
-				uint i, x , l;
-				MPoint	point;
-				Float3 tmpCol;
-				MPointArray triPoints;
-				MIntArray	triVtx;
-				//glColor4f(0.0f, 0.0f, 1.0f, 0.2);
-				
-				for(i = 0; i < numPolys; i++, polyIter.next())
-				{
-					
-
-					polyIter.getTriangles(triPoints, triVtx);
-					
-					
-					l = triVtx.length();
-					
-					
-					glf->glBegin(GL_TRIANGLES);
-					
-					for(x = 0; x < l ; x+=3)
-					{
-						tmpCol = getCalColor(vtxColor, vtxColor2 ,  vtxWeightArray[ triVtx[x] ]);
-						glf->glColor4f(tmpCol.x, tmpCol.y,tmpCol.z, static_cast<MGLfloat>(vtxWeightArray[ triVtx[x] ]));
-						glf->glVertex3d(triPoints[x].x, triPoints[x].y, triPoints[x].z);
-						
-			
-						tmpCol = getCalColor(vtxColor, vtxColor2 ,  vtxWeightArray[ triVtx[x+1] ]);
-						glf->glColor4f(tmpCol.x, tmpCol.y,tmpCol.z, static_cast<MGLfloat>(vtxWeightArray[ triVtx[x+1] ]));
-						glf->glVertex3d(triPoints[x+1].x, triPoints[x+1].y, triPoints[x+1].z);
-
-						tmpCol = getCalColor(vtxColor, vtxColor2 ,  vtxWeightArray[ triVtx[x+2] ]);
-						glf->glColor4f(tmpCol.x, tmpCol.y,tmpCol.z, static_cast<MGLfloat>(vtxWeightArray[ triVtx[x+2] ]));
-						glf->glVertex3d(triPoints[x+2].x, triPoints[x+2].y, triPoints[x+2].z);
-
-					}
-					
-					glf->glEnd();
-					
-				}
+				//alle Dreiecke in einem Rutsch zeichnen
+				buffers.drawTriangles(meshData, glf);
 				
 				
 			//	glDisable(GL_POLYGON_OFFSET_FILL);
@@ -48,6 +48,7 @@
 #include <maya/MSelectionList.h>
 
 #include <MACROS.h>
+#include <weightDisplayBuffers.h>
 #include "baselib/math_util.h"
 
 class MGLFunctionTable;
@@ -69,6 +70,8 @@ public:
 
     virtual MStatus   		compute( const MPlug& plug, MDataBlock& data );
 
+	virtual MStatus			setDependentsDirty( const MPlug& plugBeingDirtied, MPlugArray& affectedPlugs );
+
 	virtual void            draw( M3dView & view, const MDagPath & path, 
 								  M3dView::DisplayStyle style,
 								  M3dView::DisplayStatus status );
@@ -123,10 +126,9 @@ private:
 	meshStatus	getMeshStatus();
 
 
-	void	drawPoints( MItMeshVertex& vertIter, float fPointSize, MGLFunctionTable* glf);
+	void	drawPoints( float fPointSize, MGLFunctionTable* glf);
 	
-	void	drawShadedTriangles(MItMeshPolygon& polyIter, 
-								MItMeshVertex& vertIter, 
+	void	drawShadedTriangles(const MObject& meshData, 
 								M3dView::DisplayStyle style, 
 								meshStatus meshStat,
 								MGLFunctionTable* glf);
@@ -144,11 +146,7 @@ private:
 private:
 //--------------------
 
-	GLuint	list;
-	bool	listNeedsUpdate;
-	bool	wasInCompute;	//!< wird bentigt, damit man nicht stndig neue displayLists aufbaut, whrend man etwas verschiebt - man soll dann einfach so zeichnen
-
-	M3dView::DisplayStyle	lastDMode;
+	weightDisplayBuffers	buffers;	//!< Positionen, Farben und Dreiecke auf der Grafikkarte - ersetzt die displayList
 
 	Float3	vtxColor;
 	Float3	vtxColor2;
@@ -0,0 +1,356 @@
+/*
+ * Copyright (C) 2002 Sebastian Thiel
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ */
+
+#include "weightDisplayBuffers.h"
+
+#include "mayabaselib/ogl_headers.h"
+
+#include <maya/MFnMesh.h>
+#include <maya/MFloatPointArray.h>
+#include <maya/MItMeshPolygon.h>
+#include <maya/MPointArray.h>
+#include <maya/MIntArray.h>
+
+#include <algorithm>
+
+
+//-----------------------------------------------------------------------------------------
+weightDisplayBuffers::weightDisplayBuffers()
+: initialized(false)
+, useVBO(false)
+, positionsDirty(true)
+, colorsDirty(true)
+, trianglesDirty(true)
+, numVertices(-1)
+, numPolygons(-1)
+, numFaceVertices(-1)
+//-----------------------------------------------------------------------------------------
+{
+	for( int i = 0; i < kNumBuffers; i++ )
+	{
+		buffers[i] = 0;
+		allocated[i] = 0;
+	}
+
+	std::fill(pointSizeOffsets, pointSizeOffsets + numPointSizes + 1, 0);
+}
+
+
+//-----------------------------------------------------------------------------------------
+void	weightDisplayBuffers::upload(	GLuint buffer,
+										GLenum target,
+										const void* data,
+										size_t size,
+										size_t& allocatedSize,
+										GLenum usage,
+										MGLFunctionTable* glf )
+//-----------------------------------------------------------------------------------------
+{
+	if( !useVBO )
+		return;
+
+	glf->glBindBufferARB(target, buffer);
+
+	// Gleiche Groesse: nur die Daten ersetzen, der Treiber muss nichts neu allozieren
+	if( size == allocatedSize )
+		glf->glBufferSubDataARB(target, 0, (MGLsizeiptrARB)size, data);
+	else
+	{
+		glf->glBufferDataARB(target, (MGLsizeiptrARB)size, data, usage);
+		allocatedSize = size;
+	}
+
+	glf->glBindBufferARB(target, 0);
+}
+
+
+//-----------------------------------------------------------------------------------------
+bool	weightDisplayBuffers::update(	const MObject& mesh,
+										const MDoubleArray& weights,
+										const Float3& color1,
+										const Float3& color2,
+										MGLFunctionTable* glf )
+//-----------------------------------------------------------------------------------------
+{
+	MFnMesh	meshFn(mesh);
+
+	const int	numVtx = meshFn.numVertices();
+	const int	numPolys = meshFn.numPolygons();
+	const int	numFaceVtx = meshFn.numFaceVertices();
+
+	int i;
+
+	if(		numVtx != numVertices
+		||	numPolys != numPolygons
+		||	numFaceVtx != numFaceVertices
+		||	positionsDirty )
+	{
+		// Gleiche Zahlen schliessen zum Beispiel einen EdgeFlip nicht aus - also die connects vergleichen
+		MIntArray	counts, connects;
+		meshFn.getVertices(counts, connects);
+
+		contentHash	key;
+		key.add(numVtx);
+
+		for( i = 0; i < numPolys; i++ )
+			key.add(counts[i]);
+
+		for( i = 0; i < numFaceVtx; i++ )
+			key.add(connects[i]);
+
+		if( key != topologyKey )
+		{
+			positionsDirty = colorsDirty = trianglesDirty = true;
+
+			numVertices = numVtx;
+			numPolygons = numPolys;
+			numFaceVertices = numFaceVtx;
+			topologyKey = key;
+		}
+	}
+
+	if( numVtx == 0 )
+		return false;
+
+
+	if( !initialized )
+	{
+		useVBO = glf->extensionExists(kMGLext_ARB_vertex_buffer_object);
+
+		if( useVBO )
+			glf->glGenBuffersARB(kNumBuffers, buffers);
+
+		initialized = true;
+	}
+
+
+	if( color1 != lastColor1 || color2 != lastColor2 )
+	{
+		lastColor1 = color1;
+		lastColor2 = color2;
+
+		colorsDirty = true;
+	}
+
+
+	// POSITIONEN
+	if( positionsDirty )
+	{
+		MFloatPointArray	meshPoints;
+		meshFn.getPoints(meshPoints);
+
+		positions.resize(numVtx * 3);
+
+		for( i = 0; i < numVtx; i++ )
+		{
+			const MFloatPoint& p = meshPoints[i];
+
+			positions[i*3] = p.x;	positions[i*3+1] = p.y;	positions[i*3+2] = p.z;
+		}
+
+		upload(buffers[kPositions], MGL_ARRAY_BUFFER_ARB, &positions[0], positions.size() * sizeof(float), allocated[kPositions], MGL_DYNAMIC_DRAW_ARB, glf);
+
+		positionsDirty = false;
+	}
+
+
+	// FARBEN - und die Punkte, da ihre Groesse ebenfalls vom Weight abhaengt
+	if( colorsDirty )
+	{
+		colors.resize(numVtx * 4);
+
+		// Die Punktgroessen werden gezaehlt und die Punkte danach einsortiert
+		std::vector<unsigned char>	sizeIndex(numVtx);
+		uint	counts[numPointSizes] = { 0 };
+
+		const int numWeights = (int)weights.length();
+
+		for( i = 0; i < numVtx; i++ )
+		{
+			const double	w = ( i < numWeights ) ? weights[i] : 0.0;
+			const Float3	c = color1 * (float)w + color2 * (float)(1.0 - w);
+
+			float* col = &colors[i*4];
+			col[0] = c.x;	col[1] = c.y;	col[2] = c.z;	col[3] = (float)w;
+
+			// Punkte ohne Weight sind vollstaendig transparent und werden gar nicht erst gezeichnet
+			if( w <= 0.0 )
+			{
+				sizeIndex[i] = numPointSizes;
+				continue;
+			}
+
+			sizeIndex[i] = (unsigned char)std::min( (int)(w * numPointSizes), (int)numPointSizes - 1 );
+			counts[ sizeIndex[i] ]++;
+		}
+
+		pointSizeOffsets[0] = 0;
+		for( i = 0; i < numPointSizes; i++ )
+			pointSizeOffsets[i+1] = pointSizeOffsets[i] + counts[i];
+
+		points.resize( pointSizeOffsets[numPointSizes] );
+
+		uint	cursor[numPointSizes];
+		std::copy(pointSizeOffsets, pointSizeOffsets + numPointSizes, cursor);
+
+		for( i = 0; i < numVtx; i++ )
+		{
+			if( sizeIndex[i] < numPointSizes )
+				points[ cursor[ sizeIndex[i] ]++ ] = (uint)i;
+		}
+
+
+		upload(buffers[kColors], MGL_ARRAY_BUFFER_ARB, &colors[0], colors.size() * sizeof(float), allocated[kColors], MGL_DYNAMIC_DRAW_ARB, glf);
+
+		if( !points.empty() )
+			upload(buffers[kPoints], MGL_ELEMENT_ARRAY_BUFFER_ARB, &points[0], points.size() * sizeof(uint), allocated[kPoints], MGL_DYNAMIC_DRAW_ARB, glf);
+
+		colorsDirty = false;
+	}
+
+
+	return true;
+}
+
+
+//-----------------------------------------------------------------------------------------
+void	weightDisplayBuffers::bindArrays(MGLFunctionTable* glf)
+//-----------------------------------------------------------------------------------------
+{
+	glf->glPushClientAttrib(GL_CLIENT_VERTEX_ARRAY_BIT);
+
+	glf->glEnableClientState(GL_VERTEX_ARRAY);
+	glf->glEnableClientState(GL_COLOR_ARRAY);
+
+	if( useVBO )
+		glf->glBindBufferARB(MGL_ARRAY_BUFFER_ARB, buffers[kPositions]);
+
+	glf->glVertexPointer(3, GL_FLOAT, 0, arrayBase(&positions[0]));
+
+	if( useVBO )
+		glf->glBindBufferARB(MGL_ARRAY_BUFFER_ARB, buffers[kColors]);
+
+	glf->glColorPointer(4, GL_FLOAT, 0, arrayBase(&colors[0]));
+}
+
+
+//-----------------------------------------------------------------------------------------
+void	weightDisplayBuffers::unbindArrays(MGLFunctionTable* glf)
+//-----------------------------------------------------------------------------------------
+{
+	if( useVBO )
+	{
+		glf->glBindBufferARB(MGL_ARRAY_BUFFER_ARB, 0);
+		glf->glBindBufferARB(MGL_ELEMENT_ARRAY_BUFFER_ARB, 0);
+	}
+
+	glf->glPopClientAttrib();
+}
+
+
+//-----------------------------------------------------------------------------------------
+void	weightDisplayBuffers::drawPoints(float pointSize, MGLFunctionTable* glf)
+//-----------------------------------------------------------------------------------------
+{
+	if( points.empty() )
+		return;
+
+	bindArrays(glf);
+
+	if( useVBO )
+		glf->glBindBufferARB(MGL_ELEMENT_ARRAY_BUFFER_ARB, buffers[kPoints]);
+
+	const char*	base = (const char*)arrayBase(&points[0]);
+
+	for( int s = 0; s < numPointSizes; s++ )
+	{
+		const uint count = pointSizeOffsets[s+1] - pointSizeOffsets[s];
+		if( count == 0 )
+			continue;
+
+		// Mitte des Weight-Bereichs dieser Groesse
+		const float w = ( (float)s + 0.5f ) / (float)numPointSizes;
+
+		glf->glPointSize( (MGLfloat)(pointSize * w + 3.0f) );
+		glf->glDrawElements(GL_POINTS, (MGLsizei)count, GL_UNSIGNED_INT, base + pointSizeOffsets[s] * sizeof(uint));
+	}
+
+	unbindArrays(glf);
+}
+
+
+//-----------------------------------------------------------------------------------------
+void	weightDisplayBuffers::drawTriangles(const MObject& mesh, MGLFunctionTable* glf)
+//-----------------------------------------------------------------------------------------
+{
+	// Die Dreiecke werden erst gebraucht, wenn schattiert gezeichnet wird - und nur bei Topologieaenderungen neu erzeugt
+	if( trianglesDirty )
+	{
+		triangles.clear();
+		triangles.reserve(numFaceVertices * 3);
+
+		MItMeshPolygon	polyIter( const_cast<MObject&>(mesh) );
+		MPointArray		triPoints;
+		MIntArray		triVtx;
+
+		for( ; !polyIter.isDone(); polyIter.next() )
+		{
+			polyIter.getTriangles(triPoints, triVtx);
+
+			const uint l = triVtx.length();
+			for( uint x = 0; x < l; x++ )
+				triangles.push_back( (uint)triVtx[x] );
+		}
+
+		if( !triangles.empty() )
+			upload(buffers[kTriangles], MGL_ELEMENT_ARRAY_BUFFER_ARB, &triangles[0], triangles.size() * sizeof(uint), allocated[kTriangles], MGL_STATIC_DRAW_ARB, glf);
+
+		trianglesDirty = false;
+	}
+
+	if( triangles.empty() )
+		return;
+
+
+	bindArrays(glf);
+
+	if( useVBO )
+		glf->glBindBufferARB(MGL_ELEMENT_ARRAY_BUFFER_ARB, buffers[kTriangles]);
+
+	glf->glDrawElements(GL_TRIANGLES, (MGLsizei)triangles.size(), GL_UNSIGNED_INT, arrayBase(&triangles[0]));
+
+	unbindArrays(glf);
+}
+
+
+//-----------------------------------------------------------------------------------------
+void	weightDisplayBuffers::release(MGLFunctionTable* glf)
+//-----------------------------------------------------------------------------------------
+{
+	if( hasBuffers() )
+		glf->glDeleteBuffersARB(kNumBuffers, buffers);
+
+	for( int i = 0; i < kNumBuffers; i++ )
+	{
+		buffers[i] = 0;
+		allocated[i] = 0;
+	}
+
+	initialized = false;
+	positionsDirty = colorsDirty = trianglesDirty = true;
+}
@@ -0,0 +1,129 @@
+/*
+ * Copyright (C) 2002 Sebastian Thiel
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ */
+
+#ifndef WEIGHT_DISPLAY_BUFFERS_INCLUDE
+#define WEIGHT_DISPLAY_BUFFERS_INCLUDE
+
+#include <maya/M3dView.h>
+#include <maya/MObject.h>
+#include <maya/MDoubleArray.h>
+
+#include <MACROS.h>
+#include <componentAlgorithms.h>
+#include "baselib/math_util.h"
+
+#include <vector>
+
+
+class MGLFunctionTable;
+
+namespace BPT
+{
+
+/** Haelt Positionen, Farben und Indizes eines Meshes zur Darstellung von Weights in OpenGL Puffern.
+
+	Es wird nur hochgeladen, was sich geaendert hat: die Farben, wenn sich die Weights oder die Farben aendern,
+	die Positionen, wenn das Mesh deformiert wurde, und die Dreiecke nur bei Topologieaenderungen.
+	Gibt es keine VertexBufferObjects, werden dieselben Daten als VertexArrays aus dem Hauptspeicher gezeichnet.
+
+	Die Puffer gehoeren zum gegenwaertigen GL Kontext - wie vorher die displayLists. update und release duerfen deshalb
+	nur zwischen beginGL und endGL gerufen werden, und der Besitzer muss release vor seiner Zerstoerung rufen.
+*/
+
+class weightDisplayBuffers
+{
+public:
+
+	weightDisplayBuffers();
+
+	//! Muss gerufen werden, wenn sich die Punkte oder die Topologie des Meshes geaendert haben koennten
+	void	invalidatePositions() { positionsDirty = true; }
+
+	//! Muss gerufen werden, wenn sich die Weights geaendert haben
+	void	invalidateColors() { colorsDirty = true; }
+
+	//! Bringt Positionen und Farben auf den neuesten Stand - gibt false zurueck, wenn es nichts zu zeichnen gibt
+	bool	update(	const MObject& mesh,
+					const MDoubleArray& weights,
+					const Float3& color1,
+					const Float3& color2,
+					MGLFunctionTable* glf );
+
+	//! Zeichnet jeden Vertex als Punkt, Groesse und Alpha anhand des Weights. update muss vorher gerufen worden sein
+	void	drawPoints(float pointSize, MGLFunctionTable* glf);
+
+	//! Zeichnet die Dreiecke des Meshes mit den VertexFarben - der GL Status muss vom Aufrufer gesetzt werden
+	void	drawTriangles(const MObject& mesh, MGLFunctionTable* glf);
+
+	//! true, wenn GL Puffer erzeugt wurden, die mit release wieder freigegeben werden muessen
+	bool	hasBuffers() const { return initialized && useVBO; }
+
+	//! Gibt die Puffer frei - beim naechsten update wird alles neu erzeugt und hochgeladen
+	void	release(MGLFunctionTable* glf);
+
+private:
+
+	//! Laedt data in den Puffer buffer, alloziert nur neu, wenn sich die Groesse geaendert hat
+	void	upload(GLuint buffer, GLenum target, const void* data, size_t size, size_t& allocated, GLenum usage, MGLFunctionTable* glf);
+
+	//! Setzt Vertex- und ColorPointer - muss mit unbindArrays abgeschlossen werden
+	void	bindArrays(MGLFunctionTable* glf);
+	void	unbindArrays(MGLFunctionTable* glf);
+
+	//! Gibt den Zeiger fuer gl*Pointer und glDrawElements zurueck - Offset 0 bei VBOs, sonst die Daten selbst
+	const void*	arrayBase(const void* data) const { return useVBO ? NULL : data; }
+
+private:
+
+	enum	{	kPositions, kColors, kTriangles, kPoints, kNumBuffers };
+
+	//! Die Punkte werden nach ihrem Weight in so viele Groessen eingeteilt - pro Groesse ein DrawCall
+	enum	{	numPointSizes = 16 };
+
+
+	std::vector<float>	positions;		//!< xyz pro Vertex
+	std::vector<float>	colors;			//!< rgba pro Vertex
+	std::vector<uint>	triangles;		//!< 3 VertexIDs pro Dreieck
+	std::vector<uint>	points;			//!< VertexIDs mit Weight > 0, nach Punktgroesse sortiert
+
+	uint	pointSizeOffsets[numPointSizes + 1];	//!< Bereich jeder Punktgroesse in points
+
+	GLuint	buffers[kNumBuffers];
+	size_t	allocated[kNumBuffers];		//!< Groesse der Puffer in Bytes
+
+	bool	initialized;				//!< sind die Puffer erzeugt ?
+	bool	useVBO;
+
+	bool	positionsDirty;
+	bool	colorsDirty;
+	bool	trianglesDirty;
+
+	Float3	lastColor1;
+	Float3	lastColor2;
+
+	// Zur Erkennung von Topologieaenderungen - der Hash ueber counts und connects wird nur neu berechnet, wenn die
+	// Positionen ohnehin neu geholt werden muessen, denn ohne invalidatePositions hat sich auch das Mesh nicht geaendert
+	int			numVertices;
+	int			numPolygons;
+	int			numFaceVertices;
+	contentHash	topologyKey;
+};
+
+}
+
+#endif
@@ -25,6 +25,7 @@
 #include "baselib/typ.h"
 
 #include <cassert>
+#include <cstring>
 
 
 //********************************************************************
@@ -93,6 +94,9 @@ class ogl_buffer : NonCopyable
 	//! \return true if all the buffers in this instance are set and can be used !
 	bool					is_valid() const;
 	
+	//! \return amount of primitives stored per buffer
+	size_t					size() const;
+	
 	//! @} end Query Interface
 	
 	
@@ -181,6 +185,10 @@ class ogl_system_buffer : public ogl_buffer <VertexPrimitive, ColorPrimitive>
 		return _len != 0;
 	}
 	
+	size_t			size() const {
+		return _len;
+	}
+	
 	inline
 	bool draw(MGLFunctionTable* glf) const {
 		if (!is_valid()) {
@@ -417,6 +425,11 @@ class ogl_gpu_buffer : public ogl_buffer<VertexPrimitive, ColorPrimitive>
 			return _gl_buf != invalid_buf;
 		}
 		
+		inline
+		size_t size() const {
+			return _len;
+		}
+		
 		
 		bool delete_array(const BufferType type)
 		{
@@ -439,4 +452,38 @@ class ogl_gpu_buffer : public ogl_buffer<VertexPrimitive, ColorPrimitive>
 		
 };
 
+
+//********************************************************************
+//**	Utilities
+//********************************************************************
+
+//! Copy all primitives of the source buffer into the destination buffer, which is resized accordingly.
+//! This allows to upload samples into another buffer type without regenerating them.
+//! \return true on success
+template <typename SourceBuffer, typename DestinationBuffer>
+bool copy_buffer(SourceBuffer& src, DestinationBuffer& dst)
+{
+	typedef typename SourceBuffer::vertex_primitive	VertexPrimitive;
+	typedef typename SourceBuffer::color_primitive	ColorPrimitive;
+	
+	if (!dst.resize(src.size()) || !src.is_valid()) {
+		return false;
+	}
+	
+	if (!src.begin_access()) {
+		return false;
+	}
+	if (!dst.begin_access()) {
+		src.end_access();
+		return false;
+	}
+	
+	memcpy(dst.begin(VertexArray), src.begin(VertexArray), sizeof(VertexPrimitive) * src.size());
+	memcpy(dst.begin(ColorArray), src.begin(ColorArray), sizeof(ColorPrimitive) * src.size());
+	
+	dst.end_access();
+	src.end_access();
+	return true;
+}
+
 #endif // ogl_buffer_H
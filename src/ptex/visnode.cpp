@@ -31,6 +31,10 @@
 #include <maya/MFloatVector.h>
 #include <maya/MFloatPointArray.h>
 #include <maya/MPlugArray.h>
+#include <maya/MFnPointArrayData.h>
+#include <maya/MFnVectorArrayData.h>
+#include <maya/MPointArray.h>
+#include <maya/MVectorArray.h>
 
 
 #include "mayabaselib/ogl_headers.h"
@@ -78,12 +82,15 @@ MObject PtexVisNode::aOutDataType;
 MObject PtexVisNode::aOutUBorderMode;
 MObject PtexVisNode::aOutVBorderMode;
 MObject PtexVisNode::aOutNumSamples;
+MObject PtexVisNode::aOutSamplePositions;
+MObject PtexVisNode::aOutSampleColors;
 MObject PtexVisNode::aGlPointSize;
 
 
 PtexVisNode::PtexVisNode()
 	: m_ptex_num_channels(0)
 	, m_needs_cache_update(false)
+	, m_sysbuf_uptodate(false)
     , m_gl_point_size(1.0)
 {}
 
@@ -194,6 +201,18 @@ MStatus PtexVisNode::initialize()
 	aOutNumSamples = numFn.create("outNumSamples", "ons", MFnNumericData::kInt);
 	setup_as_output(numFn);
 	
+	MFnPointArrayData pointArrayFn;
+	aOutSamplePositions = typFn.create("outSamplePositions", "osp", MFnData::kPointArray, &status);
+	CHECK_MSTATUS(status);
+	typFn.setDefault(pointArrayFn.create());
+	setup_as_output(typFn);
+	
+	MFnVectorArrayData vectorArrayFn;
+	aOutSampleColors = typFn.create("outSampleColors", "osc", MFnData::kVectorArray, &status);
+	CHECK_MSTATUS(status);
+	typFn.setDefault(vectorArrayFn.create());
+	setup_as_output(typFn);
+	
 	aOutMeshType = mfnEnum.create("outMeshType", "omt");
 	setup_as_output(mfnEnum);
 	mfnEnum.addField("triangle", 0);
@@ -237,6 +256,8 @@ MStatus PtexVisNode::initialize()
 	CHECK_MSTATUS(addAttribute(aOutUBorderMode));
 	CHECK_MSTATUS(addAttribute(aOutVBorderMode));
 	CHECK_MSTATUS(addAttribute(aOutNumSamples));
+	CHECK_MSTATUS(addAttribute(aOutSamplePositions));
+	CHECK_MSTATUS(addAttribute(aOutSampleColors));
 	
 	
 
@@ -258,6 +279,15 @@ MStatus PtexVisNode::initialize()
 	CHECK_MSTATUS(attributeAffects(aPtexFileName,   aNeedsCompute));
 	CHECK_MSTATUS(attributeAffects(aPtexFilterSize, aNeedsCompute));
 	CHECK_MSTATUS(attributeAffects(aPtexFilterType, aNeedsCompute));
+	
+	// Exported samples are affected by everything that affects our samples
+	MObject* sampleInputs[] = {&aInMesh, &aDisplayMode, &aSampleMultiplier, 
+	                           &aPtexFileName, &aPtexFilterSize, &aPtexFilterType};
+	MObject** sampleInputsEnd = sampleInputs + (sizeof(sampleInputs) / sizeof(sampleInputs[0]));
+	for (MObject** i = sampleInputs; i < sampleInputsEnd; ++i) {
+		CHECK_MSTATUS(attributeAffects(**i, aOutSamplePositions));
+		CHECK_MSTATUS(attributeAffects(**i, aOutSampleColors));
+	}
 
 	return MS::kSuccess;
 }
@@ -339,6 +369,9 @@ void PtexVisNode::release_cache()
 {
 	m_sysbuf.resize(0);
 	m_gpubuf.resize(0);
+	m_sysbuf_uptodate = false;
+	m_face_abs_samples.clear();
+	m_topo.clear();
 	
 	MPlug(thisMObject(), aOutNumSamples).setInt(0);
 }
@@ -355,25 +388,152 @@ bool PtexVisNode::setInternalValueInContext(const MPlug &plug, const MDataHandle
 	return false;
 }
 
-//! \return uv values for the given point on a triangle
-template <typename T>
-void uv_from_pos(const T& a, const T& b, const T& c, const T& p, float& out_u, float& out_v)
+const PtexVisNode::SampleUVVector& PtexVisNode::face_absolute_samples(const int ures, const int vres)
 {
-	T v0 = b - a;
-	T v1 = c - a;
-	T v2 = p - a;
+	const FaceRes res(ures, vres);
+	SampleTableMap::const_iterator it = m_face_abs_samples.find(res);
+	if (it != m_face_abs_samples.end()) {
+		return it->second;
+	}
 	
-	const float dot00 = dot(v0, v0);
-	const float dot01 = dot(v0, v1);
-	const float dot02 = dot(v0, v2);
+	SampleUVVector& samples = m_face_abs_samples[res];
+	
+	// Walk along the first edge to generate the sampling raster
+	// that was used to create the texture. Each texel is made of an even and 
+	// an odd triangle, whose centers lie at 1/3 and 2/3 of the texel in edge space.
+	// Our samples hit the sample center if no sampling multiplier is used
+	const float ufres = (float)ures;
+	const float vfres = (float)vres;
+	const float third = 1.0f / 3.0f;
+	
+	int ur = ures;				// editable vresolution
+	for (int v = 0; v < vres; ++v, --ur) {
+		for (int u = 0; u < ur; ++u) {
+			for (short is_odd = 0; is_odd < 2; is_odd += 1 + (u+1==ur)) {
+				const float ofs = is_odd ? 2.0f * third : third;
+				samples.push_back(SampleUV((u + ofs) / ufres, (v + ofs) / vfres));
+			}// for each even/odd texel
+		}// for each usample
+	}// for each vsample
+	
+	return samples;
+}
+
+//! \return true if both arrays have the same length and contents
+static bool equal_arrays(const MIntArray& lhs, const MIntArray& rhs)
+{
+	const uint32_t len = lhs.length();
+	if (len != rhs.length()) {
+		return false;
+	}
+	for (uint32_t i = 0; i < len; ++i) {
+		if (lhs[i] != rhs[i]) {
+			return false;
+		}
+	}
+	return true;
+}
+
+void PtexVisNode::TopologyCache::clear()
+{
+	num_vertices = -1;
+	num_ptex_faces = -1;
+	mesh_type = Ptex::mt_triangle;
+	poly_counts.clear();
+	poly_vtx_ids.clear();
+	faces.clear();
+}
+
+bool PtexVisNode::update_topology(const MFnMesh& meshFn, const PtexTexture& tex)
+{
+	// Getting the connectivity is required for a rebuild anyway, and comparing it is much cheaper 
+	// than rebuilding. Counts alone would miss changes that keep them, like flipping an edge
+	const int numVertices = meshFn.numVertices();
+	
+	MIntArray counts, vtx_ids;
+	meshFn.getVertices(counts, vtx_ids);
+	
+	if (m_topo.num_vertices == numVertices && m_topo.num_ptex_faces == tex.numFaces() &&
+	    m_topo.mesh_type == tex.meshType() && 
+	    equal_arrays(m_topo.poly_counts, counts) && equal_arrays(m_topo.poly_vtx_ids, vtx_ids)) {
+		return true;
+	}
 	
-	const float dot11 = dot(v1, v1);
-	const float dot12 = dot(v1, v2);
+	m_topo.clear();
+	m_topo.poly_counts = counts;
+	m_topo.poly_vtx_ids = vtx_ids;
 	
-	const float invDenom = 1.0f / (dot00 * dot11 - dot01 * dot01);
+	// Triangle textures map one face per triangle. Quad textures map one face per quad, 
+	// and one subface per corner of every other polygon
+	FaceMappingVector& faces = m_topo.faces;
+	faces.reserve(tex.numFaces());
 	
-	out_u = (dot11 * dot02 - dot01 * dot12) * invDenom;
-	out_v = (dot00 * dot12 - dot01 * dot02) * invDenom;
+	FaceMapping fm;
+	fm.vtx_ofs = 0;
+	for (uint32_t i = 0; i < counts.length(); fm.vtx_ofs += counts[i], ++i) {
+		fm.num_vtx = counts[i];
+		fm.subface = -1;
+		
+		if (tex.meshType() == Ptex::mt_triangle) {
+			if (fm.num_vtx != 3) {
+				m_error = "Triangle textures require a triangulated mesh, but polygon ";
+				m_error += (int)i;
+				m_error += " has ";
+				m_error += fm.num_vtx;
+				m_error += " vertices";
+				m_topo.clear();
+				return false;
+			}
+			faces.push_back(fm);
+		} else if (fm.num_vtx == 4) {
+			faces.push_back(fm);
+		} else {
+			for (fm.subface = 0; fm.subface < fm.num_vtx; ++fm.subface) {
+				faces.push_back(fm);
+			}
+		}
+	}// for each polygon
+	
+	if (faces.size() != (size_t)tex.numFaces()) {
+		m_error = "Face count of texture does not match the face count implied by the connected mesh: ";
+		m_error += (int)faces.size();
+		m_error += " != ";
+		m_error += tex.numFaces();
+		m_error += " (mesh.facecount != tex.facecount)";
+		m_topo.clear();
+		return false;
+	}
+	
+	m_topo.num_vertices = numVertices;
+	m_topo.num_ptex_faces = tex.numFaces();
+	m_topo.mesh_type = tex.meshType();
+	
+	return true;
+}
+
+//! Sample a quad in ptex orientation, u runs from q[0] to q[1] and v from q[0] to q[3].
+//! Samples are placed at ofs texels from the texel's origin, i.e. 0.5 to sample texel centers
+template <typename VtxIterator, typename ColIterator>
+inline
+void sample_quad(PtexFilter* filter, const int faceid, const int numChannels, const Float3* q,
+                 const int ures, const int vres, const float ofs, const float fsize,
+                 VtxIterator& opos, ColIterator& ocol)
+{
+	Float4 pix;
+	const float ufres = (float)ures;
+	const float vfres = (float)vres;
+	
+	for (int v = 0; v < vres; ++v) {
+		const float vf = (v + ofs) / vfres;
+		const Float3 left = q[0] + (q[3] - q[0]) * vf;
+		const Float3 span = q[1] + (q[2] - q[1]) * vf - left;
+		for (int u = 0; u < ures; ++u) {
+			const float uf = (u + ofs) / ufres;
+			filter->eval(&pix.x, 0, numChannels, faceid, uf, vf, fsize, fsize, fsize, fsize);
+			*opos++ = left + span * uf;
+			*ocol++ = pix;
+		}// for each usample
+	}// for each vsample
 }
 
 template <typename Buffer>
@@ -483,11 +643,6 @@ bool PtexVisNode::update_sample_buffer(Buffer &buf)
 	case FaceRelative:	// fall through
 	case FaceAbsolute:
 	{
-		if (tex->meshType() != Ptex::mt_triangle)  {
-			m_error = "Cannot visualize non-triangle meshes for now";
-			break;
-		}
-		
 		MStatus stat;
 		// init from conneted node - don't have datablock here :(
 		MPlug inMeshPlug(thisNode, aInMesh);
@@ -500,19 +655,7 @@ bool PtexVisNode::update_sample_buffer(Buffer &buf)
 		}
 		MFnMesh meshFn(cons[0].node(), &stat);
 		
-		
-		// For now, lets support one-on-one mappings without sub-face support
-		if (meshFn.numPolygons() != tex->numFaces()) {
-			m_error = "Face count of texture does not match polygon count of connected mesh. Currently these must match one on one: ";
-			m_error += meshFn.numPolygons();
-			m_error += " != ";
-			m_error += tex->numFaces();
-			m_error += "(mesh.tricount != tex.tricount)";
-			break;
-		}
-		
-		if (tex->numFaces() == 0) {
-			m_error = "Empty texture encountered";
+		if (!update_topology(meshFn, *tex)) {
 			break;
 		}
 		
@@ -524,13 +667,22 @@ bool PtexVisNode::update_sample_buffer(Buffer &buf)
 		meshFn.getPoints(vtx);
 		#define TFLOAT3 MFloatPoint
 #endif
-		MIntArray tcounts;
-		MIntArray tverts;
-		meshFn.getTriangles(tcounts, tverts);
-		tcounts.clear();
+		const bool isTriangleMesh = tex->meshType() == Ptex::mt_triangle;
+		const MIntArray& pvtx = m_topo.poly_vtx_ids;
 		
 		const float fsize = MPlug(thisNode, aPtexFilterSize).asFloat();
 		
+		// Obtain all sample patterns up-front - the table cache must not change while
+		// we are sampling in parallel
+		std::vector<const SampleUVVector*> face_samples;
+		if (displayMode == FaceAbsolute && isTriangleMesh) {
+			face_samples.resize(numFaces);
+			for (int i = 0; i < numFaces; ++i) {
+				const Ptex::Res& r = tex->getFaceInfo(i).res;
+				face_samples[i] = &face_absolute_samples((int)(r.u() * mult), (int)(r.v() * mult));
+			}// for each face
+		}
+		
 #ifdef _OPENMP
 #pragma omp parallel for private(pix) schedule(dynamic) num_threads(thread_count)
 #endif
@@ -540,17 +692,48 @@ bool PtexVisNode::update_sample_buffer(Buffer &buf)
 			const int vres = (int)(fi.res.v() * mult);
 			const float ufres = (float)ures;
 			const float vfres = (float)vres;
-			
-			const uint32_t triofs = i * 3;
-			const TFLOAT3& a = vtx[tverts[triofs + 0]];
-			const TFLOAT3& b = vtx[tverts[triofs + 1]];
-			const TFLOAT3& c = vtx[tverts[triofs + 2]];
+			const FaceMapping& fm = m_topo.faces[i];
 			
 #ifdef _OPENMP
 			VtxPrimitive* popos = opos + flut[i];
 			ColPrimitive* pocol = ocol + flut[i];
 #endif
 			
+			if (!isTriangleMesh) {
+				Float3 q[4];
+				if (fm.subface < 0) {
+					for (int c = 0; c < 4; ++c) {
+						q[c] = vtx[pvtx[fm.vtx_ofs + c]];
+					}
+				} else {
+					// subface of corner k spans the corner, the next edge's center, the polygon's center
+					// and the previous edge's center
+					Float3 center;
+					for (int c = 0; c < fm.num_vtx; ++c) {
+						center += vtx[pvtx[fm.vtx_ofs + c]];
+					}
+					const int k = fm.subface;
+					const Float3 corner = vtx[pvtx[fm.vtx_ofs + k]];
+					q[0] = corner;
+					q[1] = (corner + vtx[pvtx[fm.vtx_ofs + (k + 1) % fm.num_vtx]]) * 0.5f;
+					q[2] = center / (float)fm.num_vtx;
+					q[3] = (corner + vtx[pvtx[fm.vtx_ofs + (k + fm.num_vtx - 1) % fm.num_vtx]]) * 0.5f;
+				}
+				
+				// relative mode walks the uvs, absolute mode hits the texel centers
+				const float ofs = displayMode == FaceAbsolute ? 0.5f : 0.0f;
+#ifdef _OPENMP
+				sample_quad(filter, i, numChannels, q, ures, vres, ofs, fsize, popos, pocol);
+#else
+				sample_quad(filter, i, numChannels, q, ures, vres, ofs, fsize, opos, ocol);
+#endif
+				continue;
+			}
+			
+			const TFLOAT3& a = vtx[pvtx[fm.vtx_ofs + 0]];
+			const TFLOAT3& b = vtx[pvtx[fm.vtx_ofs + 1]];
+			const TFLOAT3& c = vtx[pvtx[fm.vtx_ofs + 2]];
+			
 			switch(displayMode)
 			{
 			case FaceRelative:
@@ -575,42 +758,23 @@ bool PtexVisNode::update_sample_buffer(Buffer &buf)
 			}
 			case FaceAbsolute:
 			{
-				// Walk along the first edge to generate the sampling raster
-				// that was used to create the texture. Our samples hit the sample center
-				// if no sampling multiplier is used
-				const TFLOAT3 suv = (b - a) / ufres;	// vector spanning one sample in u
-				//const TFLOAT3 suvhalf = suv / 2.0f;
-				const TFLOAT3 svv = (c - a) / vfres;	// vector spanning one sample in v
-				//const TFLOAT3 svvhalf = svv / 2.0f;
+				// The sample pattern only depends on the face resolution, and is given in edge space.
+				// Hence we just place it onto the triangle
+				const TFLOAT3 e1 = b - a;
+				const TFLOAT3 e2 = c - a;
+				const SampleUVVector& samples = *face_samples[i];
+				const SampleUVVector::const_iterator send = samples.end();
 				
-				int ur = ures;				// editable vresolution
-				float uf, vf;				// uvs matching our sample positions
-				
-				// even samples
-				TFLOAT3 p;
-				for (int v = 0; v < vres; ++v, --ur) {
-					TFLOAT3 ta = a + (svv * static_cast<float>(v));		// texel vertex a
-					for (int u = 0; u < ur; ++u, ta += suv) {
-						const TFLOAT3 tb = ta + suv;
-						const TFLOAT3 tc = ta + svv;
-						for (short is_odd = 0; is_odd < 2; is_odd += 1 + (u+1==ur)) {
-							if (is_odd) {
-								p = (tb + tc + (ta + (suv + svv))) / 3.0f;
-							} else {
-								p = (ta + tb + tc) / 3.0f;
-							}
-							uv_from_pos(a, b, c, p, uf, vf);
-							filter->eval(&pix.x, 0, numChannels, i, uf, vf, fsize, fsize, fsize, fsize);
+				for (SampleUVVector::const_iterator s = samples.begin(); s < send; ++s) {
+					filter->eval(&pix.x, 0, numChannels, i, s->u, s->v, fsize, fsize, fsize, fsize);
 #ifdef _OPENMP
-							*popos++ = p;
-							*pocol++ = pix;
-#else							
-							*opos++ = p;
-							*ocol++ = pix;
+					*popos++ = a + e1 * s->u + e2 * s->v;
+					*pocol++ = pix;
+#else
+					*opos++ = a + e1 * s->u + e2 * s->v;
+					*ocol++ = pix;
 #endif
-						}// for each even/odd texel
-					}// for each vsample
-				}// for each usample
+				}// for each sample
 				break;
 			}
 			default: break;
@@ -642,12 +806,57 @@ bool PtexVisNode::update_sample_buffer(Buffer &buf)
 		m_error = MString();
 	}
 	
-	// Update sample count, just for user information
-	MPlug(thisNode, aOutNumSamples).setInt(static_cast<int>(numTexels));
-	
 	return rval;
 }
 
+bool PtexVisNode::update_system_cache()
+{
+	if (m_sysbuf_uptodate) {
+		return m_sysbuf.is_valid();
+	}
+	
+	m_sysbuf_uptodate = true;
+	if (!update_sample_buffer(m_sysbuf)) {
+		// don't keep partial samples around
+		m_sysbuf.resize(0);
+		return false;
+	}
+	return true;
+}
+
+void PtexVisNode::export_samples(MDataBlock& data)
+{
+	MFnPointArrayData pointArrayFn;
+	MFnVectorArrayData vectorArrayFn;
+	MObject pointData = pointArrayFn.create();
+	MObject vectorData = vectorArrayFn.create();
+	
+	// Write directly into the array data, to prevent yet another copy of the samples
+	if (m_sysbuf.is_valid() && m_sysbuf.begin_access()) {
+		const size_t numSamples = m_sysbuf.size();
+		const VtxPrimitive* ipos = reinterpret_cast<const VtxPrimitive*>(m_sysbuf.begin(VertexArray));
+		const ColPrimitive* icol = reinterpret_cast<const ColPrimitive*>(m_sysbuf.begin(ColorArray));
+		
+		MPointArray& positions = pointArrayFn.array();
+		MVectorArray& colors = vectorArrayFn.array();
+		positions.setLength(static_cast<unsigned int>(numSamples));
+		colors.setLength(static_cast<unsigned int>(numSamples));
+		
+		for (unsigned int i = 0; i < numSamples; ++i, ++ipos, ++icol) {
+			positions.set(i, ipos->field[0], ipos->field[1], ipos->field[2]);
+			colors.set(MVector(icol->field[0], icol->field[1], icol->field[2]), i);
+		}
+		m_sysbuf.end_access();
+	}
+	
+	data.outputValue(aOutSamplePositions).setMObject(pointData);
+	data.outputValue(aOutSampleColors).setMObject(vectorData);
+	data.outputValue(aOutNumSamples).setInt(static_cast<int>(m_sysbuf.size()));
+	
+	data.setClean(aOutSamplePositions);
+	data.setClean(aOutSampleColors);
+}
+
 MStatus PtexVisNode::compute(const MPlug& plug, MDataBlock& data)
 {
 	// in all cases, just set us clean - if we are not setup, we would be called
@@ -673,6 +882,17 @@ MStatus PtexVisNode::compute(const MPlug& plug, MDataBlock& data)
 		
 		// We cache the samples for faster drawing, and won't support live-drawing for now
 		m_needs_cache_update = true;
+		m_sysbuf_uptodate = false;
+		return MS::kSuccess;
+	} else if (plug == aOutSamplePositions || plug == aOutSampleColors) {
+		// Samples are taken into our system cache, which can be reused by draw() later
+		data.inputValue(aNeedsCompute);
+		if (m_ptex_texture.get() && m_ptex_filter.get()) {
+			update_system_cache();
+		} else {
+			m_sysbuf.resize(0);
+		}
+		export_samples(data);
 		return MS::kSuccess;
 	} else if (plug == aOutMetaDataKeys || plug == aOutNumChannels || plug == aOutNumFaces ||
 	           plug == aOutAlphaChannel || plug == aOutHasEdits || plug == aOutHasMipMaps  ||
@@ -755,12 +975,20 @@ void PtexVisNode::draw(M3dView &view, const MDagPath &path, M3dView::DisplayStyl
 		const DisplayCacheMode cache_mode = (DisplayCacheMode)MPlug(thisMObject(), aDisplayCacheMode).asShort();
 		if (cache_mode == DCSystem) {
 			m_gpubuf.resize(0);
-			update_sample_buffer(m_sysbuf);
+			update_system_cache();
+			MPlug(thisMObject(), aOutNumSamples).setInt(static_cast<int>(m_sysbuf.size()));
 		} else {
 			// always keep it uptodate
 			m_gpubuf.set_glf(glf);
+			// If our samples were exported, just upload them instead of sampling again
+			if (m_sysbuf_uptodate) {
+				copy_buffer(m_sysbuf, m_gpubuf);
+			} else {
+				update_sample_buffer(m_gpubuf);
+			}
 			m_sysbuf.resize(0);
-			update_sample_buffer(m_gpubuf);
+			m_sysbuf_uptodate = false;
+			MPlug(thisMObject(), aOutNumSamples).setInt(static_cast<int>(m_gpubuf.size()));
 		}
 	}
 	
@@ -7,11 +7,16 @@
 
 #include <maya/MPxLocatorNode.h>
 #include <maya/MGLdefinitions.h>
+#include <maya/MIntArray.h>
 
+#include <map>
+#include <utility>
 
 typedef PtexPtr<PtexFilter> PtexFilterPtr;
 typedef PtexPtr<PtexTexture> PtexTexturePtr;
 
+class MFnMesh;
+
 
 
 //! Node helping to obtain information about ptextures. It can visualize them in the viewport as well
@@ -50,6 +55,52 @@ class PtexVisNode : public MPxLocatorNode
 	typedef ogl_system_buffer<VtxPrimitive, ColPrimitive>	OGLSysBuf;
 	typedef ogl_gpu_buffer<VtxPrimitive, ColPrimitive>		OGLGPUBuf;
 	
+	//! A sample location within a triangle, given as factors of the edges (b-a) and (c-a)
+	struct SampleUV
+	{
+		float u;
+		float v;
+		
+		inline
+		SampleUV(float u=0.f, float v=0.f)
+		    : u(u)
+		    , v(v)
+		{}
+	};
+	
+	typedef std::vector<SampleUV>							SampleUVVector;
+	typedef std::pair<int, int>								FaceRes;
+	typedef std::map<FaceRes, SampleUVVector>				SampleTableMap;
+	
+	//! Associates a ptex face with the polygon (or polygon corner) it is mapped to
+	struct FaceMapping
+	{
+		int		vtx_ofs;		//!< offset into the polygon vertex list at which the polygon's vertices start
+		int		num_vtx;		//!< amount of vertices of the polygon
+		int		subface;		//!< index of the polygon corner of a quad subface, or -1 if it maps the whole polygon
+	};
+	
+	typedef std::vector<FaceMapping>						FaceMappingVector;
+	
+	//! Caches the mapping of ptex faces to polygons, which is only rebuilt if the mesh topology changes.
+	//! The polygon counts and vertex ids are kept and compared in full, as counts alone miss changes like edge flips
+	struct TopologyCache
+	{
+		int					num_vertices;		//!< amount of vertices of the mesh we were built from
+		int					num_ptex_faces;		//!< amount of faces in the texture we were built for
+		Ptex::MeshType		mesh_type;			//!< mesh type of the texture we were built for
+		MIntArray			poly_counts;		//!< vertex count per polygon, as returned by MFnMesh::getVertices
+		MIntArray			poly_vtx_ids;		//!< vertex ids of all polygons, as returned by MFnMesh::getVertices
+		FaceMappingVector	faces;				//!< one mapping per ptex face
+		
+		TopologyCache()
+		{ clear(); }
+		
+		//! Reset the cache to an invalid state, which forces it to be rebuilt on next use
+		void clear();
+	};
+	
+	
 	public:
 		PtexVisNode();
 		virtual ~PtexVisNode();
@@ -90,6 +141,24 @@ class PtexVisNode : public MPxLocatorNode
 		template <typename Buffer>
 		bool update_sample_buffer(Buffer& buf);
 		
+		//! Assure our system cache contains samples matching the current configuration, resampling if required.
+		//! \return true on success
+		bool update_system_cache();
+		
+		//! Fill our sample export attributes with the contents of our system cache
+		void export_samples(MDataBlock& data);
+		
+		//! \return sample pattern used in FaceAbsolute mode for a triangle face of the given (sample-) resolution.
+		//! The table is computed on first use and cached for all faces of the same resolution.
+		//! \note not thread-safe, obtain all tables before sampling in parallel
+		const SampleUVVector& face_absolute_samples(const int ures, const int vres);
+		
+		//! Assure our topology cache maps the faces of the given texture to the polygons of the given mesh.
+		//! Rebuilding only happens if the topology of the mesh or the texture changed.
+		//! \return true on success
+		//! \note changes error code on failure
+		bool update_topology(const MFnMesh& meshFn, const PtexTexture& tex);
+		
 	protected:
 		// Input attributes
 		static MObject aPtexFileName;			//!< path to ptex file to use
@@ -113,6 +182,8 @@ class PtexVisNode : public MPxLocatorNode
 		static MObject aOutUBorderMode;			//!< u border mode
 		static MObject aOutVBorderMode;			//!< u border mode
 		static MObject aOutNumSamples;			//!< number of samples we have taken
+		static MObject aOutSamplePositions;		//!< point array of all sample positions in local space
+		static MObject aOutSampleColors;		//!< vector array of the color of each sample
 		static MObject aNeedsCompute;			//!< dummy output (for now) to check if we need to compute
 		
 
@@ -122,10 +193,13 @@ class PtexVisNode : public MPxLocatorNode
 		PtexTexturePtr	m_ptex_texture;			//!< texture pointer
 		MString			m_error;				//!< error string
 		bool			m_needs_cache_update;	//!< if tree, the cache needs updating on next drawing
+		bool			m_sysbuf_uptodate;		//!< if true, our system cache holds the current samples
 		
 		OGLSysBuf		m_sysbuf;				//!< system based cache for primitives
 		OGLGPUBuf		m_gpubuf;				//!< gpu based cache for primitives
 		MGLfloat		m_gl_point_size;		//!< size of a point when drawing (cache)	
+		SampleTableMap	m_face_abs_samples;		//!< per-resolution sample patterns for FaceAbsolute mode
+		TopologyCache	m_topo;					//!< ptex face to polygon mapping
 };
 
 #endif
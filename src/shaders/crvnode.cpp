@@ -175,25 +175,55 @@ void vnorm(const float*const v, float* out) {
 	out[2] = v[2] / l;
 }
 
+//! \return curvature at the vertex with the given normal, relative to the given triangle normal
+//! We remap the value to be 1.0 at 90DEG, and 2.0 at 180DEG
 inline
-void computeVertexCurvature(const float triNormal[3], const float vtxNormal[3], MRampAttribute* map, const float normalizer, float outColor[3])
+float computeVertexCurvature(const float triNormal[3], const float vtxNormal[3], const float normalizer)
 {
-	// We remap the value to be 1.0 at 90DEG, and 2.0 at 180DEG
-	const float angle = acosf(fminf(dot(vtxNormal, triNormal), 1.0f-FLT_EPSILON)) / ((float)pi_2 * 2 * normalizer);
-
-	if (map) {
-		MColor col;
-		map->getColorAtPosition(angle, col);
-		outColor[0] = (float)col.r;
-		outColor[1] = (float)col.g;
-		outColor[2] = (float)col.b;
+	return acosf(fminf(dot(vtxNormal, triNormal), 1.0f-FLT_EPSILON)) / ((float)pi_2 * 2 * normalizer);
+}
+
+//! Convert the given curvature into a color. If lut is set, it is expected to have
+//! MeshCurvatureHWShader::rampLUTSize rgb colors
+inline
+void curvatureToColor(const float curvature, const float* lut, float outColor[3])
+{
+	if (lut) {
+		// the ramp clamps positions outside of its range, and so do we. This handles NaN as well
+		const float pos = curvature * (MeshCurvatureHWShader::rampLUTSize - 1) + 0.5f;
+		int index = 0;
+		if (pos >= (float)(MeshCurvatureHWShader::rampLUTSize - 1)) {
+			index = MeshCurvatureHWShader::rampLUTSize - 1;
+		} else if (pos > 0.0f) {
+			index = (int)pos;
+		}
+		const float* col = lut + index * 3;
+		outColor[0] = col[0];
+		outColor[1] = col[1];
+		outColor[2] = col[2];
 	} else {
-		outColor[0] = angle;
-		outColor[1] = (1.0f-angle) * 0.75f;
+		outColor[0] = curvature;
+		outColor[1] = (1.0f-curvature) * 0.75f;
 		outColor[2] = 0.0f;
 	}
 }
 
+void MeshCurvatureHWShader::updateRampLUT()
+{
+	MStatus stat;
+	MRampAttribute ramp(thisMObject(), aCurveMap, &stat);
+	CHECK_MSTATUS(stat);
+	
+	m_rampLUT.resize(rampLUTSize * 3);
+	MColor col;
+	for (int i = 0; i < rampLUTSize; ++i) {
+		ramp.getColorAtPosition((float)i / (float)(rampLUTSize - 1), col, &stat);
+		m_rampLUT[i*3 + 0] = (float)col.r;
+		m_rampLUT[i*3 + 1] = (float)col.g;
+		m_rampLUT[i*3 + 2] = (float)col.b;
+	}
+}
+
 MStatus MeshCurvatureHWShader::geometry(const MDrawRequest& request,
 			                            M3dView& view,
 			                            int prim,
@@ -232,74 +262,102 @@ MStatus MeshCurvatureHWShader::geometry(const MDrawRequest& request,
 		gl->glColorMaterial(GL_FRONT, GL_DIFFUSE);
 	}
 	
-	float vtxColor[3];
-	MRampAttribute mapper(thisMObject(), aCurveMap, &stat);
-	CHECK_MSTATUS(stat);
-	MRampAttribute* mapPtr = MPlug(thisMObject(), aUseMap).asBool() ? &mapper : NULL;
+	// Sample the ramp once per draw, the per-vertex mapping is a table lookup
+	const float* lut = NULL;
+	if (MPlug(thisMObject(), aUseMap).asBool()) {
+		updateRampLUT();
+		lut = &m_rampLUT[0];
+	}
 
 	const float*const normals = normalArrays[0];
 	const unsigned int*const indexArrayEnd = indexArray + indexCount;
+	
+	// ACCUMULATE CURVATURE
+	///////////////////////
+	// The curvature of each vertex is the average of its curvature in all adjacent triangles.
+	// This allows us to draw the indexed geometry as is, with one color per vertex
+	m_curvature.assign(vertexCount, 0.0f);
+	m_weights.assign(vertexCount, 0.0f);
+	
+	for (const unsigned int* cIndex = indexArray; cIndex < indexArrayEnd; cIndex += 3) {
+		// I expect this to be unrolled when optimized
 
-	for (const unsigned int* cIndex = indexArray; cIndex < indexArrayEnd;) {
-		gl->glBegin(prim);
-		{
-			// I expect this to be unrolled when optimized
-
-			float triNormal[3] = {0.0f, 0.0f, 0.0f};
+		float triNormal[3] = {0.0f, 0.0f, 0.0f};
 
-			// compute face normal, as average of all given normals
-			for (uint i = 0; i < 3; ++i) {
-				const unsigned id = cIndex[i]*3;
-				triNormal[0] += normals[id+0] / 3.0f;
-				triNormal[1] += normals[id+1] / 3.0f;
-				triNormal[2] += normals[id+2] / 3.0f;
-			}
+		// compute face normal, as average of all given normals
+		for (uint i = 0; i < 3; ++i) {
+			const unsigned id = cIndex[i]*3;
+			triNormal[0] += normals[id+0] / 3.0f;
+			triNormal[1] += normals[id+1] / 3.0f;
+			triNormal[2] += normals[id+2] / 3.0f;
+		}
 
-			float extend = 0.0f;
-			float edge[3];
-			for (uint i = 0; i < 3; ++i) {
-				int a; int b;
-				switch(i) {
-					case 0: {
-						a = 0;
-						b = 1;
-						break;
-					}
-					case 1: {
-						a = 0;
-						b = 2;
-						break;
-					}
-					case 2: {
-						a = 1;
-						b = 2;
-						break;
-					}
+		float extend = 0.0f;
+		float edge[3];
+		for (uint i = 0; i < 3; ++i) {
+			int a; int b;
+			switch(i) {
+				case 0: {
+					a = 0;
+					b = 1;
+					break;
+				}
+				case 1: {
+					a = 0;
+					b = 2;
+					break;
+				}
+				case 2: {
+					a = 1;
+					b = 2;
+					break;
 				}
-				const float* va = &vertexArray[cIndex[a] * 3];
-				const float* vb = &vertexArray[cIndex[b] * 3];
-
-				edge[0] = va[0] - vb[0];
-				edge[1] = va[1] - vb[1];
-				edge[2] = va[2] - vb[2];
-
-				extend += vlen(edge);
 			}
+			const float* va = &vertexArray[cIndex[a] * 3];
+			const float* vb = &vertexArray[cIndex[b] * 3];
 
+			edge[0] = va[0] - vb[0];
+			edge[1] = va[1] - vb[1];
+			edge[2] = va[2] - vb[2];
 
-			for (unsigned int i = 0; i < 3; ++i, ++cIndex) {
-				const unsigned drawIndex = *cIndex * 3;
-				computeVertexCurvature(triNormal, &normals[drawIndex], mapPtr, extend / scale, vtxColor);
+			extend += vlen(edge);
+		}
 
-				gl->glColor3fv(vtxColor);
-				if (!flatShading) {
-					gl->glNormal3fv(&normals[drawIndex]);
-				}
-				gl->glVertex3fv(&vertexArray[drawIndex]);
-			}
+		for (unsigned int i = 0; i < 3; ++i) {
+			const unsigned int vid = cIndex[i];
+			m_curvature[vid] += computeVertexCurvature(triNormal, &normals[vid * 3], extend / scale);
+			m_weights[vid] += 1.0f;
 		}
-		gl->glEnd();
 	}// for each triangle
+	
+	// MAP CURVATURE TO COLORS
+	//////////////////////////
+	m_colors.resize(vertexCount * 3);
+	for (int i = 0; i < vertexCount; ++i) {
+		const float curvature = m_weights[i] > 0.0f ? m_curvature[i] / m_weights[i] : 0.0f;
+		curvatureToColor(curvature, lut, &m_colors[i * 3]);
+	}// for each vertex
+	
+	// DRAW
+	///////
+	if (vertexCount == 0 || indexCount == 0) {
+		return MS::kSuccess;
+	}
+	
+	gl->glPushClientAttrib(GL_CLIENT_VERTEX_ARRAY_BIT);
+	{
+		gl->glEnableClientState(GL_VERTEX_ARRAY);
+		gl->glVertexPointer(3, GL_FLOAT, 0, vertexArray);
+		gl->glEnableClientState(GL_COLOR_ARRAY);
+		gl->glColorPointer(3, GL_FLOAT, 0, &m_colors[0]);
+		if (!flatShading) {
+			gl->glEnableClientState(GL_NORMAL_ARRAY);
+			gl->glNormalPointer(GL_FLOAT, 0, normals);
+		}
+		
+		gl->glDrawElements(prim, indexCount, GL_UNSIGNED_INT, indexArray);
+	}
+	gl->glPopClientAttrib();
 
 	return MS::kSuccess;
 }
@@ -62,6 +62,7 @@ class MeshCurvatureHWShader : public MPxHwShaderNode
 		
 		static const MTypeId typeId;				//!< binary file type id
 		static const MString typeName;				//!< node type name
+		static const int rampLUTSize = 256;			//!< amount of colors sampled from the curvature map
 
 	protected:
 		// Input attributes
@@ -69,6 +70,16 @@ class MeshCurvatureHWShader : public MPxHwShaderNode
 		static MObject aCurveMap;				//!< a ramp attribute to allow mapping 
 		static MObject aFlatShading;			//!< if set, we will also light the surface
 		static MObject aScale;					//!< a scale factor, to handle differently scaled scenes
+		
+	protected:
+		//! sample our curvature map ramp into our lookup table
+		void updateRampLUT();
+		
+	protected:
+		std::vector<float>	m_rampLUT;			//!< rampLUTSize rgb colors sampled uniformly from the curvature map
+		std::vector<float>	m_curvature;		//!< per-vertex curvature, accumulated from all adjacent triangles
+		std::vector<float>	m_weights;			//!< amount of triangles which contributed to a vertex' curvature
+		std::vector<float>	m_colors;			//!< per-vertex rgb colors, ready to be used as color array
 
 };
 
@@ -36,6 +36,12 @@ class TestPtex(TestPtexVisNodeBase):
 			assert n.needsComputation.asInt() == True
 		#END set display mode
 		
+		# samples are exported for use by other nodes
+		positions = n.outSamplePositions.masData().array()
+		colors = n.outSampleColors.masData().array()
+		assert positions.length() > 0
+		assert positions.length() == colors.length() == n.outNumSamples.asInt()
+		
 		
 		# channels change if texture changes
 		n.ptfp.setString(self.ptexturePath('nonquad'))